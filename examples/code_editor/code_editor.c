@@ -0,0 +1,205 @@
+/*******************************************************************************************
+*
+*   raygui - code editor with syntax highlight
+*
+*   DEPENDENCIES:
+*       raylib 5.0  - Windowing/input management and drawing.
+*       raygui 4.5  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   USAGE:
+*       Drop a C source file into the window (or pass it as first argument) to edit it,
+*       C tokenizer is attached to the text editor, only edited lines are tokenized again
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+#define GUI_TEXT_EDITOR_IMPLEMENTATION
+#include "../text_editor/gui_text_editor.h"
+
+#include <string.h>                     // Required for: strlen(), strncmp()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// C token classes, index into editor tokenColors
+typedef enum {
+    TOKEN_TEXT = 0,
+    TOKEN_KEYWORD,
+    TOKEN_NUMBER,
+    TOKEN_STRING,
+    TOKEN_COMMENT,
+    TOKEN_PREPROCESSOR
+} CodeToken;
+
+// C lexer state at line end
+typedef enum {
+    LEX_DEFAULT = 0,
+    LEX_BLOCK_COMMENT
+} CodeLexState;
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static int TokenizeC(const char *text, int length, int lexState, unsigned char *tokens, void *userData);
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 560;
+
+    InitWindow(screenWidth, screenHeight, "raygui - code editor");
+    SetExitKey(0);
+
+    char *fileText = LoadFileText((argc > 1)? argv[1] : __FILE__);
+    GuiTextEditorState editorState = InitGuiTextEditor(fileText);
+    UnloadFileText(fileText);
+
+    editorState.tokenColors[TOKEN_KEYWORD] = (Color){ 0, 82, 204, 255 };
+    editorState.tokenColors[TOKEN_NUMBER] = (Color){ 9, 134, 88, 255 };
+    editorState.tokenColors[TOKEN_STRING] = (Color){ 163, 21, 21, 255 };
+    editorState.tokenColors[TOKEN_COMMENT] = (Color){ 0, 128, 0, 255 };
+    editorState.tokenColors[TOKEN_PREPROCESSOR] = (Color){ 175, 0, 219, 255 };
+    GuiTextEditorSetTokenizer(&editorState, TokenizeC, NULL);
+
+    bool editMode = false;
+
+    SetTargetFPS(60);
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsFileDropped())
+        {
+            FilePathList droppedFiles = LoadDroppedFiles();
+
+            if (droppedFiles.count > 0)
+            {
+                fileText = LoadFileText(droppedFiles.paths[0]);
+                GuiTextEditorSetText(&editorState, fileText);
+                UnloadFileText(fileText);
+            }
+
+            UnloadDroppedFiles(droppedFiles);
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            if (GuiTextEditor((Rectangle){ 10, 40, (float)screenWidth - 20, (float)screenHeight - 80 }, &editorState, editMode)) editMode = !editMode;
+
+            GuiCheckBox((Rectangle){ 10, 12, 16, 16 }, "Wrap lines", &editorState.wrapText);
+
+            GuiStatusBar((Rectangle){ 0, (float)screenHeight - 30, (float)screenWidth, 30 },
+                TextFormat("Line %i/%i, %i bytes%s", GuiTextEditorGetLine(&editorState, editorState.cursor) + 1,
+                    editorState.lineCount, editorState.length, editMode? " - editing" : ""));
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadGuiTextEditor(&editorState);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Tokenize one line of C code, block comments are carried to next line through lexer state
+static int TokenizeC(const char *text, int length, int lexState, unsigned char *tokens, void *userData)
+{
+    static const char *keywords[] = {
+        "auto", "bool", "break", "case", "char", "const", "continue", "default", "do", "double", "else", "enum",
+        "extern", "false", "float", "for", "goto", "if", "inline", "int", "long", "return", "short", "signed",
+        "sizeof", "static", "struct", "switch", "true", "typedef", "union", "unsigned", "void", "volatile", "while"
+    };
+
+    (void)userData;
+
+    int i = 0;
+    bool lineStart = true;
+
+    while (i < length)
+    {
+        char c = text[i];
+        int start = i;
+        CodeToken token = TOKEN_TEXT;
+
+        if ((lexState == LEX_BLOCK_COMMENT) || ((c == '/') && (i + 1 < length) && (text[i + 1] == '*')))
+        {
+            if (lexState != LEX_BLOCK_COMMENT) i += 2;
+            lexState = LEX_BLOCK_COMMENT;
+
+            while ((i < length) && (lexState == LEX_BLOCK_COMMENT))
+            {
+                if ((text[i] == '*') && (i + 1 < length) && (text[i + 1] == '/')) { lexState = LEX_DEFAULT; i++; }
+                i++;
+            }
+
+            token = TOKEN_COMMENT;
+        }
+        else if ((c == '/') && (i + 1 < length) && (text[i + 1] == '/')) { i = length; token = TOKEN_COMMENT; }
+        else if ((c == '#') && lineStart)
+        {
+            // Directive until end of line or a comment start
+            while ((i < length) && !((text[i] == '/') && (i + 1 < length) && ((text[i + 1] == '/') || (text[i + 1] == '*')))) i++;
+            token = TOKEN_PREPROCESSOR;
+        }
+        else if ((c == '"') || (c == '\''))
+        {
+            for (i++; (i < length) && (text[i] != c); i++) if ((text[i] == '\\') && (i + 1 < length)) i++;
+            if (i < length) i++;
+            token = TOKEN_STRING;
+        }
+        else if ((c >= '0') && (c <= '9'))
+        {
+            while ((i < length) && (((text[i] >= '0') && (text[i] <= '9')) || ((text[i] >= 'a') && (text[i] <= 'z')) || ((text[i] >= 'A') && (text[i] <= 'Z')) || (text[i] == '.'))) i++;
+            token = TOKEN_NUMBER;
+        }
+        else if (((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_'))
+        {
+            while ((i < length) && (((text[i] >= 'a') && (text[i] <= 'z')) || ((text[i] >= 'A') && (text[i] <= 'Z')) || ((text[i] >= '0') && (text[i] <= '9')) || (text[i] == '_'))) i++;
+
+            for (int k = 0; k < (int)(sizeof(keywords)/sizeof(keywords[0])); k++)
+            {
+                if (((int)strlen(keywords[k]) == i - start) && (strncmp(keywords[k], text + start, i - start) == 0)) { token = TOKEN_KEYWORD; break; }
+            }
+        }
+        else i++;
+
+        if ((c != ' ') && (c != '\t')) lineStart = false;
+
+        for (int k = start; k < i; k++) tokens[k] = (unsigned char)token;
+    }
+
+    return lexState;
+}
@@ -19,6 +19,8 @@
 *       - GuiColorBarAlpha()
 *       - GuiScrollPanel()
 *
+*   NOTE: Controls are drawn through a draw stream with rectangles merging and occlusion culling,
+*   draw commands reduction is shown in status bar
 *
 *   DEPENDENCIES:
 *       raylib 4.5          - Windowing/input management and drawing
@@ -111,6 +113,8 @@ int main()
     int toggleSliderActive = 0;
 
     Vector2 viewScroll = { 0, 0 };
+
+    GuiStats drawStats = { 0 };
     //----------------------------------------------------------------------------------
 
     // Custom GUI font loading
@@ -195,6 +199,9 @@ int main()
 
             // raygui: controls drawing
             //----------------------------------------------------------------------------------
+            GuiBeginFrame();
+            GuiBeginDrawStream(DRAW_STREAM_MERGE_RECTANGLES | DRAW_STREAM_CULL_OCCLUDED);
+
             // Check all possible events that require GuiLock
             if (dropDown000EditMode || dropDown001EditMode) GuiLock();
 
@@ -272,10 +279,15 @@ int main()
             GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_MIDDLE);
 
             GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-            GuiStatusBar((Rectangle){ 0, (float)GetScreenHeight() - 20, (float)GetScreenWidth(), 20 }, "This is a status bar");
+            GuiStatusBar((Rectangle){ 0, (float)GetScreenHeight() - 20, (float)GetScreenWidth(), 20 }, TextFormat("Draw commands: %i, merged: %i, culled: %i, drawn: %2.1f%%",
+                drawStats.drawCommands, drawStats.drawCommandsMerged, drawStats.drawCommandsCulled,
+                (drawStats.drawCommands > 0)? 100.0f*(drawStats.drawCommands - drawStats.drawCommandsMerged - drawStats.drawCommandsCulled)/drawStats.drawCommands : 100.0f));
             GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
             //GuiSetStyle(STATUSBAR, TEXT_INDENTATION, 20);
 
+            GuiEndDrawStream();
+            drawStats = GuiGetStats();      // Stats shown on next frame, draw stream must be ended
+
             if (showMessageBox)
             {
                 DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), Fade(RAYWHITE, 0.8f));
@@ -104,15 +104,22 @@ void GuiWindowFloating(Vector2 *position, Vector2 *size, bool *minimized, bool *
 
             bool require_scissor = size->x < content_size.x || size->y < content_size.y;
 
-            if(require_scissor) {
-                BeginScissorMode(scissor.x, scissor.y, scissor.width, scissor.height);
-            }
+            // content is replayed from recorded draw commands while scroll is unchanged and mouse is not over it
+            // scroll offsets are packed in 16 bits halves, every scroll position up to 65535 pixels is a different version
+            unsigned int version = (((unsigned int)(int)scroll->x & 0xffff) << 16) | ((unsigned int)(int)scroll->y & 0xffff);
+
+            if(GuiBeginCachedRegion(position, scissor, version)) {
+                if(require_scissor) {
+                    GuiBeginScissor(scissor);
+                }
 
-            draw_content(*position, *scroll);
+                draw_content(*position, *scroll);
 
-            if(require_scissor) {
-                EndScissorMode();
+                if(require_scissor) {
+                    GuiEndScissor();
+                }
             }
+            GuiEndCachedRegion();
         }
 
         // draw the resize button/icon
@@ -0,0 +1,358 @@
+/*******************************************************************************************
+*
+*   Icon Set v1.0 - Memory mapped icon sets of any icons size with name index
+*
+*   MODULE USAGE:
+*       #define GUI_ICON_SET_IMPLEMENTATION
+*       #include "gui_icon_set.h"
+*
+*       LOAD: GuiIconSet set = LoadGuiIconSet(fileName);                // Icons file (.rgi), memory mapped
+*       USE:  GuiSetIconSet(&set);                                      // Icons set in use, one pointer swap
+*             int iconId = GuiIconByName("FILE_SAVE");                  // Icon id by name in set in use, hashed
+*             GuiButton(bounds, GuiIconText(iconId, "Save"));           // Controls draw icons of set in use
+*       FREE: UnloadGuiIconSet(&set);
+*
+*   DESCRIPTION:
+*       An icon set keeps all the icons of one raygui icons file (.rgi), any icons size declared
+*       in the file is supported (16x16, 32x32, 64x64...) and multiple sets can be loaded at once,
+*       switching the set in use only changes raygui icons data pointer (GuiSetIcons()).
+*
+*       Files are memory mapped (mmap/CreateFileMapping) copy-on-write, so loading does not read
+*       or copy icons data or names, pages are loaded by the system when icons are drawn. Names are
+*       indexed once at load in an open addressing hash table (FNV-1a), name lookups do not scan
+*       the names list, for sets with thousands of icons.
+*
+*       Icons file format (.rgi, little endian):
+*           char signature[4]               "rGI "
+*           short version                   100
+*           short reserved
+*           short count                     Icons count (N)
+*           short size                      Icons size (S)
+*           char names[N][32]               Icons name id, NULL padded
+*           unsigned int data[N][S*S/32]    Icons data, one bit per pixel
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#ifndef GUI_ICON_SET_H
+#define GUI_ICON_SET_H
+
+typedef struct GuiIconSetData GuiIconSetData;   // Icons data, names and name index (internal)
+
+// Gui icon set, icons of one icons file
+typedef struct {
+    int iconSize;               // Icons size in pixels (squared)
+    int iconCount;              // Icons in set
+    GuiIconSetData *data;
+} GuiIconSet;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiIconSet LoadGuiIconSet(const char *fileName);                   // Load icons file (.rgi) as icon set, memory mapped
+void UnloadGuiIconSet(GuiIconSet *set);                             // Unload icon set (unset if in use)
+int FindGuiIconSetIcon(GuiIconSet set, const char *name);           // Find icon id by name in icon set, -1 if not found
+const char *GetGuiIconSetName(GuiIconSet set, int iconId, char *name); // Get icon name in icon set (copied, 32 bytes buffer)
+
+void GuiSetIconSet(GuiIconSet *set);                                // Set icon set in use for raygui icons, NULL for default icons
+int GuiIconByName(const char *name);                                // Find icon id by name in icon set in use, -1 if not found
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_ICON_SET_H
+
+/***********************************************************************************
+*
+*   GUI_ICON_SET IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(GUI_ICON_SET_IMPLEMENTATION)
+
+#include "../../src/raygui.h"
+
+#include <stdlib.h>     // Required for: calloc(), free()
+#include <string.h>     // Required for: memcmp(), memcpy(), strncmp()
+
+#if defined(_WIN32)
+// NOTE: Required Win32 functions are declared manually to avoid windows.h conflicts with raylib
+#if defined(__cplusplus)
+extern "C" {
+#endif
+__declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *security, unsigned long creation, unsigned long flags, void *templateFile);
+__declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+__declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *security, unsigned long protect, unsigned long sizeHigh, unsigned long sizeLow, const char *name);
+__declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+__declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+#if defined(__cplusplus)
+}
+#endif
+#else
+    #include <fcntl.h>          // Required for: open()
+    #include <unistd.h>         // Required for: close()
+    #include <sys/mman.h>       // Required for: mmap(), munmap()
+    #include <sys/stat.h>       // Required for: fstat()
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GUI_ICON_SET_HEADER_SIZE        12          // Signature, version, reserved, count and size
+#define GUI_ICON_SET_NAME_LENGTH        32          // Icon name id length, same as RAYGUI_ICON_MAX_NAME_LENGTH
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct GuiIconSetData {
+    // Icons data and names, used in place from mapped file
+    unsigned int *icons;
+    const char *names;
+    void *mapData;
+    long long mapSize;
+#if defined(_WIN32)
+    void *mapHandle;
+#endif
+
+    // Name index, open addressing (icon id + 1, 0 for empty slot)
+    int *index;
+    unsigned int indexMask;
+};
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static GuiIconSet *guiIconSet = NULL;           // Icon set in use, NULL for raygui default icons
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int GetIconNameHash(const char *name);
+static void BuildIconSetIndex(GuiIconSet *set);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load icons file (.rgi) as icon set, memory mapped (icons data and names are used in place)
+// NOTE: File is mapped copy-on-write, icons data can be edited (i.e. GuiGetIcons()) without changing the file
+GuiIconSet LoadGuiIconSet(const char *fileName)
+{
+    GuiIconSet set = { 0 };
+    GuiIconSetData *data = (GuiIconSetData *)calloc(1, sizeof(GuiIconSetData));
+    long long size = 0;
+
+#if defined(_WIN32)
+    // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);
+    if (file == (void *)(long long)-1) { free(data); return set; }
+
+    GetFileSizeEx(file, &size);
+
+    if (size >= GUI_ICON_SET_HEADER_SIZE)
+    {
+        // PAGE_WRITECOPY, FILE_MAP_COPY
+        data->mapHandle = CreateFileMappingA(file, NULL, 0x08, 0, 0, NULL);
+        if (data->mapHandle != NULL) data->mapData = MapViewOfFile(data->mapHandle, 0x0001, 0, 0, 0);
+        if ((data->mapData == NULL) && (data->mapHandle != NULL)) CloseHandle(data->mapHandle);
+    }
+
+    CloseHandle(file);      // Mapping keeps a reference to the file
+#else
+    int file = open(fileName, O_RDONLY);
+    if (file < 0) { free(data); return set; }
+
+    struct stat info = { 0 };
+    if (fstat(file, &info) == 0) size = (long long)info.st_size;
+
+    if (size >= GUI_ICON_SET_HEADER_SIZE)
+    {
+        data->mapData = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+        if (data->mapData == MAP_FAILED) data->mapData = NULL;
+    }
+
+    close(file);            // Mapping keeps a reference to the file
+#endif
+
+    if (data->mapData == NULL) { free(data); return set; }
+
+    data->mapSize = size;
+    set.data = data;
+
+    // Check header and file size, every icon requires a whole number of unsigned int
+    const short *header = (const short *)data->mapData;
+    int iconCount = header[4];
+    int iconSize = header[5];
+    bool valid = (memcmp(data->mapData, "rGI ", 4) == 0) && (iconCount > 0) && (iconSize > 0) && ((iconSize*iconSize)%32 == 0) &&
+                 ((long long)GUI_ICON_SET_HEADER_SIZE + (long long)iconCount*GUI_ICON_SET_NAME_LENGTH + (long long)iconCount*iconSize*iconSize/8 <= size);
+
+    if (!valid)
+    {
+        UnloadGuiIconSet(&set);
+        return set;
+    }
+
+    data->names = (const char *)data->mapData + GUI_ICON_SET_HEADER_SIZE;
+    data->icons = (unsigned int *)(data->names + iconCount*GUI_ICON_SET_NAME_LENGTH);
+    set.iconSize = iconSize;
+    set.iconCount = iconCount;
+
+    BuildIconSetIndex(&set);
+
+    return set;
+}
+
+// Unload icon set (unset if in use)
+void UnloadGuiIconSet(GuiIconSet *set)
+{
+    if (guiIconSet == set) GuiSetIconSet(NULL);
+
+    GuiIconSetData *data = set->data;
+
+    if (data != NULL)
+    {
+        if (data->mapData != NULL)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(data->mapData);
+            CloseHandle(data->mapHandle);
+#else
+            munmap(data->mapData, (size_t)data->mapSize);
+#endif
+        }
+
+        free(data->index);
+        free(data);
+    }
+
+    set->iconSize = 0;
+    set->iconCount = 0;
+    set->data = NULL;
+}
+
+// Find icon id by name in icon set, -1 if not found
+// NOTE: In case of repeated names, the first icon with the name is found
+int FindGuiIconSetIcon(GuiIconSet set, const char *name)
+{
+    if ((set.data == NULL) || (set.data->index == NULL) || (name == NULL) || (name[0] == '\0')) return -1;
+
+    int length = 0;
+    while ((length <= GUI_ICON_SET_NAME_LENGTH) && (name[length] != '\0')) length++;
+    if (length > GUI_ICON_SET_NAME_LENGTH) return -1;      // Names longer than name id length are not stored
+
+    unsigned int slot = GetIconNameHash(name) & set.data->indexMask;
+
+    while (set.data->index[slot] != 0)
+    {
+        int iconId = set.data->index[slot] - 1;
+        if (strncmp(set.data->names + iconId*GUI_ICON_SET_NAME_LENGTH, name, GUI_ICON_SET_NAME_LENGTH) == 0) return iconId;
+
+        slot = (slot + 1) & set.data->indexMask;
+    }
+
+    return -1;
+}
+
+// Get icon name in icon set, copied into name buffer (32 bytes) as NULL terminated string
+// NOTE: Names filling the 32 bytes of the name id are truncated to 31 characters
+const char *GetGuiIconSetName(GuiIconSet set, int iconId, char *name)
+{
+    name[0] = '\0';
+
+    if ((set.data != NULL) && (iconId >= 0) && (iconId < set.iconCount))
+    {
+        memcpy(name, set.data->names + iconId*GUI_ICON_SET_NAME_LENGTH, GUI_ICON_SET_NAME_LENGTH);
+        name[GUI_ICON_SET_NAME_LENGTH - 1] = '\0';
+    }
+
+    return name;
+}
+
+// Set icon set in use for raygui icons, NULL for default icons
+void GuiSetIconSet(GuiIconSet *set)
+{
+    if ((set != NULL) && (set->data != NULL))
+    {
+        GuiSetIcons(set->data->icons, set->iconSize, set->iconCount);
+        guiIconSet = set;
+    }
+    else
+    {
+        GuiSetIcons(NULL, 0, 0);
+        guiIconSet = NULL;
+    }
+}
+
+// Find icon id by name in icon set in use, -1 if not found
+int GuiIconByName(const char *name)
+{
+    if (guiIconSet == NULL) return -1;
+
+    return FindGuiIconSetIcon(*guiIconSet, name);
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get icon name hash (FNV-1a), up to name id length
+static unsigned int GetIconNameHash(const char *name)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; (i < GUI_ICON_SET_NAME_LENGTH) && (name[i] != '\0'); i++)
+    {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Build name index for all icons names, table is kept at most half full
+static void BuildIconSetIndex(GuiIconSet *set)
+{
+    GuiIconSetData *data = set->data;
+
+    unsigned int capacity = 16;
+    while (capacity < (unsigned int)set->iconCount*2) capacity *= 2;
+
+    data->index = (int *)calloc(capacity, sizeof(int));
+    data->indexMask = capacity - 1;
+
+    for (int iconId = 0; iconId < set->iconCount; iconId++)
+    {
+        const char *name = data->names + iconId*GUI_ICON_SET_NAME_LENGTH;
+        if (name[0] == '\0') continue;      // Unnamed icon, not indexed
+
+        unsigned int slot = GetIconNameHash(name) & data->indexMask;
+        while (data->index[slot] != 0) slot = (slot + 1) & data->indexMask;
+
+        data->index[slot] = iconId + 1;
+    }
+}
+
+#endif // GUI_ICON_SET_IMPLEMENTATION
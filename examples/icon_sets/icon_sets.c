@@ -0,0 +1,135 @@
+/*******************************************************************************************
+*
+*   raygui - icon sets
+*
+*   DEPENDENCIES:
+*       raylib 5.0  - Windowing/input management and drawing.
+*       raygui 4.5  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   USAGE:
+*       Pass up to 3 icons files (.rgi) as arguments, any icons size, all sets are kept loaded
+*       Select a set to use it for raygui icons, type an icon name to find it in the set in use
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+#define GUI_ICON_SET_IMPLEMENTATION
+#include "gui_icon_set.h"
+
+#define MAX_ICON_SETS   4
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 600;
+
+    InitWindow(screenWidth, screenHeight, "raygui - icon sets");
+
+    // NOTE: First set is raygui default icons, no file
+    GuiIconSet sets[MAX_ICON_SETS] = { 0 };
+    int setCount = 1;
+    char setNames[256] = "Default";
+    int setNamesLength = 7;
+
+    for (int i = 1; (i < argc) && (setCount < MAX_ICON_SETS); i++)
+    {
+        sets[setCount] = LoadGuiIconSet(argv[i]);       // Memory mapped, icons used in place
+
+        if (sets[setCount].iconCount > 0)
+        {
+            TextAppend(setNames, TextFormat(";%ix%i (%i)", sets[setCount].iconSize, sets[setCount].iconSize, sets[setCount].iconCount), &setNamesLength);
+            setCount++;
+        }
+    }
+
+    int active = 0;
+    int previousActive = 0;
+
+    char searchText[33] = { 0 };
+    bool searchEditMode = false;
+    int foundIcon = -1;
+
+    Vector2 scroll = { 0 };
+    Rectangle view = { 0 };
+
+    SetTargetFPS(60);
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (active != previousActive)
+        {
+            GuiSetIconSet((active > 0)? &sets[active] : NULL);      // Set switch is a pointer swap
+            previousActive = active;
+        }
+
+        foundIcon = GuiIconByName(searchText);                      // Hashed name index lookup
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            GuiToggleGroup((Rectangle){ 20, 20, 140, 24 }, setNames, &active);
+
+            GuiLabel((Rectangle){ 20, 56, 100, 24 }, "Icon name:");
+            if (GuiTextBox((Rectangle){ 100, 56, 240, 24 }, searchText, 32, searchEditMode)) searchEditMode = !searchEditMode;
+            GuiLabel((Rectangle){ 356, 56, 300, 24 }, (foundIcon >= 0)? GuiIconText(foundIcon, TextFormat("Found: %i", foundIcon)) : "Not found");
+
+            // Icons grid, icons size and count of set in use
+            int iconSize = GuiGetIconSize();
+            int cellSize = iconSize + 8;
+            int iconCount = GuiGetIconCount();
+            Rectangle panel = { 20, 92, (float)screenWidth - 40, (float)screenHeight - 112 };
+            int columns = (int)(panel.width - 16)/cellSize;
+            Rectangle content = { 0, 0, (float)(columns*cellSize), (float)(((iconCount + columns - 1)/columns)*cellSize) };
+
+            GuiScrollPanel(panel, NULL, content, &scroll, &view);
+
+            GuiBeginScissor(view);
+                for (int i = 0; i < iconCount; i++)
+                {
+                    int x = (int)(view.x + scroll.x) + (i%columns)*cellSize + 4;
+                    int y = (int)(view.y + scroll.y) + (i/columns)*cellSize + 4;
+                    if ((y + cellSize < view.y) || (y > view.y + view.height)) continue;    // Only visible rows
+
+                    if (i == foundIcon) DrawRectangle(x - 4, y - 4, cellSize, cellSize, GetColor(GuiGetStyle(DEFAULT, BASE_COLOR_FOCUSED)));
+                    GuiDrawIcon(i, x, y, 1, GetColor(GuiGetStyle(DEFAULT, TEXT_COLOR_NORMAL)));
+                }
+            GuiEndScissor();
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 1; i < setCount; i++) UnloadGuiIconSet(&sets[i]);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
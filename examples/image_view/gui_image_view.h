@@ -0,0 +1,746 @@
+/*******************************************************************************************
+*
+*   Image View v1.0 - Tiled and mip-mapped view for very large images
+*
+*   MODULE USAGE:
+*       #define GUI_IMAGE_VIEW_IMPLEMENTATION
+*       #include "gui_image_view.h"
+*
+*       INIT:   GuiImageViewState state = InitGuiImageView(image);          // Image is referenced, not copied
+*       LOAD:   GuiImageViewState state = LoadGuiImageViewRaw(fileName, width, height);
+*       CHECK:  if (state.data == NULL) { }                                 // Image not supported or levels allocation failed
+*       DRAW:   if (GuiImageView(bounds, &state)) { }                       // Returns 1 on pan or zoom
+*       FREE:   UnloadGuiImageView(&state);
+*
+*   DESCRIPTION:
+*       Images are drawn from a tiles pyramid: level 0 is the image, every next level is half
+*       the size of the previous one (2x2 box downsampling), down to a single tile. Pyramid
+*       levels are generated on a worker thread (or in time slices inside GuiImageView()),
+*       the level in use is the closest one to the zoom that is already generated.
+*
+*       Only tiles intersecting the view at the level in use are uploaded to textures, up to
+*       GUI_IMAGE_VIEW_UPLOADS per frame, and resident tiles are limited to state.budget bytes,
+*       least recently drawn tiles are reused first. While a tile is not resident, the part
+*       of the closest resident tile of a coarser level is drawn instead.
+*
+*       Only uncompressed R8G8B8A8 images are supported, raw files (LoadGuiImageViewRaw()) are
+*       memory mapped, so image pixels are read on demand and never copied.
+*       NOTE: Generated levels are allocated in memory, they require 1/3 of the image size, so
+*       image levels must fit in available memory, view is not loaded (state.data is NULL) if
+*       they can not be allocated.
+*
+*       Control is drawn with raygui draw functions (gui alpha, state, transform and draw stream
+*       apply), so raygui implementation must be included before in the same translation unit.
+*
+*   CONTROLS:
+*       Mouse drag to pan, mouse wheel to zoom around mouse position
+*
+*   CONFIGURATION:
+*       #define GUI_IMAGE_VIEW_NO_THREADS
+*           Generate pyramid levels in time slices inside GuiImageView() instead of using a
+*           worker thread (automatically defined for PLATFORM_WEB)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#ifndef GUI_IMAGE_VIEW_H
+#define GUI_IMAGE_VIEW_H
+
+typedef struct GuiImageViewData GuiImageViewData;   // Pyramid levels, worker and resident tiles (internal)
+
+// Gui image view state
+typedef struct {
+    int width;                  // Image width
+    int height;                 // Image height
+    int levelCount;             // Pyramid levels, level 0 is the image
+    int levelsReady;            // Generated levels, updated on every GuiImageView() call
+    float zoom;                 // Screen pixels per image pixel, 0 to fit image in view
+    Vector2 offset;             // Image position at view top-left corner (image pixels)
+    int budget;                 // Resident tiles memory budget in bytes
+    int tileCount;              // Resident tiles
+
+    GuiImageViewData *data;
+} GuiImageViewState;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiImageViewState InitGuiImageView(Image image);    // Init image view, image must stay valid until unloaded
+GuiImageViewState LoadGuiImageViewRaw(const char *fileName, int width, int height); // Load raw R8G8B8A8 image file, memory mapped
+void UnloadGuiImageView(GuiImageViewState *state);
+
+int GuiImageView(Rectangle bounds, GuiImageViewState *state);   // Image view control, returns 1 on pan or zoom
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_IMAGE_VIEW_H
+
+/***********************************************************************************
+*
+*   GUI_IMAGE_VIEW IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(GUI_IMAGE_VIEW_IMPLEMENTATION)
+
+#include "../../src/raygui.h"
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), realloc(), free()
+#include <string.h>     // Required for: memcpy(), memset()
+#include <math.h>       // Required for: floorf(), fminf(), log2f()
+
+#if defined(PLATFORM_WEB) || defined(__EMSCRIPTEN__)
+    #define GUI_IMAGE_VIEW_NO_THREADS
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>         // Required for: _InterlockedOr64(), _InterlockedExchange64()
+#endif
+
+#if defined(_WIN32)
+// NOTE: Required Win32 functions are declared manually to avoid windows.h conflicts with raylib
+#if defined(__cplusplus)
+extern "C" {
+#endif
+__declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *security, unsigned long creation, unsigned long flags, void *templateFile);
+__declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+__declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *security, unsigned long protect, unsigned long sizeHigh, unsigned long sizeLow, const char *name);
+__declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+__declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+#if !defined(GUI_IMAGE_VIEW_NO_THREADS)
+__declspec(dllimport) void *__stdcall CreateThread(void *security, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+#endif
+#if defined(__cplusplus)
+}
+#endif
+#else
+    #include <fcntl.h>          // Required for: open()
+    #include <unistd.h>         // Required for: close()
+    #include <sys/mman.h>       // Required for: mmap(), munmap()
+    #include <sys/stat.h>       // Required for: fstat()
+    #if !defined(GUI_IMAGE_VIEW_NO_THREADS)
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join()
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GUI_IMAGE_VIEW_TILE_SIZE        256         // Tile size in pixels, every level
+#define GUI_IMAGE_VIEW_MAX_LEVELS        16         // Pyramid levels limit (images up to 8M pixels wide)
+#define GUI_IMAGE_VIEW_UPLOADS           16         // Tiles uploaded to textures per frame
+#define GUI_IMAGE_VIEW_BUDGET    (64*1024*1024)     // Default resident tiles memory budget (bytes)
+#define GUI_IMAGE_VIEW_BUILD_ROWS         8         // Level rows generated between cancel or time budget checks
+#define GUI_IMAGE_VIEW_BUILD_TIME      2000         // Levels generation time slice per frame in microseconds (no worker thread)
+#define GUI_IMAGE_VIEW_MAX_ZOOM        32.0f
+
+#define GUI_IMAGE_VIEW_TILE_BYTES       (GUI_IMAGE_VIEW_TILE_SIZE*GUI_IMAGE_VIEW_TILE_SIZE*4)
+
+// Generated levels count is shared with the worker thread
+#if defined(_MSC_VER)
+    #define GUI_IMAGE_VIEW_LOAD(x)      _InterlockedOr64((volatile long long *)&(x), 0)
+    #define GUI_IMAGE_VIEW_STORE(x, v)  _InterlockedExchange64((volatile long long *)&(x), (v))
+#else
+    #define GUI_IMAGE_VIEW_LOAD(x)      __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+    #define GUI_IMAGE_VIEW_STORE(x, v)  __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Resident tile, texture is kept and updated when tile slot is reused
+typedef struct {
+    int level;
+    int x;
+    int y;
+    unsigned int lastUsed;      // Last frame the tile was drawn
+    Texture2D texture;
+} GuiImageViewTile;
+
+struct GuiImageViewData {
+    // Pyramid levels, level 0 is image pixels (not owned)
+    unsigned char *levels[GUI_IMAGE_VIEW_MAX_LEVELS];
+    int levelWidths[GUI_IMAGE_VIEW_MAX_LEVELS];
+    int levelHeights[GUI_IMAGE_VIEW_MAX_LEVELS];
+
+    void *mapData;              // Raw file mapping, NULL if image provided
+    long long mapSize;
+#if defined(_WIN32)
+    void *mapHandle;
+#endif
+
+    // Levels generation, owned by the worker while it runs
+    int buildLevel;             // Level being generated
+    int buildRow;               // Next row of level being generated
+    long long levelsReady;      // Generated levels (shared)
+    long long cancel;           // Stop request (shared)
+#if !defined(GUI_IMAGE_VIEW_NO_THREADS)
+#if defined(_WIN32)
+    void *thread;
+#else
+    pthread_t thread;
+#endif
+    bool threadActive;
+#endif
+
+    // Resident tiles
+    GuiImageViewTile *tiles;
+    int tileCapacity;
+    unsigned int frame;
+    unsigned char *staging;     // Tile pixels to upload
+
+    // Pan state
+    bool dragging;
+    Vector2 dragMouse;
+};
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+#if !defined(GUI_IMAGE_VIEW_NO_THREADS)
+#if defined(_WIN32)
+static unsigned long __stdcall ImageViewWorker(void *data);
+#else
+static void *ImageViewWorker(void *data);
+#endif
+#endif
+static GuiImageViewState InitImageViewLevels(GuiImageViewData *data, unsigned char *pixels, int width, int height);
+static bool BuildImageViewLevels(GuiImageViewData *data, int rows);
+static void DownsampleImageRow(const unsigned char *row0, const unsigned char *row1, int srcWidth, unsigned char *dst, int dstWidth);
+static GuiImageViewTile *GetImageViewTile(GuiImageViewState *state, int level, int x, int y, int *uploads);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Init image view, pyramid levels generation is started
+// NOTE: Image data is referenced, not copied, only PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 is supported,
+// returned state data is NULL on failure
+GuiImageViewState InitGuiImageView(Image image)
+{
+    GuiImageViewState state = { 0 };
+
+    if ((image.data == NULL) || (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (image.width <= 0) || (image.height <= 0)) return state;
+
+    GuiImageViewData *data = (GuiImageViewData *)calloc(1, sizeof(GuiImageViewData));
+    if (data == NULL) return state;
+
+    return InitImageViewLevels(data, (unsigned char *)image.data, image.width, image.height);
+}
+
+// Load raw image file (R8G8B8A8, no header) as image view, memory mapped (image pixels are used in place)
+// NOTE: Returned state data is NULL on failure
+GuiImageViewState LoadGuiImageViewRaw(const char *fileName, int width, int height)
+{
+    GuiImageViewState state = { 0 };
+    if ((width <= 0) || (height <= 0)) return state;
+
+    GuiImageViewData *data = (GuiImageViewData *)calloc(1, sizeof(GuiImageViewData));
+    if (data == NULL) return state;
+
+    long long size = 0;
+
+#if defined(_WIN32)
+    // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);
+    if (file == (void *)(long long)-1) { free(data); return state; }
+
+    GetFileSizeEx(file, &size);
+
+    if (size >= (long long)width*height*4)
+    {
+        // PAGE_READONLY, FILE_MAP_READ
+        data->mapHandle = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL);
+        if (data->mapHandle != NULL) data->mapData = MapViewOfFile(data->mapHandle, 0x0004, 0, 0, 0);
+        if ((data->mapData == NULL) && (data->mapHandle != NULL)) CloseHandle(data->mapHandle);
+    }
+
+    CloseHandle(file);      // Mapping keeps a reference to the file
+#else
+    int file = open(fileName, O_RDONLY);
+    if (file < 0) { free(data); return state; }
+
+    struct stat info = { 0 };
+    if (fstat(file, &info) == 0) size = (long long)info.st_size;
+
+    if (size >= (long long)width*height*4)
+    {
+        data->mapData = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data->mapData == MAP_FAILED) data->mapData = NULL;
+    }
+
+    close(file);            // Mapping keeps a reference to the file
+#endif
+
+    if (data->mapData == NULL) { free(data); return state; }
+
+    data->mapSize = size;
+
+    return InitImageViewLevels(data, (unsigned char *)data->mapData, width, height);
+}
+
+// Unload image view, levels generation is cancelled
+void UnloadGuiImageView(GuiImageViewState *state)
+{
+    GuiImageViewData *data = state->data;
+
+    if (data != NULL)
+    {
+#if !defined(GUI_IMAGE_VIEW_NO_THREADS)
+        if (data->threadActive)
+        {
+            GUI_IMAGE_VIEW_STORE(data->cancel, 1);
+        #if defined(_WIN32)
+            WaitForSingleObject(data->thread, 0xFFFFFFFF);
+            CloseHandle(data->thread);
+        #else
+            pthread_join(data->thread, NULL);
+        #endif
+        }
+#endif
+        for (int i = 0; i < state->tileCount; i++) UnloadTexture(data->tiles[i].texture);
+        for (int i = 1; i < state->levelCount; i++) free(data->levels[i]);
+
+        if (data->mapData != NULL)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(data->mapData);
+            CloseHandle(data->mapHandle);
+#else
+            munmap(data->mapData, (size_t)data->mapSize);
+#endif
+        }
+
+        free(data->tiles);
+        free(data->staging);
+        free(data);
+    }
+
+    GuiImageViewState empty = { 0 };
+    *state = empty;
+}
+
+// Image view control
+// NOTE: Only tiles intersecting the view are uploaded and drawn, missing tiles are drawn from coarser levels
+int GuiImageView(Rectangle bounds, GuiImageViewState *state)
+{
+    int result = 0;
+    GuiImageViewData *data = state->data;
+    if (data == NULL) return result;
+
+    float borderWidth = (float)GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    Rectangle view = { bounds.x + borderWidth, bounds.y + borderWidth, bounds.width - 2*borderWidth, bounds.height - 2*borderWidth };
+
+    // Update control
+    //--------------------------------------------------------------------
+#if !defined(GUI_IMAGE_VIEW_NO_THREADS)
+    if (!data->threadActive)
+#endif
+    {
+        // Time slice, budget checked every few generated rows
+        double endTime = GetTime() + (double)GUI_IMAGE_VIEW_BUILD_TIME/1000000.0;
+        while (!BuildImageViewLevels(data, GUI_IMAGE_VIEW_BUILD_ROWS) && (GetTime() < endTime)) { }
+    }
+
+    state->levelsReady = (int)GUI_IMAGE_VIEW_LOAD(data->levelsReady);
+
+    float fitZoom = fminf(view.width/state->width, view.height/state->height);
+
+    if (state->zoom <= 0.0f)
+    {
+        state->zoom = fitZoom;
+        state->offset.x = (state->width - view.width/state->zoom)/2;
+        state->offset.y = (state->height - view.height/state->zoom)/2;
+        result = 1;
+    }
+
+    Vector2 mouse = GetTransformedMousePosition();
+
+    // NOTE: Wheel and drag are not taken while another control is in exclusive mode (i.e. open dropdown)
+    if ((GuiGetState() != STATE_DISABLED) && !GuiIsLocked() && !guiControlExclusiveMode)
+    {
+        // Zoom around mouse position, image point under mouse does not move
+        float wheel = GetMouseWheelMove();
+        if ((wheel != 0) && CheckCollisionPointRec(mouse, view))
+        {
+            float zoom = state->zoom*((wheel > 0)? 1.25f : 0.8f);
+            if (zoom < fitZoom/4) zoom = fitZoom/4;
+            if (zoom > GUI_IMAGE_VIEW_MAX_ZOOM) zoom = GUI_IMAGE_VIEW_MAX_ZOOM;
+
+            state->offset.x += (mouse.x - view.x)*(1.0f/state->zoom - 1.0f/zoom);
+            state->offset.y += (mouse.y - view.y)*(1.0f/state->zoom - 1.0f/zoom);
+            state->zoom = zoom;
+            result = 1;
+        }
+
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && CheckCollisionPointRec(mouse, view))
+        {
+            data->dragging = true;
+            data->dragMouse = mouse;
+        }
+
+        if (data->dragging && IsMouseButtonDown(MOUSE_LEFT_BUTTON))
+        {
+            if ((mouse.x != data->dragMouse.x) || (mouse.y != data->dragMouse.y))
+            {
+                state->offset.x -= (mouse.x - data->dragMouse.x)/state->zoom;
+                state->offset.y -= (mouse.y - data->dragMouse.y)/state->zoom;
+                data->dragMouse = mouse;
+                result = 1;
+            }
+        }
+        else data->dragging = false;
+    }
+
+    // Half the view can be outside the image
+    float viewWidth = view.width/state->zoom;
+    float viewHeight = view.height/state->zoom;
+    if (state->offset.x < -viewWidth/2) state->offset.x = -viewWidth/2;
+    if (state->offset.y < -viewHeight/2) state->offset.y = -viewHeight/2;
+    if (state->offset.x > state->width - viewWidth/2) state->offset.x = state->width - viewWidth/2;
+    if (state->offset.y > state->height - viewHeight/2) state->offset.y = state->height - viewHeight/2;
+
+    // Resident tiles capacity from budget, least recently drawn tiles are unloaded if budget was reduced
+    int capacity = state->budget/GUI_IMAGE_VIEW_TILE_BYTES;
+    if (capacity < 1) capacity = 1;
+
+    while (state->tileCount > capacity)
+    {
+        int oldest = 0;
+        for (int i = 1; i < state->tileCount; i++) if (data->tiles[i].lastUsed < data->tiles[oldest].lastUsed) oldest = i;
+
+        UnloadTexture(data->tiles[oldest].texture);
+        data->tiles[oldest] = data->tiles[--state->tileCount];
+    }
+
+    if (capacity > data->tileCapacity)
+    {
+        GuiImageViewTile *tiles = (GuiImageViewTile *)realloc(data->tiles, capacity*sizeof(GuiImageViewTile));
+
+        if (tiles != NULL)
+        {
+            data->tiles = tiles;
+            data->tileCapacity = capacity;
+        }
+    }
+
+    if (capacity > data->tileCapacity) capacity = data->tileCapacity;
+
+    data->frame++;
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawRectangle(bounds, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (GuiGetState() == STATE_DISABLED)? BORDER_COLOR_DISABLED : BORDER_COLOR_NORMAL)));
+    GuiDrawRectangle(view, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+    // Level in use, tiles are drawn scaled between 0.5 and 1 when level is generated
+    int level = (int)floorf(log2f(1.0f/state->zoom));
+    if (level < 0) level = 0;
+    if (level >= state->levelsReady) level = state->levelsReady - 1;
+
+    float levelScale = 1.0f;
+    float tileSpan = 0.0f;
+    int firstX = 0, firstY = 0, lastX = 0, lastY = 0;
+
+    // Level is too detailed for the budget: finest coarser ready level which visible tiles fit is used
+    for (;; level++)
+    {
+        levelScale = (float)(1 << level);
+        tileSpan = GUI_IMAGE_VIEW_TILE_SIZE*levelScale;         // Image pixels covered by a tile
+        int tileCountX = (data->levelWidths[level] + GUI_IMAGE_VIEW_TILE_SIZE - 1)/GUI_IMAGE_VIEW_TILE_SIZE;
+        int tileCountY = (data->levelHeights[level] + GUI_IMAGE_VIEW_TILE_SIZE - 1)/GUI_IMAGE_VIEW_TILE_SIZE;
+
+        firstX = (int)floorf(state->offset.x/tileSpan);
+        firstY = (int)floorf(state->offset.y/tileSpan);
+        lastX = (int)floorf((state->offset.x + viewWidth)/tileSpan);
+        lastY = (int)floorf((state->offset.y + viewHeight)/tileSpan);
+        if (firstX < 0) firstX = 0;
+        if (firstY < 0) firstY = 0;
+        if (lastX >= tileCountX) lastX = tileCountX - 1;
+        if (lastY >= tileCountY) lastY = tileCountY - 1;
+
+        if (((lastX - firstX + 1)*(lastY - firstY + 1) <= capacity) || (level >= state->levelsReady - 1)) break;
+    }
+
+    Color tint = GuiFade(WHITE, guiAlpha);
+    int uploads = 0;
+
+    GuiBeginScissor(view);
+
+    for (int y = firstY; y <= lastY; y++)
+    {
+        for (int x = firstX; x <= lastX; x++)
+        {
+            // Tile edges rounded to pixels, no gaps between tiles
+            float x0 = floorf(view.x + (x*tileSpan - state->offset.x)*state->zoom);
+            float y0 = floorf(view.y + (y*tileSpan - state->offset.y)*state->zoom);
+            float width = (float)data->levelWidths[level] - x*GUI_IMAGE_VIEW_TILE_SIZE;
+            float height = (float)data->levelHeights[level] - y*GUI_IMAGE_VIEW_TILE_SIZE;
+            if (width > GUI_IMAGE_VIEW_TILE_SIZE) width = GUI_IMAGE_VIEW_TILE_SIZE;
+            if (height > GUI_IMAGE_VIEW_TILE_SIZE) height = GUI_IMAGE_VIEW_TILE_SIZE;
+
+            Rectangle dest = { x0, y0, floorf(view.x + ((x*GUI_IMAGE_VIEW_TILE_SIZE + width)*levelScale - state->offset.x)*state->zoom) - x0,
+                floorf(view.y + ((y*GUI_IMAGE_VIEW_TILE_SIZE + height)*levelScale - state->offset.y)*state->zoom) - y0 };
+
+            GuiImageViewTile *tile = GetImageViewTile(state, level, x, y, &uploads);
+            Rectangle source = { 0, 0, width, height };
+
+            // Missing tile drawn from closest resident coarser level tile
+            for (int coarser = level + 1; (tile == NULL) && (coarser < state->levelsReady); coarser++)
+            {
+                int shift = coarser - level;
+                tile = GetImageViewTile(state, coarser, x >> shift, y >> shift, NULL);
+
+                float scale = 1.0f/(float)(1 << shift);
+                source = (Rectangle){ (x - ((x >> shift) << shift))*GUI_IMAGE_VIEW_TILE_SIZE*scale, (y - ((y >> shift) << shift))*GUI_IMAGE_VIEW_TILE_SIZE*scale, width*scale, height*scale };
+            }
+
+            if (tile != NULL) GuiDrawTexture(tile->texture, source, dest, tint);
+        }
+    }
+
+    GuiEndScissor();
+    //--------------------------------------------------------------------
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+#if !defined(GUI_IMAGE_VIEW_NO_THREADS)
+// Levels generation worker, generates all levels unless cancelled
+#if defined(_WIN32)
+static unsigned long __stdcall ImageViewWorker(void *data)
+#else
+static void *ImageViewWorker(void *data)
+#endif
+{
+    GuiImageViewData *viewData = (GuiImageViewData *)data;
+
+    while (!GUI_IMAGE_VIEW_LOAD(viewData->cancel) && !BuildImageViewLevels(viewData, GUI_IMAGE_VIEW_BUILD_ROWS)) { }
+
+    return 0;
+}
+#endif
+
+// Allocate pyramid levels down to a single tile and start levels generation
+// NOTE: On allocation failure view data is unloaded, returned state data is NULL
+static GuiImageViewState InitImageViewLevels(GuiImageViewData *data, unsigned char *pixels, int width, int height)
+{
+    GuiImageViewState state = { 0 };
+
+    state.width = width;
+    state.height = height;
+    state.budget = GUI_IMAGE_VIEW_BUDGET;
+    state.data = data;
+
+    data->levels[0] = pixels;
+    data->levelWidths[0] = width;
+    data->levelHeights[0] = height;
+    state.levelCount = 1;
+
+    while ((state.levelCount < GUI_IMAGE_VIEW_MAX_LEVELS) &&
+           ((data->levelWidths[state.levelCount - 1] > GUI_IMAGE_VIEW_TILE_SIZE) || (data->levelHeights[state.levelCount - 1] > GUI_IMAGE_VIEW_TILE_SIZE)))
+    {
+        int level = state.levelCount;
+        data->levelWidths[level] = (data->levelWidths[level - 1] + 1)/2;
+        data->levelHeights[level] = (data->levelHeights[level - 1] + 1)/2;
+        data->levels[level] = (unsigned char *)malloc((size_t)data->levelWidths[level]*data->levelHeights[level]*4);
+        state.levelCount++;
+
+        if (data->levels[level] == NULL) break;
+    }
+
+    data->staging = (unsigned char *)malloc(GUI_IMAGE_VIEW_TILE_BYTES);
+
+    // Levels not allocated, view is not loaded (file mapping released)
+    if ((data->levels[state.levelCount - 1] == NULL) || (data->staging == NULL))
+    {
+        UnloadGuiImageView(&state);
+        return state;
+    }
+    data->buildLevel = 1;
+    data->levelsReady = 1;
+    state.levelsReady = 1;
+
+#if !defined(GUI_IMAGE_VIEW_NO_THREADS)
+    #if defined(_WIN32)
+    data->thread = CreateThread(NULL, 0, ImageViewWorker, data, 0, NULL);
+    data->threadActive = (data->thread != NULL);
+    #else
+    data->threadActive = (pthread_create(&data->thread, NULL, ImageViewWorker, data) == 0);
+    #endif
+#endif
+
+    return state;
+}
+
+// Generate up to rows of level in progress from previous level, returns true when all levels are generated
+static bool BuildImageViewLevels(GuiImageViewData *data, int rows)
+{
+    int level = data->buildLevel;
+    if ((level >= GUI_IMAGE_VIEW_MAX_LEVELS) || (data->levels[level] == NULL)) return true;
+
+    int srcWidth = data->levelWidths[level - 1];
+    int srcHeight = data->levelHeights[level - 1];
+    int width = data->levelWidths[level];
+    int height = data->levelHeights[level];
+    const unsigned char *src = data->levels[level - 1];
+
+    for (int y = data->buildRow; (y < height) && (rows > 0); y++, rows--)
+    {
+        // Odd size last row and column are averaged with themselves
+        const unsigned char *row0 = src + (size_t)(2*y)*srcWidth*4;
+        const unsigned char *row1 = (2*y + 1 < srcHeight)? row0 + (size_t)srcWidth*4 : row0;
+
+        DownsampleImageRow(row0, row1, srcWidth, data->levels[level] + (size_t)y*width*4, width);
+        data->buildRow = y + 1;
+    }
+
+    if (data->buildRow < height) return false;
+
+    data->buildLevel++;
+    data->buildRow = 0;
+    GUI_IMAGE_VIEW_STORE(data->levelsReady, data->buildLevel);
+
+    return ((data->buildLevel >= GUI_IMAGE_VIEW_MAX_LEVELS) || (data->levels[data->buildLevel] == NULL));
+}
+
+// Downsample two image rows into one, 2x2 pixels box filter
+// NOTE: Averages are rounded up as SIMD averages: avg(avg(row0, row1) even, avg(row0, row1) odd)
+static void DownsampleImageRow(const unsigned char *row0, const unsigned char *row1, int srcWidth, unsigned char *dst, int dstWidth)
+{
+    int x = 0;
+
+#if defined(RAYGUI_SIMD_SSE2)
+    // 8 source pixels per step, even and odd pixels split after vertical average
+    for (; 2*x + 8 <= srcWidth; x += 4)
+    {
+        __m128i a = _mm_avg_epu8(_mm_loadu_si128((const __m128i *)(row0 + 8*x)), _mm_loadu_si128((const __m128i *)(row1 + 8*x)));
+        __m128i b = _mm_avg_epu8(_mm_loadu_si128((const __m128i *)(row0 + 8*x + 16)), _mm_loadu_si128((const __m128i *)(row1 + 8*x + 16)));
+        __m128i even = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128i odd = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(3, 1, 3, 1)));
+
+        _mm_storeu_si128((__m128i *)(dst + 4*x), _mm_avg_epu8(even, odd));
+    }
+#elif defined(RAYGUI_SIMD_NEON)
+    // 8 source pixels per step, even and odd pixels split on load
+    for (; 2*x + 8 <= srcWidth; x += 4)
+    {
+        uint32x4x2_t a = vld2q_u32((const uint32_t *)(row0 + 8*x));
+        uint32x4x2_t b = vld2q_u32((const uint32_t *)(row1 + 8*x));
+        uint8x16_t even = vrhaddq_u8(vreinterpretq_u8_u32(a.val[0]), vreinterpretq_u8_u32(b.val[0]));
+        uint8x16_t odd = vrhaddq_u8(vreinterpretq_u8_u32(a.val[1]), vreinterpretq_u8_u32(b.val[1]));
+
+        vst1q_u8(dst + 4*x, vrhaddq_u8(even, odd));
+    }
+#endif
+
+    for (; x < dstWidth; x++)
+    {
+        int x0 = 2*x*4;
+        int x1 = (2*x + 1 < srcWidth)? x0 + 4 : x0;
+
+        for (int c = 0; c < 4; c++)
+        {
+            int even = (row0[x0 + c] + row1[x0 + c] + 1) >> 1;
+            int odd = (row0[x1 + c] + row1[x1 + c] + 1) >> 1;
+            dst[4*x + c] = (unsigned char)((even + odd + 1) >> 1);
+        }
+    }
+}
+
+// Get resident tile, uploaded if required and allowed (uploads not NULL and below per frame limit)
+// NOTE: Least recently drawn tile is reused when budget is full, tiles drawn this frame are kept
+static GuiImageViewTile *GetImageViewTile(GuiImageViewState *state, int level, int x, int y, int *uploads)
+{
+    GuiImageViewData *data = state->data;
+    GuiImageViewTile *tile = NULL;
+
+    for (int i = 0; i < state->tileCount; i++)
+    {
+        if ((data->tiles[i].level == level) && (data->tiles[i].x == x) && (data->tiles[i].y == y)) { tile = &data->tiles[i]; break; }
+    }
+
+    if ((tile == NULL) && (uploads != NULL) && (*uploads < GUI_IMAGE_VIEW_UPLOADS))
+    {
+        // New tiles are bounded by budget and by allocated tiles (allocation can fail)
+        int capacity = state->budget/GUI_IMAGE_VIEW_TILE_BYTES;
+        if (capacity < 1) capacity = 1;
+        if (capacity > data->tileCapacity) capacity = data->tileCapacity;
+
+        if (state->tileCount < capacity)
+        {
+            tile = &data->tiles[state->tileCount++];
+            memset(tile, 0, sizeof(GuiImageViewTile));
+        }
+        else
+        {
+            for (int i = 0; i < state->tileCount; i++)
+            {
+                if ((data->tiles[i].lastUsed != data->frame) && ((tile == NULL) || (data->tiles[i].lastUsed < tile->lastUsed))) tile = &data->tiles[i];
+            }
+        }
+
+        if (tile != NULL)
+        {
+            // Copy tile pixels, edge tiles padded
+            int levelWidth = data->levelWidths[level];
+            int width = levelWidth - x*GUI_IMAGE_VIEW_TILE_SIZE;
+            int height = data->levelHeights[level] - y*GUI_IMAGE_VIEW_TILE_SIZE;
+            if (width > GUI_IMAGE_VIEW_TILE_SIZE) width = GUI_IMAGE_VIEW_TILE_SIZE;
+            if (height > GUI_IMAGE_VIEW_TILE_SIZE) height = GUI_IMAGE_VIEW_TILE_SIZE;
+
+            if ((width < GUI_IMAGE_VIEW_TILE_SIZE) || (height < GUI_IMAGE_VIEW_TILE_SIZE)) memset(data->staging, 0, GUI_IMAGE_VIEW_TILE_BYTES);
+
+            const unsigned char *src = data->levels[level] + ((size_t)y*GUI_IMAGE_VIEW_TILE_SIZE*levelWidth + (size_t)x*GUI_IMAGE_VIEW_TILE_SIZE)*4;
+            for (int row = 0; row < height; row++) memcpy(data->staging + row*GUI_IMAGE_VIEW_TILE_SIZE*4, src + (size_t)row*levelWidth*4, width*4);
+
+            if (tile->texture.id > 0) UpdateTexture(tile->texture, data->staging);
+            else
+            {
+                Image image = { data->staging, GUI_IMAGE_VIEW_TILE_SIZE, GUI_IMAGE_VIEW_TILE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+                tile->texture = LoadTextureFromImage(image);
+            }
+
+            tile->level = level;
+            tile->x = x;
+            tile->y = y;
+            (*uploads)++;
+        }
+    }
+
+    if (tile != NULL) tile->lastUsed = data->frame;
+
+    return tile;
+}
+
+#endif // GUI_IMAGE_VIEW_IMPLEMENTATION
@@ -0,0 +1,112 @@
+/*******************************************************************************************
+*
+*   raygui - tiled view of a very large image
+*
+*   DEPENDENCIES:
+*       raylib 5.0  - Windowing/input management and drawing.
+*       raygui 4.5  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   USAGE:
+*       image_view [file.raw width height]
+*       Raw files (R8G8B8A8, no header) are memory mapped, a 8192x8192 image is generated if no file provided
+*       Mouse drag to pan, mouse wheel to zoom
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+#define GUI_IMAGE_VIEW_IMPLEMENTATION
+#include "gui_image_view.h"
+
+#include <stdlib.h>                     // Required for: malloc(), free(), atoi()
+
+#define GENERATED_IMAGE_SIZE    8192    // Generated image width and height
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 960;
+    const int screenHeight = 600;
+
+    InitWindow(screenWidth, screenHeight, "raygui - image view");
+
+    Image image = { 0 };
+    GuiImageViewState state = { 0 };
+
+    if (argc > 3) state = LoadGuiImageViewRaw(argv[1], atoi(argv[2]), atoi(argv[3]));
+    else
+    {
+        // Generated image, checker and gradients pattern with details visible only at full size
+        image.width = GENERATED_IMAGE_SIZE;
+        image.height = GENERATED_IMAGE_SIZE;
+        image.mipmaps = 1;
+        image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image.data = malloc((size_t)image.width*image.height*4);
+
+        Color *pixels = (Color *)image.data;
+
+        for (int y = 0; y < image.height; y++)
+        {
+            for (int x = 0; x < image.width; x++)
+            {
+                unsigned char checker = (((x/512) + (y/512))%2)? 255 : 160;
+                unsigned char detail = ((x%16 == 0) || (y%16 == 0))? 0 : 255;
+
+                pixels[(size_t)y*image.width + x] = (Color){ (unsigned char)((x*255/image.width)&detail), (unsigned char)((y*255/image.height)&detail), (unsigned char)(checker&detail), 255 };
+            }
+        }
+
+        state = InitGuiImageView(image);
+    }
+
+    SetTargetFPS(60);
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            if (state.data != NULL)
+            {
+                GuiImageView((Rectangle){ 10, 10, (float)screenWidth - 20, (float)screenHeight - 44 }, &state);
+
+                GuiStatusBar((Rectangle){ 0, (float)screenHeight - 24, (float)screenWidth, 24 },
+                    TextFormat("%ix%i, zoom %.3f, levels %i/%i, resident tiles %i (%i MB)", state.width, state.height, state.zoom,
+                        state.levelsReady, state.levelCount, state.tileCount, state.tileCount/4));
+            }
+            else GuiLabel((Rectangle){ 10, 10, 600, 24 }, "Image could not be loaded (file not found or image levels allocation failed)");
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadGuiImageView(&state);
+    free(image.data);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
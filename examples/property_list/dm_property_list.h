@@ -207,7 +207,7 @@ double GuiDMValueBox(Rectangle bounds, double value, double minValue, double max
     }
     
     char textValue[maxChars + 1] = "\0"; 
-    snprintf(textValue, maxChars, "%.*f", precision, value); // NOTE: use `snprintf` here so we don't overflow the buffer
+    snprintf(textValue, maxChars, "%.*f", precision, value); // NOTE: value is a double, GuiFormatFloat() would narrow it to float precision
     int len = strlen(textValue);
     
     bool valueHasChanged = false;
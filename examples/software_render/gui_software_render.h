@@ -0,0 +1,576 @@
+/*******************************************************************************************
+*
+*   Software Render v1.0 - Gui draw stream software rendering into an RGBA pixels buffer
+*
+*   MODULE USAGE:
+*       #define GUI_SOFTWARE_RENDER_IMPLEMENTATION
+*       #include "gui_software_render.h"
+*
+*       INIT:   GuiSoftwareRenderer renderer = InitGuiSoftwareRenderer(pixels, width, height, fontAtlas);
+*       DRAW:   GuiBeginDrawStream(DRAW_STREAM_EXPORT_COMMANDS);
+*               // ...gui controls...
+*               GuiEndDrawStream();
+*               const GuiDrawCommand *commands = GuiGetDrawStream(&count);
+*               RenderGuiDrawStream(&renderer, commands, count);
+*       FREE:   UnloadGuiSoftwareRenderer(&renderer);
+*
+*   DESCRIPTION:
+*       Specialized kernels to render gui draw commands on CPU, into a caller provided
+*       R8G8B8A8 pixels buffer (i.e. a standalone backend framebuffer):
+*
+*         - Rectangles are filled by rows spans, opaque spans are stored directly
+*         - Icons are expanded from their bit per pixel rows straight into coverage spans
+*           (16 pixels per step with SIMD), at any icon scale, no rectangle per pixel or run
+*         - Glyphs coverage masks are generated from the font atlas image once per codepoint
+*           and size, and cached, then blended into the buffer
+*
+*       Coverage spans are alpha blended 4 pixels per step when raygui SIMD is available
+*       (SSE2/NEON), scalar code produces exactly the same results.
+*
+*       NOTE: Texture commands are not rendered (no GPU textures on CPU), so BORDER_RADIUS
+*       rounded corners, skins and color panel textures are not drawn, define
+*       RAYGUI_NO_COLOR_TEXTURES to get color panels drawn as gradients
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#ifndef GUI_SOFTWARE_RENDER_H
+#define GUI_SOFTWARE_RENDER_H
+
+typedef struct GuiGlyphMask GuiGlyphMask;           // Cached glyph coverage mask (internal)
+
+// Gui software renderer, target buffer and glyphs cache
+typedef struct {
+    unsigned char *pixels;      // Target pixels, R8G8B8A8 (not owned)
+    int width;                  // Target width
+    int height;                 // Target height
+    int stride;                 // Target bytes per row, by default width*4
+    Rectangle clip;             // Current clip rectangle, set by scissor commands
+
+    Image fontAtlas;            // Gui font atlas image (not owned), glyphs coverage source
+    int glyphCount;             // Cached glyphs coverage masks
+    GuiGlyphMask *glyphs;
+} GuiSoftwareRenderer;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiSoftwareRenderer InitGuiSoftwareRenderer(unsigned char *pixels, int width, int height, Image fontAtlas); // Init renderer for target buffer, font atlas is gui font texture image
+void UnloadGuiSoftwareRenderer(GuiSoftwareRenderer *renderer);
+void ClearGuiSoftwareGlyphs(GuiSoftwareRenderer *renderer);     // Clear glyphs cache, required when gui font changes
+
+void RenderGuiDrawStream(GuiSoftwareRenderer *renderer, const GuiDrawCommand *commands, int count); // Render draw commands (DRAW_STREAM_EXPORT_COMMANDS)
+void RenderGuiRectangle(GuiSoftwareRenderer *renderer, Rectangle rec, Color color);
+void RenderGuiGradient(GuiSoftwareRenderer *renderer, Rectangle rec, Color topLeft, Color bottomLeft, Color bottomRight, Color topRight);
+void RenderGuiIcon(GuiSoftwareRenderer *renderer, int iconId, Rectangle rec, Color color);     // Render icon of icons in use, icon size scaled to rec
+void RenderGuiGlyph(GuiSoftwareRenderer *renderer, Font font, int codepoint, Vector2 position, float fontSize, Color color);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_SOFTWARE_RENDER_H
+
+/***********************************************************************************
+*
+*   GUI_SOFTWARE_RENDER IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(GUI_SOFTWARE_RENDER_IMPLEMENTATION)
+
+#include "../../src/raygui.h"
+
+#include <stdlib.h>     // Required for: calloc(), malloc(), free()
+#include <string.h>     // Required for: memcpy(), memset()
+#include <math.h>       // Required for: floorf(), ceilf()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GUI_SOFTWARE_GLYPHS_CACHE       1024        // Glyphs coverage masks cache slots (power of 2), cleared when 3/4 full
+#define GUI_SOFTWARE_GLYPH_SAMPLES         4        // Glyph coverage samples per pixel side (atlas resampling)
+#define GUI_SOFTWARE_MAX_ICON_SIZE       256        // Icons size limit (pixels)
+#define GUI_SOFTWARE_SPAN_SIZE           512        // Coverage span pixels per blend call
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Glyph coverage mask, codepoint and size key
+struct GuiGlyphMask {
+    int codepoint;              // Glyph codepoint, -1 for empty slot
+    float fontSize;             // Glyph size
+    int width;                  // Mask width
+    int height;                 // Mask height
+    float offsetX;              // Mask position from glyph position (scaled offset and padding)
+    float offsetY;
+    unsigned char *coverage;
+};
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+static GuiGlyphMask *GetGlyphMask(GuiSoftwareRenderer *renderer, Font font, int codepoint, float fontSize);
+static void BlendSpan(unsigned char *dst, const unsigned char *coverage, int count, Color color);
+#if !defined(RAYGUI_NO_ICONS)
+static void ExpandIconRow(const unsigned int *icon, int bit, int count, unsigned char *row);
+#endif
+static bool GetClippedRec(const GuiSoftwareRenderer *renderer, Rectangle rec, int *x0, int *y0, int *x1, int *y1);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Init renderer for target buffer
+// NOTE: Font atlas is gui font texture image (i.e. LoadImageFromTexture(GuiGetFont().texture)),
+// supported formats: PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, GRAY_ALPHA and R8G8B8A8
+GuiSoftwareRenderer InitGuiSoftwareRenderer(unsigned char *pixels, int width, int height, Image fontAtlas)
+{
+    GuiSoftwareRenderer renderer = { 0 };
+
+    renderer.pixels = pixels;
+    renderer.width = width;
+    renderer.height = height;
+    renderer.stride = width*4;
+    renderer.clip = (Rectangle){ 0, 0, (float)width, (float)height };
+    renderer.fontAtlas = fontAtlas;
+    renderer.glyphs = (GuiGlyphMask *)calloc(GUI_SOFTWARE_GLYPHS_CACHE, sizeof(GuiGlyphMask));
+
+    for (int i = 0; i < GUI_SOFTWARE_GLYPHS_CACHE; i++) renderer.glyphs[i].codepoint = -1;
+
+    return renderer;
+}
+
+void UnloadGuiSoftwareRenderer(GuiSoftwareRenderer *renderer)
+{
+    if (renderer->glyphs != NULL)
+    {
+        ClearGuiSoftwareGlyphs(renderer);
+        free(renderer->glyphs);
+    }
+
+    GuiSoftwareRenderer empty = { 0 };
+    *renderer = empty;
+}
+
+// Clear glyphs coverage masks cache
+void ClearGuiSoftwareGlyphs(GuiSoftwareRenderer *renderer)
+{
+    if (renderer->glyphs == NULL) return;
+
+    for (int i = 0; i < GUI_SOFTWARE_GLYPHS_CACHE; i++)
+    {
+        free(renderer->glyphs[i].coverage);
+        renderer->glyphs[i].coverage = NULL;
+        renderer->glyphs[i].codepoint = -1;
+    }
+
+    renderer->glyphCount = 0;
+}
+
+// Render draw commands, clip is reset to target bounds
+// NOTE: Commands are expected in screen coordinates, as returned by GuiGetDrawStream()
+void RenderGuiDrawStream(GuiSoftwareRenderer *renderer, const GuiDrawCommand *commands, int count)
+{
+    Font font = GuiGetFont();
+    Rectangle bounds = { 0, 0, (float)renderer->width, (float)renderer->height };
+
+    renderer->clip = bounds;
+
+    for (int i = 0; i < count; i++)
+    {
+        const GuiDrawCommand *command = &commands[i];
+
+        switch (command->type)
+        {
+            case DRAW_COMMAND_RECTANGLE: RenderGuiRectangle(renderer, command->rec, command->colors[0]); break;
+            case DRAW_COMMAND_GRADIENT: RenderGuiGradient(renderer, command->rec, command->colors[0], command->colors[1], command->colors[2], command->colors[3]); break;
+            case DRAW_COMMAND_GLYPH: RenderGuiGlyph(renderer, font, command->codepoint, (Vector2){ command->rec.x, command->rec.y }, command->rec.height, command->colors[0]); break;
+            case DRAW_COMMAND_ICON: RenderGuiIcon(renderer, command->codepoint, command->rec, command->colors[0]); break;
+            case DRAW_COMMAND_SCISSOR_BEGIN: renderer->clip = command->rec; break;
+            case DRAW_COMMAND_SCISSOR_END: renderer->clip = bounds; break;
+            default: break;     // DRAW_COMMAND_TEXTURE not supported
+        }
+    }
+}
+
+// Render filled rectangle, alpha blended, rectangle truncated to pixels as DrawRectangle()
+void RenderGuiRectangle(GuiSoftwareRenderer *renderer, Rectangle rec, Color color)
+{
+    if (color.a == 0) return;
+
+    int x0, y0, x1, y1;
+    Rectangle pixelRec = { (float)((int)rec.x), (float)((int)rec.y), (float)((int)rec.width), (float)((int)rec.height) };
+    if (!GetClippedRec(renderer, pixelRec, &x0, &y0, &x1, &y1)) return;
+
+    for (int y = y0; y < y1; y++) BlendSpan(renderer->pixels + (size_t)y*renderer->stride + x0*4, NULL, x1 - x0, color);
+}
+
+// Render rectangle with corners colors gradient, bilinear colors interpolation
+void RenderGuiGradient(GuiSoftwareRenderer *renderer, Rectangle rec, Color topLeft, Color bottomLeft, Color bottomRight, Color topRight)
+{
+    int x0, y0, x1, y1;
+    if (!GetClippedRec(renderer, rec, &x0, &y0, &x1, &y1)) return;
+
+    for (int y = y0; y < y1; y++)
+    {
+        float v = (y + 0.5f - rec.y)/rec.height;
+        unsigned char *dst = renderer->pixels + (size_t)y*renderer->stride + x0*4;
+
+        for (int x = x0; x < x1; x++, dst += 4)
+        {
+            float u = (x + 0.5f - rec.x)/rec.width;
+            Color color = { 0 };
+
+            // Colors interpolated on left and right edges, then along the row
+            #define GRADIENT_CHANNEL(c) (unsigned char)(((topLeft.c + (bottomLeft.c - topLeft.c)*v)*(1.0f - u) + (topRight.c + (bottomRight.c - topRight.c)*v)*u) + 0.5f)
+            color.r = GRADIENT_CHANNEL(r);
+            color.g = GRADIENT_CHANNEL(g);
+            color.b = GRADIENT_CHANNEL(b);
+            color.a = GRADIENT_CHANNEL(a);
+            #undef GRADIENT_CHANNEL
+
+            if (color.a > 0) BlendSpan(dst, NULL, 1, color);
+        }
+    }
+}
+
+// Render icon of icons in use (GuiGetIcons()), icon is scaled to rec size
+// NOTE: Icon pixels edges are snapped to target pixels as GuiDrawIcon() rectangles runs,
+// every icon row is expanded to a coverage span once and blended into all its target rows
+void RenderGuiIcon(GuiSoftwareRenderer *renderer, int iconId, Rectangle rec, Color color)
+{
+#if !defined(RAYGUI_NO_ICONS)
+    int iconSize = GuiGetIconSize();
+    if ((iconId < 0) || (iconId >= GuiGetIconCount()) || (iconSize > GUI_SOFTWARE_MAX_ICON_SIZE) || (rec.width <= 0) || (color.a == 0)) return;
+
+    float pixelSize = rec.width/iconSize;
+    int columns[GUI_SOFTWARE_MAX_ICON_SIZE + 1];
+    int rows[GUI_SOFTWARE_MAX_ICON_SIZE + 1];
+
+    for (int i = 0; i <= iconSize; i++)
+    {
+        columns[i] = (int)floorf(rec.x + i*pixelSize + 0.5f);
+        rows[i] = (int)floorf(rec.y + i*pixelSize + 0.5f);
+    }
+
+    int x0, y0, x1, y1;
+    Rectangle pixelRec = { (float)columns[0], (float)rows[0], (float)(columns[iconSize] - columns[0]), (float)(rows[iconSize] - rows[0]) };
+    if (!GetClippedRec(renderer, pixelRec, &x0, &y0, &x1, &y1)) return;
+
+    // Icon pixels map to target pixels one to one, icon rows are blended as expanded
+    bool unscaled = (pixelSize == 1.0f);
+
+    const unsigned int *icon = GuiGetIcons() + (size_t)iconId*(iconSize*iconSize/32);
+    unsigned char row[GUI_SOFTWARE_MAX_ICON_SIZE + 16];
+    unsigned char span[GUI_SOFTWARE_SPAN_SIZE];
+
+    for (int iconY = 0; iconY < iconSize; iconY++)
+    {
+        int top = (rows[iconY] > y0)? rows[iconY] : y0;
+        int bottom = (rows[iconY + 1] < y1)? rows[iconY + 1] : y1;
+        if (top >= bottom) continue;
+
+        ExpandIconRow(icon, iconY*iconSize, iconSize, row);
+
+        bool empty = true;
+        for (int i = 0; (i < iconSize) && empty; i++) empty = (row[i] == 0);
+        if (empty) continue;
+
+        if (unscaled)
+        {
+            for (int y = top; y < bottom; y++) BlendSpan(renderer->pixels + (size_t)y*renderer->stride + x0*4, row + (x0 - columns[0]), x1 - x0, color);
+            continue;
+        }
+
+        int iconX = 0;
+
+        for (int x = x0; x < x1; x += GUI_SOFTWARE_SPAN_SIZE)
+        {
+            int count = ((x1 - x) < GUI_SOFTWARE_SPAN_SIZE)? x1 - x : GUI_SOFTWARE_SPAN_SIZE;
+
+            for (int i = 0; i < count; i++)
+            {
+                while ((iconX < iconSize - 1) && (columns[iconX + 1] <= x + i)) iconX++;
+                span[i] = row[iconX];
+            }
+
+            for (int y = top; y < bottom; y++) BlendSpan(renderer->pixels + (size_t)y*renderer->stride + x*4, span, count, color);
+        }
+    }
+#endif
+}
+
+// Render glyph from cached coverage mask, placed as DrawTextCodepoint()
+void RenderGuiGlyph(GuiSoftwareRenderer *renderer, Font font, int codepoint, Vector2 position, float fontSize, Color color)
+{
+    if ((color.a == 0) || (codepoint == ' ') || (codepoint == '\t')) return;
+
+    GuiGlyphMask *mask = GetGlyphMask(renderer, font, codepoint, fontSize);
+    if ((mask == NULL) || (mask->coverage == NULL)) return;
+
+    Rectangle maskRec = { floorf(position.x + mask->offsetX + 0.5f), floorf(position.y + mask->offsetY + 0.5f), (float)mask->width, (float)mask->height };
+
+    int x0, y0, x1, y1;
+    if (!GetClippedRec(renderer, maskRec, &x0, &y0, &x1, &y1)) return;
+
+    for (int y = y0; y < y1; y++)
+    {
+        const unsigned char *coverage = mask->coverage + (y - (int)maskRec.y)*mask->width + (x0 - (int)maskRec.x);
+        BlendSpan(renderer->pixels + (size_t)y*renderer->stride + x0*4, coverage, x1 - x0, color);
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get glyph coverage mask from cache, generated from font atlas if not cached
+// NOTE: Every mask pixel averages GUI_SOFTWARE_GLYPH_SAMPLES^2 atlas samples
+static GuiGlyphMask *GetGlyphMask(GuiSoftwareRenderer *renderer, Font font, int codepoint, float fontSize)
+{
+    if ((renderer->glyphs == NULL) || (font.baseSize <= 0) || (fontSize <= 0.0f)) return NULL;
+
+    unsigned int sizeBits = 0;
+    memcpy(&sizeBits, &fontSize, sizeof(float));
+    unsigned int hash = ((unsigned int)codepoint*2654435761u) ^ (sizeBits*2246822519u);
+    unsigned int slot = hash & (GUI_SOFTWARE_GLYPHS_CACHE - 1);
+
+    while (renderer->glyphs[slot].codepoint != -1)
+    {
+        if ((renderer->glyphs[slot].codepoint == codepoint) && (renderer->glyphs[slot].fontSize == fontSize)) return &renderer->glyphs[slot];
+        slot = (slot + 1) & (GUI_SOFTWARE_GLYPHS_CACHE - 1);
+    }
+
+    // Cache cleared when 3/4 full, open addressing probes stay short
+    if (renderer->glyphCount >= (GUI_SOFTWARE_GLYPHS_CACHE*3/4))
+    {
+        ClearGuiSoftwareGlyphs(renderer);
+        slot = hash & (GUI_SOFTWARE_GLYPHS_CACHE - 1);
+    }
+
+    GuiGlyphMask *mask = &renderer->glyphs[slot];
+    renderer->glyphCount++;
+
+    int index = GetGlyphIndex(font, codepoint);
+    float scaleFactor = fontSize/font.baseSize;
+    float padding = (float)font.glyphPadding;
+    Rectangle source = { font.recs[index].x - padding, font.recs[index].y - padding, font.recs[index].width + 2*padding, font.recs[index].height + 2*padding };
+
+    mask->codepoint = codepoint;
+    mask->fontSize = fontSize;
+    mask->offsetX = (font.glyphs[index].offsetX - padding)*scaleFactor;
+    mask->offsetY = (font.glyphs[index].offsetY - padding)*scaleFactor;
+    mask->width = (int)ceilf(source.width*scaleFactor);
+    mask->height = (int)ceilf(source.height*scaleFactor);
+    mask->coverage = NULL;
+
+    Image atlas = renderer->fontAtlas;
+    int bytesPerPixel = (atlas.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)? 1 : (atlas.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)? 2 : (atlas.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 0;
+
+    if ((atlas.data == NULL) || (bytesPerPixel == 0) || (mask->width <= 0) || (mask->height <= 0)) return mask;
+
+    // Coverage is alpha channel (or gray value for grayscale atlas)
+    const unsigned char *data = (const unsigned char *)atlas.data + (bytesPerPixel - 1);
+    mask->coverage = (unsigned char *)malloc((size_t)mask->width*mask->height);
+    float step = 1.0f/(scaleFactor*GUI_SOFTWARE_GLYPH_SAMPLES);
+
+    for (int y = 0; y < mask->height; y++)
+    {
+        for (int x = 0; x < mask->width; x++)
+        {
+            int sum = 0;
+
+            for (int sy = 0; sy < GUI_SOFTWARE_GLYPH_SAMPLES; sy++)
+            {
+                int atlasY = (int)(source.y + ((y*GUI_SOFTWARE_GLYPH_SAMPLES + sy) + 0.5f)*step);
+                if ((atlasY < 0) || (atlasY >= atlas.height) || (atlasY >= (int)(source.y + source.height))) continue;
+
+                for (int sx = 0; sx < GUI_SOFTWARE_GLYPH_SAMPLES; sx++)
+                {
+                    int atlasX = (int)(source.x + ((x*GUI_SOFTWARE_GLYPH_SAMPLES + sx) + 0.5f)*step);
+                    if ((atlasX < 0) || (atlasX >= atlas.width) || (atlasX >= (int)(source.x + source.width))) continue;
+
+                    sum += data[((size_t)atlasY*atlas.width + atlasX)*bytesPerPixel];
+                }
+            }
+
+            mask->coverage[y*mask->width + x] = (unsigned char)(sum/(GUI_SOFTWARE_GLYPH_SAMPLES*GUI_SOFTWARE_GLYPH_SAMPLES));
+        }
+    }
+
+    return mask;
+}
+
+// Blend color into target pixels span with coverage (NULL for full coverage)
+// NOTE: Exact rounded division by 255: (x + 128 + ((x + 128) >> 8)) >> 8, same results with SIMD and scalar code
+static void BlendSpan(unsigned char *dst, const unsigned char *coverage, int count, Color color)
+{
+    #define DIV255(x) ((((x) + 128) + (((x) + 128) >> 8)) >> 8)
+
+    int i = 0;
+
+    // Opaque full coverage, pixels stored
+    if ((coverage == NULL) && (color.a == 255))
+    {
+        unsigned char pixel[4] = { color.r, color.g, color.b, 255 };
+        for (; i < count; i++) memcpy(dst + i*4, pixel, 4);
+        return;
+    }
+
+#if defined(RAYGUI_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(255);
+    const __m128i half = _mm_set1_epi16(128);
+    const __m128i colorAlpha = _mm_set1_epi16(color.a);
+    const __m128i source = _mm_setr_epi16(color.r, color.g, color.b, 255, color.r, color.g, color.b, 255);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        unsigned int cover4 = 0xffffffff;
+        if (coverage != NULL) memcpy(&cover4, coverage + i, 4);
+        if (cover4 == 0) continue;
+
+        // Coverage bytes replicated for every channel: c0 c0 c0 c0 c1 c1 c1 c1 (16 bit lanes)
+        __m128i cover = _mm_cvtsi32_si128((int)cover4);
+        cover = _mm_unpacklo_epi8(cover, cover);
+        cover = _mm_unpacklo_epi16(cover, cover);
+
+        __m128i pixels = _mm_loadu_si128((const __m128i *)(dst + i*4));
+        __m128i result[2];
+
+        for (int k = 0; k < 2; k++)
+        {
+            __m128i alpha = (k == 0)? _mm_unpacklo_epi8(cover, zero) : _mm_unpackhi_epi8(cover, zero);
+            __m128i target = (k == 0)? _mm_unpacklo_epi8(pixels, zero) : _mm_unpackhi_epi8(pixels, zero);
+
+            alpha = _mm_add_epi16(_mm_mullo_epi16(alpha, colorAlpha), half);
+            alpha = _mm_srli_epi16(_mm_add_epi16(alpha, _mm_srli_epi16(alpha, 8)), 8);
+
+            __m128i value = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(source, alpha), _mm_mullo_epi16(target, _mm_sub_epi16(full, alpha))), half);
+            result[k] = _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + i*4), _mm_packus_epi16(result[0], result[1]));
+    }
+#elif defined(RAYGUI_SIMD_NEON)
+    static const unsigned char replicate[16] = { 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3 };
+    const uint8x16_t replicateIndex = vld1q_u8(replicate);
+    const uint16x8_t full = vdupq_n_u16(255);
+    const uint16x8_t half = vdupq_n_u16(128);
+    const uint16x8_t colorAlpha = vdupq_n_u16(color.a);
+    const uint16_t sourceValues[8] = { color.r, color.g, color.b, 255, color.r, color.g, color.b, 255 };
+    const uint16x8_t source = vld1q_u16(sourceValues);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        unsigned int cover4 = 0xffffffff;
+        if (coverage != NULL) memcpy(&cover4, coverage + i, 4);
+        if (cover4 == 0) continue;
+
+        uint8x16_t cover = vqtbl1q_u8(vreinterpretq_u8_u32(vdupq_n_u32(cover4)), replicateIndex);
+        uint8x16_t pixels = vld1q_u8(dst + i*4);
+        uint8x8_t result[2];
+
+        for (int k = 0; k < 2; k++)
+        {
+            uint16x8_t alpha = vmovl_u8((k == 0)? vget_low_u8(cover) : vget_high_u8(cover));
+            uint16x8_t target = vmovl_u8((k == 0)? vget_low_u8(pixels) : vget_high_u8(pixels));
+
+            alpha = vaddq_u16(vmulq_u16(alpha, colorAlpha), half);
+            alpha = vshrq_n_u16(vaddq_u16(alpha, vshrq_n_u16(alpha, 8)), 8);
+
+            uint16x8_t value = vaddq_u16(vaddq_u16(vmulq_u16(source, alpha), vmulq_u16(target, vsubq_u16(full, alpha))), half);
+            result[k] = vmovn_u16(vshrq_n_u16(vaddq_u16(value, vshrq_n_u16(value, 8)), 8));
+        }
+
+        vst1q_u8(dst + i*4, vcombine_u8(result[0], result[1]));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        int cover = (coverage != NULL)? coverage[i] : 255;
+        if (cover == 0) continue;
+
+        int alpha = DIV255(cover*color.a);
+        unsigned char *pixel = dst + i*4;
+
+        pixel[0] = (unsigned char)DIV255(color.r*alpha + pixel[0]*(255 - alpha));
+        pixel[1] = (unsigned char)DIV255(color.g*alpha + pixel[1]*(255 - alpha));
+        pixel[2] = (unsigned char)DIV255(color.b*alpha + pixel[2]*(255 - alpha));
+        pixel[3] = (unsigned char)DIV255(255*alpha + pixel[3]*(255 - alpha));
+    }
+
+    #undef DIV255
+}
+
+#if !defined(RAYGUI_NO_ICONS)
+// Expand icon bits (bit per pixel, first pixel in lowest bit) into coverage bytes, 0 or 255
+// NOTE: 16 pixels per step with SIMD, every byte tests its own bit of the broadcasted bits
+static void ExpandIconRow(const unsigned int *icon, int bit, int count, unsigned char *row)
+{
+    for (int x = 0; x < count; x += 16, bit += 16)
+    {
+        // Up to 16 bits from any bit offset, next word only read if required
+        unsigned int word = bit/32;
+        unsigned int shift = bit%32;
+        unsigned int bits = icon[word] >> shift;
+        int available = 32 - shift;
+        int required = ((count - x) < 16)? count - x : 16;
+        if (available < required) bits |= icon[word + 1] << available;
+        if (required < 16) bits &= (1u << required) - 1;
+
+#if defined(RAYGUI_SIMD_SSE2)
+        const __m128i select = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        __m128i value = _mm_unpacklo_epi64(_mm_set1_epi8((char)(bits & 0xff)), _mm_set1_epi8((char)((bits >> 8) & 0xff)));
+        _mm_storeu_si128((__m128i *)(row + x), _mm_cmpeq_epi8(_mm_and_si128(value, select), select));
+#elif defined(RAYGUI_SIMD_NEON)
+        static const unsigned char selectBits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        uint8x16_t value = vcombine_u8(vdup_n_u8((unsigned char)(bits & 0xff)), vdup_n_u8((unsigned char)((bits >> 8) & 0xff)));
+        vst1q_u8(row + x, vtstq_u8(value, vld1q_u8(selectBits)));
+#else
+        for (int i = 0; i < 16; i++) row[x + i] = (bits & (1u << i))? 255 : 0;
+#endif
+    }
+}
+#endif
+
+// Get rectangle clipped to target bounds and clip rectangle, false if empty
+static bool GetClippedRec(const GuiSoftwareRenderer *renderer, Rectangle rec, int *x0, int *y0, int *x1, int *y1)
+{
+    float left = (rec.x > renderer->clip.x)? rec.x : renderer->clip.x;
+    float top = (rec.y > renderer->clip.y)? rec.y : renderer->clip.y;
+    float right = ((rec.x + rec.width) < (renderer->clip.x + renderer->clip.width))? rec.x + rec.width : renderer->clip.x + renderer->clip.width;
+    float bottom = ((rec.y + rec.height) < (renderer->clip.y + renderer->clip.height))? rec.y + rec.height : renderer->clip.y + renderer->clip.height;
+
+    *x0 = (left < 0)? 0 : (int)ceilf(left - 0.5f);
+    *y0 = (top < 0)? 0 : (int)ceilf(top - 0.5f);
+    *x1 = (right > renderer->width)? renderer->width : (int)ceilf(right - 0.5f);
+    *y1 = (bottom > renderer->height)? renderer->height : (int)ceilf(bottom - 0.5f);
+
+    return ((*x1 > *x0) && (*y1 > *y0));
+}
+
+#endif // GUI_SOFTWARE_RENDER_IMPLEMENTATION
@@ -0,0 +1,122 @@
+/*******************************************************************************************
+*
+*   raygui - gui rendered by software into a pixels buffer
+*
+*   DEPENDENCIES:
+*       raylib 5.0  - Windowing/input management and drawing.
+*       raygui 4.5  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   USAGE:
+*       Gui draw commands are rendered into a CPU buffer, uploaded as a texture every frame
+*       Icons scale slider shows scaled icons blitting
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+#define GUI_SOFTWARE_RENDER_IMPLEMENTATION
+#include "gui_software_render.h"
+
+#include <stdlib.h>                     // Required for: malloc(), free()
+#include <string.h>                     // Required for: memset()
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raygui - software render");
+
+    // Target pixels buffer, uploaded to a texture to be displayed
+    Image target = GenImageColor(screenWidth, screenHeight, BLANK);
+    Texture2D texture = LoadTextureFromImage(target);
+
+    // Font atlas CPU copy, glyphs coverage source
+    Image fontAtlas = LoadImageFromTexture(GuiGetFont().texture);
+    GuiSoftwareRenderer renderer = InitGuiSoftwareRenderer((unsigned char *)target.data, target.width, target.height, fontAtlas);
+
+    float iconScale = 2.0f;
+    float sliderValue = 50.0f;
+    bool checked = true;
+    int toggle = 0;
+    float renderTime = 0.0f;
+
+    SetTargetFPS(60);
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        // Gui controls recorded as draw commands, input is processed as usual
+        GuiBeginDrawStream(DRAW_STREAM_EXPORT_COMMANDS);
+
+            GuiPanel((Rectangle){ 10, 10, (float)screenWidth - 20, (float)screenHeight - 44 }, "Software rendered gui");
+
+            GuiSlider((Rectangle){ 100, 50, 200, 20 }, "Icon scale", TextFormat("%i", (int)iconScale), &iconScale, 1, 8);
+            GuiSlider((Rectangle){ 100, 80, 200, 20 }, "Value", TextFormat("%i", (int)sliderValue), &sliderValue, 0, 100);
+            GuiCheckBox((Rectangle){ 100, 110, 20, 20 }, "Check box", &checked);
+            GuiToggleGroup((Rectangle){ 100, 140, 66, 24 }, "ONE;TWO;THREE", &toggle);
+            GuiButton((Rectangle){ 100, 174, 200, 30 }, "#191#Button with icon");
+
+            // Scaled icons, single draw commands expanded by the renderer
+            GuiSetIconScale((int)iconScale);
+            for (int i = 0; i < 8; i++) GuiLabel((Rectangle){ 340.0f + (i%4)*(16*iconScale + 8), 50.0f + (i/4)*(16*iconScale + 8), 16*iconScale, 16*iconScale }, GuiIconText(1 + i*8, NULL));
+            GuiSetIconScale(1);
+
+        GuiEndDrawStream();
+
+        int count = 0;
+        const GuiDrawCommand *commands = GuiGetDrawStream(&count);
+
+        double time = GetTime();
+        memset(target.data, 0, (size_t)target.width*target.height*4);
+        RenderGuiDrawStream(&renderer, commands, count);
+        renderTime = (float)(GetTime() - time)*1000.0f;
+
+        UpdateTexture(texture, target.data);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            DrawTexture(texture, 0, 0, WHITE);
+
+            GuiStatusBar((Rectangle){ 0, (float)screenHeight - 24, (float)screenWidth, 24 }, TextFormat("%i draw commands, rendered in %.3f ms", count, renderTime));
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadGuiSoftwareRenderer(&renderer);
+    UnloadImage(fontAtlas);
+    UnloadTexture(texture);
+    UnloadImage(target);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -102,6 +102,14 @@ static int GetKeyPressed(void)
     return 0;
 }
 
+// USED IN: GuiTextBox()
+static const char *GetClipboardText(void)
+{
+    // TODO: Return clipboard text, NULL if not available
+
+    return NULL;
+}
+
 //-------------------------------------------------------------------------------
 // Drawing required functions
 //-------------------------------------------------------------------------------
@@ -116,6 +124,36 @@ static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color
     // TODO: Draw rectangle with gradients (4 vertex colors) on the screen
 }
 
+// USED IN: GuiColorPanelHSV(), GuiColorBarHue(), GuiSetSkin() controls skin, BORDER_RADIUS rounded rectangles
+static void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    // TODO: Draw texture source rectangle into destination rectangle on the screen
+}
+
+// USED IN: GuiColorPanelHSV(), GuiColorBarHue()
+static void UpdateTexture(Texture2D texture, const void *pixels)
+{
+    // TODO: Update texture pixels data (RGBA, same size)
+}
+
+// USED IN: GuiColorPanelHSV(), GuiColorBarHue(), GuiLoadStyle()
+static void UnloadTexture(Texture2D texture)
+{
+    // TODO: Unload texture from GPU memory
+}
+
+// USED IN: GuiBeginScissor()
+static void BeginScissorMode(int x, int y, int width, int height)
+{
+    // TODO: Begin clipping drawing to screen rectangle
+}
+
+// USED IN: GuiEndScissor()
+static void EndScissorMode(void)
+{
+    // TODO: End clipping drawing
+}
+
 // USED IN: GuiDropdownBox(), GuiScrollBar()
 static void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 { 
@@ -0,0 +1,479 @@
+/*******************************************************************************************
+*
+*   String Table v1.0 - Localization string tables with precomputed metrics
+*
+*   MODULE USAGE:
+*       #define GUI_STRING_TABLE_IMPLEMENTATION
+*       #include "gui_string_table.h"
+*
+*       LOAD: GuiStringTable table = LoadGuiStringTable(fileName);       // Binary table, memory mapped
+*             GuiStringTable table = LoadGuiStringTableFromText(text);   // One string per line, copied
+*       USE:  GuiSetStringTable(&table);                                 // Active language, one table swap
+*             GuiButton(bounds, GuiGetString(STRING_OK));                // Controls get strings by id
+*             float width = GuiGetStringWidth(STRING_OK);                // Precomputed width, no measure
+*       SAVE: ExportGuiStringTable(table, fileName);
+*       FREE: UnloadGuiStringTable(&table);
+*
+*   DESCRIPTION:
+*       A string table keeps all the strings of one language, identified by index (id). Binary
+*       tables are memory mapped (mmap/CreateFileMapping) and used in place: the file contains
+*       an offsets index and NULL terminated strings, so loading does not parse or copy text.
+*
+*       Icon prefixes (#iconId#) are parsed once at load, with raygui GuiGetTextIconPrefix(), and
+*       the width of every string is computed in one pass for the font, text size and spacing in
+*       use; widths are computed again only when the font style changes or a table is set for the
+*       first time, so switching language is a pointer swap. String pointers are stable while the
+*       table is loaded, same pointer every frame.
+*
+*   NOTE: Precomputed widths are meant for user layout code (i.e. sizing a button to its text),
+*   raygui controls do not know about string ids and measure the strings they draw as usual,
+*   through raygui text measurement cache
+*
+*       Binary file format (little endian):
+*           char signature[4]       "rGST"
+*           int version             100
+*           int count               Strings count
+*           int dataSize            Strings data size in bytes
+*           int offsets[count]      String start offsets in data
+*           char data[dataSize]     UTF-8 strings, NULL terminated
+*
+*       Text format: one string per line (line number is the id), "\n" and "\\" escapes
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#ifndef GUI_STRING_TABLE_H
+#define GUI_STRING_TABLE_H
+
+typedef struct GuiStringTableData GuiStringTableData;   // Strings data, offsets index and metrics (internal)
+
+// Gui string table, strings of one language
+typedef struct {
+    int count;                  // Strings in table
+    GuiStringTableData *data;
+} GuiStringTable;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiStringTable LoadGuiStringTable(const char *fileName);           // Load binary string table, memory mapped
+GuiStringTable LoadGuiStringTableFromText(const char *text);       // Load string table from text, one string per line
+void UnloadGuiStringTable(GuiStringTable *table);                   // Unload string table (unset if active)
+bool ExportGuiStringTable(GuiStringTable table, const char *fileName); // Export string table as binary file
+
+void GuiSetStringTable(GuiStringTable *table);                      // Set active string table
+const char *GuiGetString(int id);                                   // Get active table string (with icon prefix), "" if not available
+const char *GuiGetStringText(int id);                               // Get active table string without icon prefix
+int GuiGetStringIcon(int id);                                       // Get active table string icon id, -1 if none
+float GuiGetStringWidth(int id);                                    // Get active table string width (including icon) for current font style
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_STRING_TABLE_H
+
+/***********************************************************************************
+*
+*   GUI_STRING_TABLE IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(GUI_STRING_TABLE_IMPLEMENTATION)
+
+#include "../../src/raygui.h"
+
+#include <stdio.h>      // Required for: FILE, fopen(), fwrite(), fclose()
+#include <stdlib.h>     // Required for: malloc(), calloc(), free()
+#include <string.h>     // Required for: memcmp(), memcpy(), strlen()
+
+#if defined(_WIN32)
+// NOTE: Required Win32 functions are declared manually to avoid windows.h conflicts with raylib
+#if defined(__cplusplus)
+extern "C" {
+#endif
+__declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *security, unsigned long creation, unsigned long flags, void *templateFile);
+__declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+__declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *security, unsigned long protect, unsigned long sizeHigh, unsigned long sizeLow, const char *name);
+__declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+__declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+#if defined(__cplusplus)
+}
+#endif
+#else
+    #include <fcntl.h>          // Required for: open()
+    #include <unistd.h>         // Required for: close()
+    #include <sys/mman.h>       // Required for: mmap(), munmap()
+    #include <sys/stat.h>       // Required for: fstat()
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GUI_STRING_TABLE_VERSION         100
+#define GUI_STRING_TABLE_HEADER_SIZE      16        // Signature, version, count and data size
+#define GUI_STRING_TABLE_ICON_PADDING      4        // Icon to text padding, as measured by raygui (ICON_TEXT_PADDING)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+struct GuiStringTableData {
+    // Strings data, mapped file or owned copy
+    const int *offsets;         // String start offsets in strings data
+    const char *strings;
+    int dataSize;
+    void *mapData;
+    long long mapSize;
+#if defined(_WIN32)
+    void *mapHandle;
+#endif
+    char *ownedData;            // Offsets and strings copy (text tables)
+
+    // Icon prefixes, parsed at load
+    int *icons;                 // Icon id of every string, -1 if none
+    unsigned char *textStarts;  // Text start after icon prefix
+
+    // Metrics for font style and icons size, computed for all strings at once
+    float *widths;
+    unsigned int fontId;        // Font texture id used for widths, 0 if not measured
+    int fontBaseSize;
+    float fontSize;
+    float spacing;
+    int iconSize;               // Icons size used for widths (icons set in use)
+};
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static GuiStringTable *guiStringTable = NULL;   // Active string table
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void SetupStringTableData(GuiStringTable *table);
+static void MeasureStringTable(GuiStringTableData *data, int count);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load binary string table, memory mapped (strings are used in place)
+GuiStringTable LoadGuiStringTable(const char *fileName)
+{
+    GuiStringTable table = { 0 };
+    GuiStringTableData *data = (GuiStringTableData *)calloc(1, sizeof(GuiStringTableData));
+    long long size = 0;
+
+#if defined(_WIN32)
+    // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);
+    if (file == (void *)(long long)-1) { free(data); return table; }
+
+    GetFileSizeEx(file, &size);
+
+    if (size >= GUI_STRING_TABLE_HEADER_SIZE)
+    {
+        // PAGE_READONLY, FILE_MAP_READ
+        data->mapHandle = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL);
+        if (data->mapHandle != NULL) data->mapData = MapViewOfFile(data->mapHandle, 0x0004, 0, 0, 0);
+        if ((data->mapData == NULL) && (data->mapHandle != NULL)) CloseHandle(data->mapHandle);
+    }
+
+    CloseHandle(file);      // Mapping keeps a reference to the file
+#else
+    int file = open(fileName, O_RDONLY);
+    if (file < 0) { free(data); return table; }
+
+    struct stat info = { 0 };
+    if (fstat(file, &info) == 0) size = (long long)info.st_size;
+
+    if (size >= GUI_STRING_TABLE_HEADER_SIZE)
+    {
+        data->mapData = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data->mapData == MAP_FAILED) data->mapData = NULL;
+    }
+
+    close(file);            // Mapping keeps a reference to the file
+#endif
+
+    if (data->mapData == NULL) { free(data); return table; }
+
+    data->mapSize = size;
+    table.data = data;
+
+    // Check header and offsets index, every offset must point inside strings data
+    const int *header = (const int *)data->mapData;
+    int count = header[2];
+    int dataSize = header[3];
+    bool valid = (memcmp(data->mapData, "rGST", 4) == 0) && (header[1] == GUI_STRING_TABLE_VERSION) && (count >= 0) && (dataSize >= 0) &&
+                 ((long long)GUI_STRING_TABLE_HEADER_SIZE + (long long)count*4 + dataSize <= size);
+
+    if (valid)
+    {
+        data->offsets = header + 4;
+        data->strings = (const char *)(data->offsets + count);
+        data->dataSize = dataSize;
+        table.count = count;
+
+        for (int i = 0; (i < count) && valid; i++) valid = (data->offsets[i] >= 0) && (data->offsets[i] < dataSize);
+        if (valid && (dataSize > 0)) valid = (data->strings[dataSize - 1] == '\0');
+    }
+
+    if (!valid)
+    {
+        UnloadGuiStringTable(&table);
+        return table;
+    }
+
+    SetupStringTableData(&table);
+
+    return table;
+}
+
+// Load string table from text, one string per line
+// NOTE: Line number is the string id, "\n" and "\\" escapes are supported
+GuiStringTable LoadGuiStringTableFromText(const char *text)
+{
+    GuiStringTable table = { 0 };
+    if (text == NULL) return table;
+
+    int textSize = (int)strlen(text);
+    int count = (textSize > 0)? 1 : 0;
+    for (int i = 0; i < textSize; i++) if (text[i] == '\n') count++;
+    if ((textSize > 0) && (text[textSize - 1] == '\n')) count--;     // Last line break does not start a string
+
+    // Offsets index and strings in a single allocation, escapes only shrink text
+    GuiStringTableData *data = (GuiStringTableData *)calloc(1, sizeof(GuiStringTableData));
+    data->ownedData = (char *)malloc(count*sizeof(int) + textSize + 1);
+
+    int *offsets = (int *)data->ownedData;
+    char *strings = data->ownedData + count*sizeof(int);
+    int size = 0;
+
+    for (int i = 0, id = 0; id < count; i++)
+    {
+        if (i == 0 || text[i - 1] == '\n') offsets[id] = size;
+
+        if ((i >= textSize) || (text[i] == '\n'))
+        {
+            if ((size > offsets[id]) && (strings[size - 1] == '\r')) size--;
+            strings[size++] = '\0';
+            id++;
+        }
+        else if ((text[i] == '\\') && (i + 1 < textSize) && ((text[i + 1] == 'n') || (text[i + 1] == '\\')))
+        {
+            strings[size++] = (text[i + 1] == 'n')? '\n' : '\\';
+            i++;
+        }
+        else strings[size++] = text[i];
+    }
+
+    data->offsets = offsets;
+    data->strings = strings;
+    data->dataSize = size;
+    table.count = count;
+    table.data = data;
+
+    SetupStringTableData(&table);
+
+    return table;
+}
+
+// Unload string table (unset if active)
+void UnloadGuiStringTable(GuiStringTable *table)
+{
+    if (guiStringTable == table) guiStringTable = NULL;
+
+    GuiStringTableData *data = table->data;
+
+    if (data != NULL)
+    {
+        if (data->mapData != NULL)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(data->mapData);
+            CloseHandle(data->mapHandle);
+#else
+            munmap(data->mapData, (size_t)data->mapSize);
+#endif
+        }
+
+        free(data->ownedData);
+        free(data->icons);
+        free(data->textStarts);
+        free(data->widths);
+        free(data);
+    }
+
+    table->count = 0;
+    table->data = NULL;
+}
+
+// Export string table as binary file, it can be loaded memory mapped
+bool ExportGuiStringTable(GuiStringTable table, const char *fileName)
+{
+    if (table.data == NULL) return false;
+
+    FILE *file = fopen(fileName, "wb");
+    if (file == NULL) return false;
+
+    int header[4] = { 0, GUI_STRING_TABLE_VERSION, table.count, table.data->dataSize };
+    memcpy(header, "rGST", 4);
+
+    bool success = (fwrite(header, sizeof(int), 4, file) == 4) &&
+                   (fwrite(table.data->offsets, sizeof(int), table.count, file) == (size_t)table.count) &&
+                   (fwrite(table.data->strings, 1, table.data->dataSize, file) == (size_t)table.data->dataSize);
+
+    fclose(file);
+
+    return success;
+}
+
+// Set active string table, switching language is a table swap
+void GuiSetStringTable(GuiStringTable *table)
+{
+    guiStringTable = ((table != NULL) && (table->data != NULL))? table : NULL;
+}
+
+// Get active table string (with icon prefix), "" if not available
+// NOTE: Returned pointer is the same every frame while table is loaded
+const char *GuiGetString(int id)
+{
+    if ((guiStringTable == NULL) || (id < 0) || (id >= guiStringTable->count)) return "";
+
+    return guiStringTable->data->strings + guiStringTable->data->offsets[id];
+}
+
+// Get active table string without icon prefix
+const char *GuiGetStringText(int id)
+{
+    if ((guiStringTable == NULL) || (id < 0) || (id >= guiStringTable->count)) return "";
+
+    return guiStringTable->data->strings + guiStringTable->data->offsets[id] + guiStringTable->data->textStarts[id];
+}
+
+// Get active table string icon id, -1 if none
+int GuiGetStringIcon(int id)
+{
+    if ((guiStringTable == NULL) || (id < 0) || (id >= guiStringTable->count)) return -1;
+
+    return guiStringTable->data->icons[id];
+}
+
+// Get active table string width (including icon) for current font style
+// NOTE: Width matches raygui measure, all table strings are measured again on font style change
+float GuiGetStringWidth(int id)
+{
+    if ((guiStringTable == NULL) || (id < 0) || (id >= guiStringTable->count)) return 0.0f;
+
+    GuiStringTableData *data = guiStringTable->data;
+    float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);    // NOTE: GuiGetStyle() initializes gui font if required
+    float spacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    Font font = GuiGetFont();
+
+    if ((data->fontId != font.texture.id) || (data->fontBaseSize != font.baseSize) ||
+        (data->fontSize != fontSize) || (data->spacing != spacing) || (data->iconSize != GuiGetIconSize())) MeasureStringTable(data, guiStringTable->count);
+
+    return data->widths[id];
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+// Parse icon prefixes of all strings and allocate metrics
+static void SetupStringTableData(GuiStringTable *table)
+{
+    GuiStringTableData *data = table->data;
+    int count = (table->count > 0)? table->count : 1;
+
+    data->icons = (int *)malloc(count*sizeof(int));
+    data->textStarts = (unsigned char *)malloc(count);
+    data->widths = (float *)calloc(count, sizeof(float));
+
+    for (int id = 0; id < table->count; id++)
+    {
+        const char *text = data->strings + data->offsets[id];
+
+        // Icon prefix: #iconId#, parsed by raygui (up to 5 digits)
+        data->icons[id] = -1;
+        data->textStarts[id] = (unsigned char)GuiGetTextIconPrefix(text, &data->icons[id]);
+    }
+}
+
+// Measure all strings for current font style, in one pass
+static void MeasureStringTable(GuiStringTableData *data, int count)
+{
+    Font font = GuiGetFont();
+    float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    float spacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    float scaleFactor = fontSize/(float)font.baseSize;
+
+    // ASCII glyph advances looked up once for all strings
+    float advance[128] = { 0 };
+    for (int c = 0; c < 128; c++)
+    {
+        int glyph = GetGlyphIndex(font, c);
+        advance[c] = ((font.glyphs[glyph].advanceX != 0)? (float)font.glyphs[glyph].advanceX : font.recs[glyph].width)*scaleFactor + spacing;
+    }
+
+    for (int id = 0; id < count; id++)
+    {
+        const char *text = data->strings + data->offsets[id];
+        float width = 0.0f;
+
+        // NOTE: Same as raygui GetTextWidth(), measure starts at icon prefix closing '#'
+        // and ends at end of text or line break
+        if (data->icons[id] >= 0) text += (data->textStarts[id] - 1);
+
+        for (int i = 0; (text[i] != '\0') && (text[i] != '\n');)
+        {
+            if ((unsigned char)text[i] < 128)
+            {
+                width += advance[(unsigned char)text[i]];
+                i++;
+            }
+            else
+            {
+                int codepointSize = 0;
+                int glyph = GetGlyphIndex(font, GetCodepointNext(text + i, &codepointSize));
+                width += ((font.glyphs[glyph].advanceX != 0)? (float)font.glyphs[glyph].advanceX : font.recs[glyph].width)*scaleFactor + spacing;
+                i += codepointSize;
+            }
+        }
+
+        if (data->icons[id] >= 0) width += (float)(GuiGetIconSize() + GUI_STRING_TABLE_ICON_PADDING);
+
+        data->widths[id] = (float)((int)width);
+    }
+
+    data->fontId = font.texture.id;
+    data->fontBaseSize = font.baseSize;
+    data->fontSize = fontSize;
+    data->spacing = spacing;
+    data->iconSize = GuiGetIconSize();
+}
+
+#endif // GUI_STRING_TABLE_IMPLEMENTATION
@@ -0,0 +1,156 @@
+/*******************************************************************************************
+*
+*   raygui - localization string tables
+*
+*   DEPENDENCIES:
+*       raylib 5.0  - Windowing/input management and drawing.
+*       raygui 4.5  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   USAGE:
+*       Select a language to swap the active string table, buttons are sized from precomputed widths
+*       Pass a binary string table (.gst) as first argument to add it as custom language
+*       Press E to export the english table as binary file (strings.gst)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+#define GUI_STRING_TABLE_IMPLEMENTATION
+#include "gui_string_table.h"
+
+// Strings ids, line number in string table text
+typedef enum {
+    STRING_TITLE = 0,
+    STRING_OPEN,
+    STRING_SAVE,
+    STRING_SETTINGS,
+    STRING_EXIT,
+    STRING_VOLUME,
+    STRING_FULLSCREEN,
+    STRING_STATUS,
+} StringId;
+
+static const char *stringsEnglish =
+    "Localization sample\n"
+    "#5#Open file\n"
+    "#6#Save\n"
+    "#142#Settings\n"
+    "#159#Exit\n"
+    "Volume\n"
+    "Fullscreen\n"
+    "Active language: English\n";
+
+static const char *stringsSpanish =
+    "Ejemplo de localización\n"
+    "#5#Abrir archivo\n"
+    "#6#Guardar\n"
+    "#142#Configuración\n"
+    "#159#Salir\n"
+    "Volumen\n"
+    "Pantalla completa\n"
+    "Idioma activo: Español\n";
+
+static const char *stringsFrench =
+    "Exemple de localisation\n"
+    "#5#Ouvrir un fichier\n"
+    "#6#Enregistrer\n"
+    "#142#Paramètres\n"
+    "#159#Quitter\n"
+    "Volume\n"
+    "Plein écran\n"
+    "Langue active : Français\n";
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 640;
+    const int screenHeight = 400;
+
+    InitWindow(screenWidth, screenHeight, "raygui - string table");
+
+    // NOTE: Default font only contains ASCII and Latin-1 glyphs, enough for these languages
+    GuiStringTable tables[4] = {
+        LoadGuiStringTableFromText(stringsEnglish),
+        LoadGuiStringTableFromText(stringsSpanish),
+        LoadGuiStringTableFromText(stringsFrench),
+        { 0 }
+    };
+
+    int tableCount = 3;
+    if (argc > 1)
+    {
+        tables[3] = LoadGuiStringTable(argv[1]);     // Memory mapped, strings used in place
+        if (tables[3].count > 0) tableCount = 4;
+    }
+
+    int language = 0;
+    GuiSetStringTable(&tables[language]);
+
+    float volume = 50.0f;
+    bool fullscreen = false;
+
+    SetTargetFPS(60);
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_E)) ExportGuiStringTable(tables[0], "strings.gst");
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            int previousLanguage = language;
+            GuiToggleGroup((Rectangle){ 20, 20, 100, 24 }, (tableCount > 3)? "English;Español;Français;Custom" : "English;Español;Français", &language);
+            if (language != previousLanguage) GuiSetStringTable(&tables[language]);     // Language switch is a table swap
+
+            GuiGroupBox((Rectangle){ 20, 70, (float)screenWidth - 40, 260 }, GuiGetString(STRING_TITLE));
+
+            // Buttons sized to fit text, widths are not measured every frame
+            float x = 40;
+            for (int id = STRING_OPEN; id <= STRING_EXIT; id++)
+            {
+                float width = GuiGetStringWidth(id) + 2*GuiGetStyle(BUTTON, TEXT_PADDING) + 16;
+                GuiButton((Rectangle){ x, 100, width, 30 }, GuiGetString(id));
+                x += width + 10;
+            }
+
+            GuiSlider((Rectangle){ 40 + GuiGetStringWidth(STRING_VOLUME) + 8, 160, 200, 20 }, GuiGetString(STRING_VOLUME), NULL, &volume, 0, 100);
+            GuiCheckBox((Rectangle){ 40, 200, 20, 20 }, GuiGetString(STRING_FULLSCREEN), &fullscreen);
+
+            GuiStatusBar((Rectangle){ 0, (float)screenHeight - 30, (float)screenWidth, 30 }, GuiGetString(STRING_STATUS));
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < tableCount; i++) UnloadGuiStringTable(&tables[i]);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
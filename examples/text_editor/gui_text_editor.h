@@ -0,0 +1,1159 @@
+/*******************************************************************************************
+*
+*   Text Editor v1.1 - Editable multiline text control for large documents
+*
+*   MODULE USAGE:
+*       #define GUI_TEXT_EDITOR_IMPLEMENTATION
+*       #include "gui_text_editor.h"
+*
+*       INIT: GuiTextEditorState state = InitGuiTextEditor(text);
+*       DRAW: if (GuiTextEditor(bounds, &state, editMode)) editMode = !editMode;
+*       TEXT: const char *text = GuiTextEditorGetText(&state);
+*       CODE: GuiTextEditorSetTokenizer(&state, Tokenizer, userData);     // Optional syntax highlight
+*       FREE: UnloadGuiTextEditor(&state);
+*
+*   DESCRIPTION:
+*       Text is stored in a gap buffer, so typing at the cursor is O(1) amortized.
+*
+*       Line starts and wrapped row starts are kept in two monotone arrays sharing a gap
+*       placed after the last edited line: entries before the gap store absolute values and
+*       entries after the gap store values relative to the document end (text length and
+*       total rows), so an edit never shifts the lines after it, only the moved gap entries
+*       are converted. Offset to line and visual row to line lookups are binary searches.
+*
+*       After an edit only the touched lines are measured again; full measure happens when
+*       the wrap width or the font changes. Drawing, mouse picking and cursor movement only
+*       measure the visible (or target) lines: O(log n + visible).
+*
+*       Syntax highlight uses a pluggable line tokenizer: it classifies every byte of one line
+*       in a token class (drawn with tokenColors[class]) and returns the lexer state at the
+*       line end (i.e. inside a block comment). Lexer state at every line start is kept in the
+*       line index; after an edit lines are tokenized again from the edited line only until the
+*       computed state matches the stored one (converges), and only as far as lines are drawn.
+*       Colored runs of drawn lines are cached, so typing usually tokenizes one or two lines.
+*
+*       Control is drawn with raygui draw functions (gui alpha, state, transform and draw stream
+*       apply), so raygui implementation must be included before in the same translation unit.
+*
+*   CONTROLS:
+*       Arrows, HOME/END, PAGE_UP/PAGE_DOWN, CTRL+HOME/END     - Move cursor (SHIFT selects)
+*       CTRL+A, CTRL+C, CTRL+X, CTRL+V                         - Select all, copy, cut, paste
+*       Mouse click and drag                                   - Place cursor and select
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#ifndef GUI_TEXT_EDITOR_H
+#define GUI_TEXT_EDITOR_H
+
+#if !defined(GUI_TEXT_EDITOR_MAX_TOKEN_COLORS)
+    #define GUI_TEXT_EDITOR_MAX_TOKEN_COLORS    16      // Token classes available for syntax highlight
+#endif
+
+// Line tokenizer for syntax highlight
+// NOTE: Writes a token class per text byte (line break not included) and returns
+// lexer state at line end, lexState is the state at line start (0 for first line)
+typedef int (*GuiTextEditorTokenizer)(const char *text, int length, int lexState, unsigned char *tokens, void *userData);
+
+typedef struct GuiTextEditorHighlight GuiTextEditorHighlight;   // Tokenizer, lexer progress and runs cache (internal)
+
+// Gui text editor context data
+typedef struct {
+
+    // Gap buffer, text is [0, gapStart) + [gapEnd, capacity)
+    char *buffer;
+    int capacity;
+    int gapStart;
+    int gapEnd;
+    int length;                 // Text length in bytes
+
+    // Line and visual row index, sharing a gap (see module description)
+    int *lineStarts;            // Byte offset where every line starts
+    int *rowStarts;             // Visual row where every line starts
+    int *lexStates;             // Lexer state at every line start (syntax highlight)
+    int indexCapacity;
+    int indexGapStart;
+    int indexGapEnd;
+    int lineCount;              // Lines in text (at least 1)
+    int rowCount;               // Visual rows in text (equals lineCount if not wrapped)
+
+    // Measure data
+    bool wrapText;              // Wrap lines to the view width
+    float wrapWidth;            // Width used to measure rows, 0 if not wrapped
+    unsigned int fontId;
+    float fontSize;
+    float spacing;
+    float advance[128];         // ASCII glyph advances (including spacing)
+    int *breaks;                // Row breaks scratch of last measured line
+    int breaksCapacity;
+    float maxLineWidth;         // Widest line drawn (no wrap mode content width)
+
+    // Edit state
+    int cursor;                 // Cursor byte offset
+    int selectionAnchor;        // Selection other end, equal to cursor if no selection
+    float preferredX;           // Cursor x kept when moving up/down, -1 to recompute
+    bool selecting;             // Mouse drag selection active
+    bool textChanged;           // Text modified (set on every edit, reset by user)
+    Vector2 scroll;
+
+    // Syntax highlight
+    Color tokenColors[GUI_TEXT_EDITOR_MAX_TOKEN_COLORS];    // Color of every token class, alpha 0 uses text color
+    GuiTextEditorHighlight *highlight;
+
+} GuiTextEditorState;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiTextEditorState InitGuiTextEditor(const char *text);
+void UnloadGuiTextEditor(GuiTextEditorState *state);
+
+int GuiTextEditor(Rectangle bounds, GuiTextEditorState *state, bool editMode);
+
+void GuiTextEditorSetText(GuiTextEditorState *state, const char *text);
+const char *GuiTextEditorGetText(GuiTextEditorState *state);        // Get text, NULL terminated (valid until next edit)
+void GuiTextEditorInsert(GuiTextEditorState *state, int position, const char *text, int length);
+void GuiTextEditorDelete(GuiTextEditorState *state, int position, int length);
+int GuiTextEditorGetLine(GuiTextEditorState *state, int position);  // Get line containing byte position
+int GuiTextEditorGetLineStart(GuiTextEditorState *state, int line); // Get byte position where line starts
+void GuiTextEditorSetTokenizer(GuiTextEditorState *state, GuiTextEditorTokenizer tokenizer, void *userData); // Set syntax highlight tokenizer (NULL to remove)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_TEXT_EDITOR_H
+
+/***********************************************************************************
+*
+*   GUI_TEXT_EDITOR IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(GUI_TEXT_EDITOR_IMPLEMENTATION)
+
+#include "../../src/raygui.h"
+
+#include <stdlib.h>     // Required for: malloc(), realloc(), free()
+#include <string.h>     // Required for: memmove(), memcpy(), memchr(), strlen()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GUI_TEXT_EDITOR_MIN_GAP          256        // Minimum gap buffer growth in bytes
+#define GUI_TEXT_EDITOR_TAB_SIZE           4        // Tab width in spaces
+#define GUI_TEXT_EDITOR_RUNS_CACHE       256        // Lines with colored runs cached (direct mapped)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Colored run, extends until next run start
+typedef struct {
+    int start;                  // Byte offset in line
+    int token;                  // Token class
+} GuiTextEditorRun;
+
+// Colored runs of one line
+typedef struct {
+    int line;                   // Line cached, -1 if entry is empty
+    int count;
+    int capacity;
+    GuiTextEditorRun *runs;
+} GuiTextEditorLineRuns;
+
+struct GuiTextEditorHighlight {
+    GuiTextEditorTokenizer tokenizer;
+    void *userData;
+    int validLines;             // Lines with an up to date lexer state at start
+    int lexedLines;             // Lines with a computed lexer state at start, maybe outdated by edits
+    int editedLine;             // Last edited line, lexer states can only converge after it
+    unsigned char *tokens;      // Tokens scratch
+    int tokensCapacity;
+    GuiTextEditorLineRuns cache[GUI_TEXT_EDITOR_RUNS_CACHE];
+};
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void MoveEditorGap(GuiTextEditorState *state, int position, int required);
+static void MoveEditorIndexGap(GuiTextEditorState *state, int line, int required);
+static int GetEditorRowStart(GuiTextEditorState *state, int line);
+static int GetEditorLineFromRow(GuiTextEditorState *state, int row);
+static const char *GetEditorLineText(GuiTextEditorState *state, int line, int *length);
+static float GetEditorGlyphAdvance(GuiTextEditorState *state, const char *text, int length, int index, int *codepoint, int *size);
+static int MeasureEditorLine(GuiTextEditorState *state, int line);
+static void MeasureEditorRows(GuiTextEditorState *state);
+static void GetEditorCursorPosition(GuiTextEditorState *state, int position, int *row, float *x);
+static int GetEditorPositionFromRow(GuiTextEditorState *state, int row, float x);
+static int *GetEditorLexState(GuiTextEditorState *state, int line);
+static void InvalidateEditorHighlight(GuiTextEditorState *state, int line, int lastLine, int newLines);
+static int TokenizeEditorLine(GuiTextEditorState *state, int line);
+static GuiTextEditorLineRuns *GetEditorLineRuns(GuiTextEditorState *state, int line);
+static int GetEditorValidText(const char *text, int length, char *valid);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+GuiTextEditorState InitGuiTextEditor(const char *text)
+{
+    GuiTextEditorState state = { 0 };
+
+    state.indexCapacity = 64;
+    state.lineStarts = (int *)malloc(state.indexCapacity*sizeof(int));
+    state.rowStarts = (int *)malloc(state.indexCapacity*sizeof(int));
+    state.lexStates = (int *)malloc(state.indexCapacity*sizeof(int));
+    state.lineStarts[0] = 0;
+    state.rowStarts[0] = 0;
+    state.lexStates[0] = 0;
+    state.indexGapStart = 1;
+    state.indexGapEnd = state.indexCapacity;
+    state.lineCount = 1;
+    state.rowCount = 1;
+    state.preferredX = -1;
+
+    if (text != NULL) GuiTextEditorInsert(&state, 0, text, (int)strlen(text));
+
+    state.cursor = 0;
+    state.selectionAnchor = 0;
+    state.textChanged = false;
+
+    return state;
+}
+
+void UnloadGuiTextEditor(GuiTextEditorState *state)
+{
+    GuiTextEditorSetTokenizer(state, NULL, NULL);
+
+    free(state->buffer);
+    free(state->lineStarts);
+    free(state->rowStarts);
+    free(state->lexStates);
+    free(state->breaks);
+
+    GuiTextEditorState empty = { 0 };
+    *state = empty;
+}
+
+// Replace all text
+void GuiTextEditorSetText(GuiTextEditorState *state, const char *text)
+{
+    GuiTextEditorDelete(state, 0, state->length);
+    if (text != NULL) GuiTextEditorInsert(state, 0, text, (int)strlen(text));
+
+    state->cursor = 0;
+    state->selectionAnchor = 0;
+    state->scroll = (Vector2){ 0 };
+}
+
+// Get text, moving the gap to the end
+const char *GuiTextEditorGetText(GuiTextEditorState *state)
+{
+    MoveEditorGap(state, state->length, 1);
+    state->buffer[state->length] = '\0';
+
+    return state->buffer;
+}
+
+// Insert text at byte position, updating line and row index around the edit
+void GuiTextEditorInsert(GuiTextEditorState *state, int position, const char *text, int length)
+{
+    if ((text == NULL) || (length <= 0)) return;
+    if (position < 0) position = 0;
+    if (position > state->length) position = state->length;
+
+    int line = GuiTextEditorGetLine(state, position);
+    int oldRows = GetEditorRowStart(state, line + 1) - GetEditorRowStart(state, line);
+
+    // Count new lines to make room for them in the index
+    int newLines = 0;
+    for (const char *next = (const char *)memchr(text, '\n', length); next != NULL; next = (const char *)memchr(next + 1, '\n', length - (next + 1 - text))) newLines++;
+
+    MoveEditorIndexGap(state, line + 1, newLines);
+    MoveEditorGap(state, position, length);
+
+    memcpy(state->buffer + position, text, length);
+    state->gapStart += length;
+    state->length += length;
+
+    // New line starts are absolute values placed before the gap
+    int rowStart = GetEditorRowStart(state, line);
+    for (int i = 0; i < length; i++)
+    {
+        if (text[i] == '\n')
+        {
+            state->lineStarts[state->indexGapStart] = position + i + 1;
+            state->rowStarts[state->indexGapStart] = rowStart;
+            state->lexStates[state->indexGapStart] = 0;
+            state->indexGapStart++;
+            state->lineCount++;
+        }
+    }
+
+    // Measure touched lines, rows after them follow through relative entries
+    int newRows = 0;
+    for (int l = line; l <= line + newLines; l++)
+    {
+        state->rowStarts[l] = rowStart + newRows;
+        newRows += (state->wrapWidth > 0)? MeasureEditorLine(state, l) : 1;
+    }
+
+    state->rowCount += newRows - oldRows;
+
+    if (state->highlight != NULL) InvalidateEditorHighlight(state, line, line, newLines);
+
+    if (state->cursor >= position) state->cursor += length;
+    if (state->selectionAnchor >= position) state->selectionAnchor += length;
+    state->textChanged = true;
+}
+
+// Delete length bytes at byte position, updating line and row index around the edit
+void GuiTextEditorDelete(GuiTextEditorState *state, int position, int length)
+{
+    if (position < 0) { length += position; position = 0; }
+    if (position + length > state->length) length = state->length - position;
+    if (length <= 0) return;
+
+    int line = GuiTextEditorGetLine(state, position);
+    int lastLine = GuiTextEditorGetLine(state, position + length);
+    int oldRows = GetEditorRowStart(state, lastLine + 1) - GetEditorRowStart(state, line);
+
+    // Removed line starts are the first entries after the gap
+    MoveEditorIndexGap(state, line + 1, 0);
+    state->indexGapEnd += lastLine - line;
+    state->lineCount -= lastLine - line;
+
+    MoveEditorGap(state, position, 0);
+    state->gapEnd += length;
+    state->length -= length;
+
+    int newRows = (state->wrapWidth > 0)? MeasureEditorLine(state, line) : 1;
+    state->rowCount += newRows - oldRows;
+
+    if (state->highlight != NULL) InvalidateEditorHighlight(state, line, lastLine, 0);
+
+    if (state->cursor > position) state->cursor = (state->cursor > position + length)? state->cursor - length : position;
+    if (state->selectionAnchor > position) state->selectionAnchor = (state->selectionAnchor > position + length)? state->selectionAnchor - length : position;
+    state->textChanged = true;
+}
+
+// Get line containing byte position, binary search over line starts
+int GuiTextEditorGetLine(GuiTextEditorState *state, int position)
+{
+    int low = 0;
+    int high = state->lineCount - 1;
+
+    while (low < high)
+    {
+        int mid = low + (high - low + 1)/2;
+        if (GuiTextEditorGetLineStart(state, mid) <= position) low = mid;
+        else high = mid - 1;
+    }
+
+    return low;
+}
+
+// Get byte position where line starts (line count returns text length)
+int GuiTextEditorGetLineStart(GuiTextEditorState *state, int line)
+{
+    if (line >= state->lineCount) return state->length;
+    if (line < state->indexGapStart) return state->lineStarts[line];
+
+    return state->lineStarts[line + state->indexGapEnd - state->indexGapStart] + state->length;
+}
+
+// Set syntax highlight tokenizer, all lines are tokenized again when drawn
+void GuiTextEditorSetTokenizer(GuiTextEditorState *state, GuiTextEditorTokenizer tokenizer, void *userData)
+{
+    GuiTextEditorHighlight *highlight = state->highlight;
+
+    if (highlight != NULL)
+    {
+        for (int i = 0; i < GUI_TEXT_EDITOR_RUNS_CACHE; i++) free(highlight->cache[i].runs);
+        free(highlight->tokens);
+        free(highlight);
+        state->highlight = NULL;
+    }
+
+    if (tokenizer == NULL) return;
+
+    highlight = (GuiTextEditorHighlight *)calloc(1, sizeof(GuiTextEditorHighlight));
+    highlight->tokenizer = tokenizer;
+    highlight->userData = userData;
+    highlight->validLines = 1;
+    highlight->lexedLines = 1;
+    highlight->editedLine = -1;
+    for (int i = 0; i < GUI_TEXT_EDITOR_RUNS_CACHE; i++) highlight->cache[i].line = -1;
+
+    state->highlight = highlight;
+}
+
+// Text editor control
+// NOTE: Returns 1 when edit mode should be toggled (mouse pressed inside or outside)
+int GuiTextEditor(Rectangle bounds, GuiTextEditorState *state, bool editMode)
+{
+    int result = 0;
+
+    Font font = GuiGetFont();
+    float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    float spacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    float lineHeight = (float)GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+    float padding = (float)GuiGetStyle(TEXTBOX, TEXT_PADDING);
+    if (lineHeight < fontSize) lineHeight = fontSize;
+
+    // Rebuild ASCII advances table and row index on font or wrap width change
+    float wrapWidth = state->wrapText? bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) - 2*padding : 0;
+    if (state->wrapText && (wrapWidth < 1)) wrapWidth = 1;
+
+    bool fontChanged = (state->fontId != font.texture.id) || (state->fontSize != fontSize) || (state->spacing != spacing);
+
+    if (fontChanged)
+    {
+        float scaleFactor = fontSize/(float)font.baseSize;
+
+        for (int c = 0; c < 128; c++)
+        {
+            int glyph = GetGlyphIndex(font, (c < 32)? ' ' : c);
+            float advance = (font.glyphs[glyph].advanceX != 0)? (float)font.glyphs[glyph].advanceX : font.recs[glyph].width;
+            state->advance[c] = advance*scaleFactor + spacing;
+        }
+
+        state->advance['\t'] = state->advance[' ']*GUI_TEXT_EDITOR_TAB_SIZE;
+        state->advance['\r'] = 0;
+        state->fontId = font.texture.id;
+        state->fontSize = fontSize;
+        state->spacing = spacing;
+        state->maxLineWidth = 0;
+    }
+
+    if (fontChanged || (state->wrapWidth != wrapWidth))
+    {
+        state->wrapWidth = wrapWidth;
+        MeasureEditorRows(state);
+    }
+
+    // Scroll panel over all visual rows
+    Rectangle content = { 0, 0, bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH), state->rowCount*lineHeight + 2*padding };
+    if (!state->wrapText && (state->maxLineWidth > content.width)) content.width = state->maxLineWidth;
+
+    Rectangle view = { 0 };
+    GuiScrollPanel(bounds, NULL, content, &state->scroll, &view);
+
+    // Update control
+    //--------------------------------------------------------------------
+    bool cursorMoved = false;
+    bool edited = false;
+
+    if ((GuiGetState() != STATE_DISABLED) && !GuiIsLocked() && !guiControlExclusiveMode)
+    {
+        Vector2 mousePosition = GetTransformedMousePosition();
+        bool mouseInView = CheckCollisionPointRec(mousePosition, view);
+
+        if (!editMode)
+        {
+            if (mouseInView && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) result = 1;
+        }
+        else if (!mouseInView && !CheckCollisionPointRec(mousePosition, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+        {
+            state->selecting = false;
+            result = 1;
+        }
+
+        // Place cursor with mouse and drag to select
+        if (mouseInView && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) state->selecting = true;
+        if (!IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state->selecting = false;
+
+        if (state->selecting)
+        {
+            int row = (int)((mousePosition.y - view.y - state->scroll.y - padding)/lineHeight);
+            if (row < 0) row = 0;
+            if (row >= state->rowCount) row = state->rowCount - 1;
+
+            state->cursor = GetEditorPositionFromRow(state, row, mousePosition.x - view.x - state->scroll.x - padding);
+            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !IsKeyDown(KEY_LEFT_SHIFT) && !IsKeyDown(KEY_RIGHT_SHIFT)) state->selectionAnchor = state->cursor;
+            state->preferredX = -1;
+        }
+
+        if (editMode && !GuiGetStyle(TEXTBOX, TEXT_READONLY))
+        {
+            bool shift = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
+            bool control = IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL);
+            int selectionStart = (state->cursor < state->selectionAnchor)? state->cursor : state->selectionAnchor;
+            int selectionEnd = (state->cursor < state->selectionAnchor)? state->selectionAnchor : state->cursor;
+            int cursor = state->cursor;
+            int prevLength = state->length;
+
+            #define GUI_TEXT_EDITOR_KEY(key) (IsKeyPressed(key) || IsKeyPressedRepeat(key))
+
+            // Clipboard and selection shortcuts
+            if (control && IsKeyPressed(KEY_A)) { state->selectionAnchor = 0; cursor = state->length; shift = true; }
+            if (control && (IsKeyPressed(KEY_C) || IsKeyPressed(KEY_X)) && (selectionEnd > selectionStart))
+            {
+                const char *text = GuiTextEditorGetText(state);
+                char *copy = (char *)malloc(selectionEnd - selectionStart + 1);
+                memcpy(copy, text + selectionStart, selectionEnd - selectionStart);
+                copy[selectionEnd - selectionStart] = '\0';
+                SetClipboardText(copy);
+                free(copy);
+
+                if (IsKeyPressed(KEY_X)) { GuiTextEditorDelete(state, selectionStart, selectionEnd - selectionStart); cursor = state->cursor; }
+            }
+
+            // Collect typed text, replacing selection
+            char input[256] = { 0 };
+            int inputLength = 0;
+
+            for (int codepoint = GetCharPressed(); codepoint > 0; codepoint = GetCharPressed())
+            {
+                int size = 0;
+                const char *encoded = CodepointToUTF8(codepoint, &size);
+                if (!control && (codepoint >= 32) && (inputLength + size < (int)sizeof(input))) { memcpy(input + inputLength, encoded, size); inputLength += size; }
+            }
+
+            if (GUI_TEXT_EDITOR_KEY(KEY_ENTER) && (inputLength + 1 < (int)sizeof(input))) input[inputLength++] = '\n';
+            if (GUI_TEXT_EDITOR_KEY(KEY_TAB) && (inputLength + 1 < (int)sizeof(input))) input[inputLength++] = '\t';
+
+            // Pasted text is filtered to valid UTF-8 sequences, same rules as text box input
+            const char *clipboard = (control && IsKeyPressed(KEY_V))? GetClipboardText() : NULL;
+            char *paste = NULL;
+            int pasteLength = 0;
+
+            if ((clipboard != NULL) && (clipboard[0] != '\0'))
+            {
+                int length = (int)strlen(clipboard);
+                paste = (char *)malloc(length);
+                pasteLength = GetEditorValidText(clipboard, length, paste);
+            }
+
+            if ((inputLength > 0) || (pasteLength > 0))
+            {
+                if (selectionEnd > selectionStart) GuiTextEditorDelete(state, selectionStart, selectionEnd - selectionStart);
+
+                int position = state->cursor;
+                if (pasteLength > 0) GuiTextEditorInsert(state, position, paste, pasteLength);
+                else GuiTextEditorInsert(state, position, input, inputLength);
+
+                cursor = state->cursor;
+                state->selectionAnchor = cursor;
+            }
+            else if (GUI_TEXT_EDITOR_KEY(KEY_BACKSPACE) || GUI_TEXT_EDITOR_KEY(KEY_DELETE))
+            {
+                if (selectionEnd > selectionStart) GuiTextEditorDelete(state, selectionStart, selectionEnd - selectionStart);
+                else
+                {
+                    int length = 0;
+                    int line = GuiTextEditorGetLine(state, cursor);
+                    const char *text = GetEditorLineText(state, line, &length);
+                    int index = cursor - GuiTextEditorGetLineStart(state, line);
+                    int size = 1;
+
+                    // Delete full UTF-8 sequences, line breaks are single bytes
+                    if (GUI_TEXT_EDITOR_KEY(KEY_BACKSPACE) && (cursor > 0))
+                    {
+                        while ((index - size > 0) && ((text[index - size] & 0xc0) == 0x80)) size++;
+                        GuiTextEditorDelete(state, cursor - size, size);
+                    }
+                    else if (GUI_TEXT_EDITOR_KEY(KEY_DELETE) && (cursor < state->length))
+                    {
+                        while ((index + size < length) && ((text[index + size] & 0xc0) == 0x80)) size++;
+                        GuiTextEditorDelete(state, cursor, size);
+                    }
+                }
+
+                cursor = state->cursor;
+                state->selectionAnchor = cursor;
+            }
+
+            free(paste);
+
+            if (state->length != prevLength) { edited = true; state->preferredX = -1; }
+
+            // Cursor movement
+            int line = GuiTextEditorGetLine(state, cursor);
+            int cursorRow = 0;
+            float cursorX = 0;
+            GetEditorCursorPosition(state, cursor, &cursorRow, &cursorX);
+            if (state->preferredX < 0) state->preferredX = cursorX;
+
+            int visibleRows = (int)(view.height/lineHeight);
+            int targetRow = -1;
+
+            if (GUI_TEXT_EDITOR_KEY(KEY_UP) && (cursorRow > 0)) targetRow = cursorRow - 1;
+            if (GUI_TEXT_EDITOR_KEY(KEY_DOWN) && (cursorRow < state->rowCount - 1)) targetRow = cursorRow + 1;
+            if (GUI_TEXT_EDITOR_KEY(KEY_PAGE_UP)) targetRow = (cursorRow > visibleRows)? cursorRow - visibleRows : 0;
+            if (GUI_TEXT_EDITOR_KEY(KEY_PAGE_DOWN)) targetRow = (cursorRow + visibleRows < state->rowCount)? cursorRow + visibleRows : state->rowCount - 1;
+
+            if (targetRow >= 0) cursor = GetEditorPositionFromRow(state, targetRow, state->preferredX);
+            else
+            {
+                int lineStart = GuiTextEditorGetLineStart(state, line);
+                int length = 0;
+                const char *text = GetEditorLineText(state, line, &length);
+
+                if (GUI_TEXT_EDITOR_KEY(KEY_LEFT))
+                {
+                    if (!shift && (selectionEnd > selectionStart)) cursor = selectionStart;
+                    else if (cursor > lineStart) { cursor--; while ((cursor > lineStart) && ((text[cursor - lineStart] & 0xc0) == 0x80)) cursor--; }
+                    else if (cursor > 0) cursor--;
+                }
+                if (GUI_TEXT_EDITOR_KEY(KEY_RIGHT))
+                {
+                    if (!shift && (selectionEnd > selectionStart)) cursor = selectionEnd;
+                    else if (cursor < lineStart + length) { cursor++; while ((cursor < lineStart + length) && ((text[cursor - lineStart] & 0xc0) == 0x80)) cursor++; }
+                    else if (cursor < state->length) cursor++;
+                }
+                if (IsKeyPressed(KEY_HOME)) cursor = control? 0 : GetEditorPositionFromRow(state, cursorRow, 0);
+                if (IsKeyPressed(KEY_END)) cursor = control? state->length : GetEditorPositionFromRow(state, cursorRow, 1e30f);
+
+                if (cursor != state->cursor) state->preferredX = -1;
+            }
+
+            #undef GUI_TEXT_EDITOR_KEY
+
+            cursorMoved = (cursor != state->cursor) || edited;
+            state->cursor = cursor;
+            if (!shift && (targetRow >= 0 || cursorMoved) && !state->selecting) state->selectionAnchor = cursor;
+        }
+    }
+
+    // Keep cursor visible after keyboard movement or edits
+    if (cursorMoved && !state->selecting)
+    {
+        int cursorRow = 0;
+        float cursorX = 0;
+        GetEditorCursorPosition(state, state->cursor, &cursorRow, &cursorX);
+
+        float cursorY = cursorRow*lineHeight + padding;
+        if (cursorY + state->scroll.y < 0) state->scroll.y = -cursorY;
+        if (cursorY + lineHeight + state->scroll.y > view.height) state->scroll.y = view.height - cursorY - lineHeight;
+
+        if (!state->wrapText)
+        {
+            if (cursorX + padding + state->scroll.x < 0) state->scroll.x = -(cursorX + padding);
+            if (cursorX + 2*padding + state->scroll.x > view.width) state->scroll.x = view.width - cursorX - 2*padding;
+        }
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiState controlState = (GuiGetState() == STATE_DISABLED)? STATE_DISABLED : (editMode? STATE_PRESSED : STATE_NORMAL);
+    Color textColor = GetColor(GuiGetStyle(TEXTBOX, TEXT + controlState*3));
+    Color selectionColor = Fade(GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)), 0.4f);
+    Color cursorColor = GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED));
+    int selectionStart = (state->cursor < state->selectionAnchor)? state->cursor : state->selectionAnchor;
+    int selectionEnd = (state->cursor < state->selectionAnchor)? state->selectionAnchor : state->cursor;
+
+    GuiBeginScissor(view);
+
+    // Only rows intersecting the view are measured and drawn
+    int firstRow = (int)((-state->scroll.y - padding)/lineHeight);
+    if (firstRow < 0) firstRow = 0;
+
+    int row = firstRow;
+    int line = GetEditorLineFromRow(state, row);
+    float y = view.y + state->scroll.y + padding + row*lineHeight;
+
+    while ((y < view.y + view.height) && (line < state->lineCount))
+    {
+        GuiTextEditorLineRuns *runs = (state->highlight != NULL)? GetEditorLineRuns(state, line) : NULL;
+        int rows = (state->wrapWidth > 0)? MeasureEditorLine(state, line) : 1;
+        int lineRow = GetEditorRowStart(state, line);
+        int lineStart = GuiTextEditorGetLineStart(state, line);
+        int length = 0;
+        const char *text = GetEditorLineText(state, line, &length);
+
+        for (int r = row - lineRow; (r < rows) && (y < view.y + view.height); r++, row++, y += lineHeight)
+        {
+            int start = (state->wrapWidth > 0)? state->breaks[r] : 0;
+            int end = ((state->wrapWidth > 0) && (r + 1 < rows))? state->breaks[r + 1] : length;
+            float x = view.x + state->scroll.x + padding;
+            int run = 0;
+
+            for (int i = start; i <= end;)
+            {
+                int position = lineStart + i;
+
+                if (editMode && (position == state->cursor) && ((i < end) || (r + 1 == rows)))
+                {
+                    GuiDrawRectangle((Rectangle){ x, y, 2, lineHeight }, 0, BLANK, cursorColor);
+                }
+
+                if (i == end) break;
+
+                int codepoint = 0;
+                int size = 1;
+                float advance = GetEditorGlyphAdvance(state, text, length, i, &codepoint, &size);
+
+                if ((position >= selectionStart) && (position < selectionEnd)) GuiDrawRectangle((Rectangle){ x, y, advance, lineHeight }, 0, BLANK, selectionColor);
+
+                if (x > view.x + view.width)
+                {
+                    // Rest of the row is not visible, its width is estimated for the scroll bar
+                    x += (float)(end - i)*state->advance['n'];
+                    break;
+                }
+                if ((x + advance > view.x) && (codepoint > ' '))
+                {
+                    Color color = textColor;
+
+                    if ((runs != NULL) && (runs->count > 0))
+                    {
+                        while ((run + 1 < runs->count) && (runs->runs[run + 1].start <= i)) run++;
+                        if (state->tokenColors[runs->runs[run].token].a > 0) color = state->tokenColors[runs->runs[run].token];
+                    }
+
+                    GuiDrawGlyph(codepoint, (Vector2){ x, y + (lineHeight - fontSize)/2 }, GuiFade(color, guiAlpha));
+                }
+
+                x += advance;
+                i += size;
+            }
+
+            // Line width grows the content for horizontal scrolling
+            if (!state->wrapText)
+            {
+                float width = x - (view.x + state->scroll.x) + padding;
+                if (width > state->maxLineWidth) state->maxLineWidth = width;
+            }
+        }
+
+        line++;
+    }
+
+    GuiEndScissor();
+    //--------------------------------------------------------------------
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+// Move buffer gap to position, making sure it has room for required bytes
+static void MoveEditorGap(GuiTextEditorState *state, int position, int required)
+{
+    if ((state->gapEnd - state->gapStart) < required)
+    {
+        int tail = state->capacity - state->gapEnd;
+        int capacity = state->capacity*2;
+        if (capacity < state->length + required + GUI_TEXT_EDITOR_MIN_GAP) capacity = state->length + required + GUI_TEXT_EDITOR_MIN_GAP;
+
+        state->buffer = (char *)realloc(state->buffer, capacity);
+        memmove(state->buffer + capacity - tail, state->buffer + state->gapEnd, tail);
+        state->gapEnd = capacity - tail;
+        state->capacity = capacity;
+    }
+
+    if (position < state->gapStart)
+    {
+        int count = state->gapStart - position;
+        memmove(state->buffer + state->gapEnd - count, state->buffer + position, count);
+        state->gapStart -= count;
+        state->gapEnd -= count;
+    }
+    else if (position > state->gapStart)
+    {
+        int count = position - state->gapStart;
+        memmove(state->buffer + state->gapStart, state->buffer + state->gapEnd, count);
+        state->gapStart += count;
+        state->gapEnd += count;
+    }
+}
+
+// Move index gap before line, converting moved entries between absolute and relative values
+static void MoveEditorIndexGap(GuiTextEditorState *state, int line, int required)
+{
+    if ((state->indexGapEnd - state->indexGapStart) < required)
+    {
+        int tail = state->indexCapacity - state->indexGapEnd;
+        int capacity = state->indexCapacity*2;
+        if (capacity < state->lineCount + required + 64) capacity = state->lineCount + required + 64;
+
+        state->lineStarts = (int *)realloc(state->lineStarts, capacity*sizeof(int));
+        state->rowStarts = (int *)realloc(state->rowStarts, capacity*sizeof(int));
+        state->lexStates = (int *)realloc(state->lexStates, capacity*sizeof(int));
+        memmove(state->lineStarts + capacity - tail, state->lineStarts + state->indexGapEnd, tail*sizeof(int));
+        memmove(state->rowStarts + capacity - tail, state->rowStarts + state->indexGapEnd, tail*sizeof(int));
+        memmove(state->lexStates + capacity - tail, state->lexStates + state->indexGapEnd, tail*sizeof(int));
+        state->indexGapEnd = capacity - tail;
+        state->indexCapacity = capacity;
+    }
+
+    while (state->indexGapStart > line)
+    {
+        state->indexGapStart--;
+        state->indexGapEnd--;
+        state->lineStarts[state->indexGapEnd] = state->lineStarts[state->indexGapStart] - state->length;
+        state->rowStarts[state->indexGapEnd] = state->rowStarts[state->indexGapStart] - state->rowCount;
+        state->lexStates[state->indexGapEnd] = state->lexStates[state->indexGapStart];
+    }
+
+    while (state->indexGapStart < line)
+    {
+        state->lineStarts[state->indexGapStart] = state->lineStarts[state->indexGapEnd] + state->length;
+        state->rowStarts[state->indexGapStart] = state->rowStarts[state->indexGapEnd] + state->rowCount;
+        state->lexStates[state->indexGapStart] = state->lexStates[state->indexGapEnd];
+        state->indexGapStart++;
+        state->indexGapEnd++;
+    }
+}
+
+// Get visual row where line starts (line count returns total rows)
+static int GetEditorRowStart(GuiTextEditorState *state, int line)
+{
+    if (line >= state->lineCount) return state->rowCount;
+    if (line < state->indexGapStart) return state->rowStarts[line];
+
+    return state->rowStarts[line + state->indexGapEnd - state->indexGapStart] + state->rowCount;
+}
+
+// Get line containing visual row, binary search over row starts
+static int GetEditorLineFromRow(GuiTextEditorState *state, int row)
+{
+    int low = 0;
+    int high = state->lineCount - 1;
+
+    while (low < high)
+    {
+        int mid = low + (high - low + 1)/2;
+        if (GetEditorRowStart(state, mid) <= row) low = mid;
+        else high = mid - 1;
+    }
+
+    return low;
+}
+
+// Get line bytes without line break, contiguous in memory
+// NOTE: If the gap is inside the line it is moved to the line end (cost limited to line length)
+static const char *GetEditorLineText(GuiTextEditorState *state, int line, int *length)
+{
+    int start = GuiTextEditorGetLineStart(state, line);
+    int end = (line + 1 < state->lineCount)? GuiTextEditorGetLineStart(state, line + 1) - 1 : state->length;
+
+    *length = end - start;
+    if (*length <= 0) { *length = 0; return ""; }
+
+    if ((start < state->gapStart) && (end > state->gapStart)) MoveEditorGap(state, end, 0);
+
+    return (start < state->gapStart)? state->buffer + start : state->buffer + start + (state->gapEnd - state->gapStart);
+}
+
+// Get glyph advance at text index, decoding UTF-8 bounded to text length
+static float GetEditorGlyphAdvance(GuiTextEditorState *state, const char *text, int length, int index, int *codepoint, int *size)
+{
+    int c = (unsigned char)text[index];
+
+    *size = 1;
+    *codepoint = c;
+
+    if (c < 128) return state->advance[c];
+
+    if (((c & 0xe0) == 0xc0) && (index + 1 < length)) { *codepoint = ((c & 0x1f) << 6) | (text[index + 1] & 0x3f); *size = 2; }
+    else if (((c & 0xf0) == 0xe0) && (index + 2 < length)) { *codepoint = ((c & 0x0f) << 12) | ((text[index + 1] & 0x3f) << 6) | (text[index + 2] & 0x3f); *size = 3; }
+    else if (((c & 0xf8) == 0xf0) && (index + 3 < length)) { *codepoint = ((c & 0x07) << 18) | ((text[index + 1] & 0x3f) << 12) | ((text[index + 2] & 0x3f) << 6) | (text[index + 3] & 0x3f); *size = 4; }
+    else *codepoint = '?';
+
+    Font font = GuiGetFont();
+    int glyph = GetGlyphIndex(font, *codepoint);
+    float advance = (font.glyphs[glyph].advanceX != 0)? (float)font.glyphs[glyph].advanceX : font.recs[glyph].width;
+
+    return advance*state->fontSize/(float)font.baseSize + state->spacing;
+}
+
+// Measure line wrapped rows for current wrap width, row starts are kept in breaks scratch
+static int MeasureEditorLine(GuiTextEditorState *state, int line)
+{
+    int length = 0;
+    const char *text = GetEditorLineText(state, line, &length);
+
+    int rows = 0;
+    int rowStart = 0;
+    int lastSpace = -1;
+    float rowWidth = 0;
+
+    for (int i = 0; i <= length;)
+    {
+        if (rows + 1 >= state->breaksCapacity)
+        {
+            state->breaksCapacity = (state->breaksCapacity == 0)? 64 : state->breaksCapacity*2;
+            state->breaks = (int *)realloc(state->breaks, state->breaksCapacity*sizeof(int));
+        }
+
+        if ((i == length) || (state->wrapWidth <= 0)) { state->breaks[rows++] = rowStart; break; }
+
+        int codepoint = 0;
+        int size = 1;
+        float advance = GetEditorGlyphAdvance(state, text, length, i, &codepoint, &size);
+
+        if ((rowWidth + advance > state->wrapWidth) && (i > rowStart))
+        {
+            // Break after last space in row when possible, otherwise at current glyph
+            int next = (lastSpace >= rowStart)? lastSpace + 1 : i;
+
+            state->breaks[rows++] = rowStart;
+            rowStart = next;
+            lastSpace = -1;
+            rowWidth = 0;
+            i = next;
+            continue;
+        }
+
+        if ((codepoint == ' ') || (codepoint == '\t')) lastSpace = i;
+
+        rowWidth += advance;
+        i += size;
+    }
+
+    return rows;
+}
+
+// Measure rows of all lines, rebuilding row index
+static void MeasureEditorRows(GuiTextEditorState *state)
+{
+    MoveEditorIndexGap(state, state->lineCount, 0);     // All entries absolute
+
+    int rows = 0;
+
+    for (int line = 0; line < state->lineCount; line++)
+    {
+        state->rowStarts[line] = rows;
+        rows += (state->wrapWidth > 0)? MeasureEditorLine(state, line) : 1;
+    }
+
+    state->rowCount = rows;
+}
+
+// Get visual row and x offset of a byte position
+static void GetEditorCursorPosition(GuiTextEditorState *state, int position, int *row, float *x)
+{
+    int line = GuiTextEditorGetLine(state, position);
+    int lineStart = GuiTextEditorGetLineStart(state, line);
+    int rows = (state->wrapWidth > 0)? MeasureEditorLine(state, line) : 1;
+
+    int length = 0;
+    const char *text = GetEditorLineText(state, line, &length);
+
+    int r = 0;
+    while ((state->wrapWidth > 0) && (r + 1 < rows) && (state->breaks[r + 1] <= position - lineStart)) r++;
+
+    *row = GetEditorRowStart(state, line) + r;
+    *x = 0;
+
+    for (int i = (state->wrapWidth > 0)? state->breaks[r] : 0; i < position - lineStart;)
+    {
+        int codepoint = 0;
+        int size = 1;
+        *x += GetEditorGlyphAdvance(state, text, length, i, &codepoint, &size);
+        i += size;
+    }
+}
+
+// Get byte position nearest to x inside visual row
+static int GetEditorPositionFromRow(GuiTextEditorState *state, int row, float x)
+{
+    int line = GetEditorLineFromRow(state, row);
+    int lineStart = GuiTextEditorGetLineStart(state, line);
+    int rows = (state->wrapWidth > 0)? MeasureEditorLine(state, line) : 1;
+    int r = row - GetEditorRowStart(state, line);
+
+    int length = 0;
+    const char *text = GetEditorLineText(state, line, &length);
+
+    int start = (state->wrapWidth > 0)? state->breaks[r] : 0;
+    int end = (r + 1 < rows)? state->breaks[r + 1] : length;
+    float width = 0;
+
+    // NOTE: Wrapped rows end before their last glyph, the end position belongs to next row
+    for (int i = start; i < end;)
+    {
+        int codepoint = 0;
+        int size = 1;
+        float advance = GetEditorGlyphAdvance(state, text, length, i, &codepoint, &size);
+
+        if ((x < width + advance/2) || ((r + 1 < rows) && (i + size >= end))) return lineStart + i;
+
+        width += advance;
+        i += size;
+    }
+
+    return lineStart + end;
+}
+
+// Get lexer state at line start, stored in line index
+static int *GetEditorLexState(GuiTextEditorState *state, int line)
+{
+    if (line < state->indexGapStart) return &state->lexStates[line];
+
+    return &state->lexStates[line + state->indexGapEnd - state->indexGapStart];
+}
+
+// Update lexer progress and runs cache after lines [line, lastLine] were replaced by newLines + 1 lines
+static void InvalidateEditorHighlight(GuiTextEditorState *state, int line, int lastLine, int newLines)
+{
+    GuiTextEditorHighlight *highlight = state->highlight;
+    int delta = newLines - (lastLine - line);
+
+    // Lexer state at edited line start is still valid, next line states must be checked again
+    if (highlight->validLines > line + 1) highlight->validLines = line + 1;
+
+    if (highlight->lexedLines > lastLine + 1) highlight->lexedLines += delta;
+    else if (highlight->lexedLines > line + 1) highlight->lexedLines = line + 1;
+
+    // Edited lines only delay convergence when followed by computed states
+    if (highlight->editedLine > lastLine) highlight->editedLine += delta;
+    else if (highlight->editedLine > line) highlight->editedLine = line;
+    if ((highlight->editedLine < line + newLines) && (line + newLines < highlight->lexedLines)) highlight->editedLine = line + newLines;
+
+    if (delta == 0)
+    {
+        if (highlight->cache[line%GUI_TEXT_EDITOR_RUNS_CACHE].line == line) highlight->cache[line%GUI_TEXT_EDITOR_RUNS_CACHE].line = -1;
+        return;
+    }
+
+    // Line numbers changed: cached runs after the edit are moved to their new slots, edited lines dropped
+    GuiTextEditorLineRuns moved[GUI_TEXT_EDITOR_RUNS_CACHE];
+    memcpy(moved, highlight->cache, sizeof(moved));
+    memset(highlight->cache, 0, sizeof(moved));
+    for (int i = 0; i < GUI_TEXT_EDITOR_RUNS_CACHE; i++) highlight->cache[i].line = -1;
+
+    for (int i = 0; i < GUI_TEXT_EDITOR_RUNS_CACHE; i++)
+    {
+        int cached = moved[i].line;
+
+        if ((cached >= line) && (cached <= lastLine)) cached = -1;
+        else if (cached > lastLine) cached += delta;
+
+        if ((cached >= 0) && (highlight->cache[cached%GUI_TEXT_EDITOR_RUNS_CACHE].line < 0))
+        {
+            highlight->cache[cached%GUI_TEXT_EDITOR_RUNS_CACHE] = moved[i];
+            highlight->cache[cached%GUI_TEXT_EDITOR_RUNS_CACHE].line = cached;
+            memset(&moved[i], 0, sizeof(GuiTextEditorLineRuns));
+        }
+    }
+
+    // Buffers of dropped entries are reused by empty slots
+    for (int i = 0; i < GUI_TEXT_EDITOR_RUNS_CACHE; i++)
+    {
+        if ((highlight->cache[i].line < 0) && (highlight->cache[i].runs == NULL)) { highlight->cache[i] = moved[i]; highlight->cache[i].line = -1; }
+        else free(moved[i].runs);
+    }
+}
+
+// Tokenize line into its runs cache slot, returns lexer state at line end
+static int TokenizeEditorLine(GuiTextEditorState *state, int line)
+{
+    GuiTextEditorHighlight *highlight = state->highlight;
+    GuiTextEditorLineRuns *runs = &highlight->cache[line%GUI_TEXT_EDITOR_RUNS_CACHE];
+
+    int length = 0;
+    const char *text = GetEditorLineText(state, line, &length);
+
+    if (length + 1 > highlight->tokensCapacity)
+    {
+        highlight->tokensCapacity = (length + 1)*2;
+        highlight->tokens = (unsigned char *)realloc(highlight->tokens, highlight->tokensCapacity);
+    }
+
+    int lexState = highlight->tokenizer(text, length, *GetEditorLexState(state, line), highlight->tokens, highlight->userData);
+
+    // Group consecutive bytes of same token class
+    runs->line = line;
+    runs->count = 0;
+
+    for (int i = 0; i < length; i++)
+    {
+        int token = (highlight->tokens[i] < GUI_TEXT_EDITOR_MAX_TOKEN_COLORS)? highlight->tokens[i] : 0;
+
+        if ((runs->count > 0) && (runs->runs[runs->count - 1].token == token)) continue;
+
+        if (runs->count == runs->capacity)
+        {
+            runs->capacity = (runs->capacity == 0)? 16 : runs->capacity*2;
+            runs->runs = (GuiTextEditorRun *)realloc(runs->runs, runs->capacity*sizeof(GuiTextEditorRun));
+        }
+
+        runs->runs[runs->count].start = i;
+        runs->runs[runs->count].token = token;
+        runs->count++;
+    }
+
+    return lexState;
+}
+
+// Get colored runs of line, tokenizing lines before it until its lexer state is known
+static GuiTextEditorLineRuns *GetEditorLineRuns(GuiTextEditorState *state, int line)
+{
+    GuiTextEditorHighlight *highlight = state->highlight;
+
+    while (highlight->validLines <= line)
+    {
+        int previous = highlight->validLines - 1;
+        int lexState = TokenizeEditorLine(state, previous);
+        int *nextState = GetEditorLexState(state, previous + 1);
+
+        highlight->validLines++;
+
+        if ((*nextState == lexState) && (previous >= highlight->editedLine) && (previous + 1 < highlight->lexedLines))
+        {
+            // States converged after all edited lines, following computed ones are unchanged
+            highlight->validLines = highlight->lexedLines;
+            highlight->editedLine = -1;
+        }
+        else if (*nextState != lexState)
+        {
+            *nextState = lexState;
+
+            GuiTextEditorLineRuns *next = &highlight->cache[(previous + 1)%GUI_TEXT_EDITOR_RUNS_CACHE];
+            if (next->line == previous + 1) next->line = -1;
+        }
+
+        if (highlight->lexedLines < highlight->validLines) highlight->lexedLines = highlight->validLines;
+    }
+
+    GuiTextEditorLineRuns *runs = &highlight->cache[line%GUI_TEXT_EDITOR_RUNS_CACHE];
+    if (runs->line != line) TokenizeEditorLine(state, line);
+
+    return runs;
+}
+
+// Copy valid UTF-8 sequences of text into valid buffer (line breaks and tabs allowed), returns copied size
+// NOTE: Sequences are checked with raygui text box rules, invalid bytes are dropped
+static int GetEditorValidText(const char *text, int length, char *valid)
+{
+    int size = 0;
+
+    for (int i = 0; i < length;)
+    {
+        int sequenceSize = (text[i] == '\t')? 1 : GetTextValidSequence(text + i, length - i, true);
+
+        if (sequenceSize > 0) { memcpy(valid + size, text + i, sequenceSize); size += sequenceSize; i += sequenceSize; }
+        else i -= sequenceSize;
+    }
+
+    return size;
+}
+
+#endif // GUI_TEXT_EDITOR_IMPLEMENTATION
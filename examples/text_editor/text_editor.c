@@ -0,0 +1,98 @@
+/*******************************************************************************************
+*
+*   raygui - multiline text editor
+*
+*   DEPENDENCIES:
+*       raylib 5.0  - Windowing/input management and drawing.
+*       raygui 4.5  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   USAGE:
+*       Drop a text file into the window (or pass it as first argument) to edit it
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+#define GUI_TEXT_EDITOR_IMPLEMENTATION
+#include "gui_text_editor.h"
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 560;
+
+    InitWindow(screenWidth, screenHeight, "raygui - text editor");
+    SetExitKey(0);
+
+    char *fileText = LoadFileText((argc > 1)? argv[1] : __FILE__);
+    GuiTextEditorState editorState = InitGuiTextEditor(fileText);
+    UnloadFileText(fileText);
+
+    bool editMode = false;
+
+    SetTargetFPS(60);
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsFileDropped())
+        {
+            FilePathList droppedFiles = LoadDroppedFiles();
+
+            if (droppedFiles.count > 0)
+            {
+                fileText = LoadFileText(droppedFiles.paths[0]);
+                GuiTextEditorSetText(&editorState, fileText);
+                UnloadFileText(fileText);
+            }
+
+            UnloadDroppedFiles(droppedFiles);
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            if (GuiTextEditor((Rectangle){ 10, 40, (float)screenWidth - 20, (float)screenHeight - 80 }, &editorState, editMode)) editMode = !editMode;
+
+            GuiCheckBox((Rectangle){ 10, 12, 16, 16 }, "Wrap lines", &editorState.wrapText);
+
+            GuiStatusBar((Rectangle){ 0, (float)screenHeight - 30, (float)screenWidth, 30 },
+                TextFormat("Line %i/%i, %i bytes%s", GuiTextEditorGetLine(&editorState, editorState.cursor) + 1,
+                    editorState.lineCount, editorState.length, editMode? " - editing" : ""));
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadGuiTextEditor(&editorState);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,675 @@
+/*******************************************************************************************
+*
+*   Text Layout v1.0 - Asynchronous wrapped text layout for large texts
+*
+*   MODULE USAGE:
+*       #define GUI_TEXT_LAYOUT_IMPLEMENTATION
+*       #include "gui_text_layout.h"
+*
+*       INIT:   GuiTextLayout layout = InitGuiTextLayout();
+*       SUBMIT: SubmitGuiTextLayout(&layout, text, font, fontSize, spacing, width, TEXT_WRAP_WORD);
+*       DRAW:   GuiTextLayoutView(bounds, &layout, &scroll);     // Resubmits on width change, draws last completed layout
+*       UPDATE: if (UpdateGuiTextLayout(&layout)) { }            // Only required when not using GuiTextLayoutView()
+*       LINES:  const char *line = GetGuiTextLayoutLine(&layout, index, &length, &width);
+*       FREE:   UnloadGuiTextLayout(&layout);
+*
+*   DESCRIPTION:
+*       A submitted layout (text, font, wrap width and wrap mode) is computed as a job: line
+*       breaking and lines measure run on a worker thread (one per layout, created on first
+*       submit and signalled for every new job), or in time slices of layout.budget
+*       microseconds for every UpdateGuiTextLayout() call. The last completed layout is kept
+*       and drawn until the new one is completed, so submitting a layout never blocks a frame;
+*       when a layout is submitted while another one is in progress, the previous job is
+*       cancelled (i.e. resizing a text panel only completes the layout for the last width).
+*
+*       Text is referenced, not copied: it must stay valid and unchanged while it is in use
+*       by the completed layout or the submitted one.
+*
+*       GuiTextLayoutView() draws with raygui draw functions (gui alpha, state, transform and
+*       draw stream apply), so text is laid out again with gui font and style text size and
+*       spacing when they change, raygui implementation must be included before in the same
+*       translation unit.
+*
+*   CONFIGURATION:
+*       #define GUI_TEXT_LAYOUT_NO_THREADS
+*           Compute layouts in time slices inside UpdateGuiTextLayout() instead of using a
+*           worker thread (automatically defined for PLATFORM_WEB)
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#ifndef GUI_TEXT_LAYOUT_H
+#define GUI_TEXT_LAYOUT_H
+
+typedef struct GuiTextLayoutJob GuiTextLayoutJob;   // Submitted job, worker and lines buffers (internal)
+
+// Gui text layout, last completed layout info
+typedef struct {
+    const char *text;           // Text of completed layout, NULL if none
+    int lineCount;              // Lines of completed layout
+    float width;                // Wrap width of completed layout
+    float contentWidth;         // Widest line of completed layout
+    bool pending;               // Submitted layout not completed yet
+    int budget;                 // Time slice per update in microseconds (when not using a worker thread)
+
+    GuiTextLayoutJob *job;
+} GuiTextLayout;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiTextLayout InitGuiTextLayout(void);
+void UnloadGuiTextLayout(GuiTextLayout *layout);
+
+void SubmitGuiTextLayout(GuiTextLayout *layout, const char *text, Font font, float fontSize, float spacing, float width, int wrapMode); // Submit layout job, previous job is cancelled
+bool UpdateGuiTextLayout(GuiTextLayout *layout);   // Update layout job (time slice or worker check), returns true when a new layout is completed
+const char *GetGuiTextLayoutLine(const GuiTextLayout *layout, int line, int *length, float *width); // Get completed layout line text and width
+
+void GuiTextLayoutView(Rectangle bounds, GuiTextLayout *layout, Vector2 *scroll);  // Text layout view control, layout is submitted again on width change
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_TEXT_LAYOUT_H
+
+/***********************************************************************************
+*
+*   GUI_TEXT_LAYOUT IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(GUI_TEXT_LAYOUT_IMPLEMENTATION)
+
+#include "../../src/raygui.h"
+
+#include <stdlib.h>     // Required for: calloc(), realloc(), free()
+
+#if defined(PLATFORM_WEB) || defined(__EMSCRIPTEN__)
+    #define GUI_TEXT_LAYOUT_NO_THREADS
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>         // Required for: _InterlockedOr64(), _InterlockedExchange64()
+#endif
+
+#if !defined(GUI_TEXT_LAYOUT_NO_THREADS)
+#if defined(_WIN32)
+// NOTE: Required Win32 functions are declared manually to avoid windows.h conflicts with raylib
+#if defined(__cplusplus)
+extern "C" {
+#endif
+__declspec(dllimport) void *__stdcall CreateThread(void *security, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+__declspec(dllimport) void __stdcall AcquireSRWLockExclusive(void **lock);
+__declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(void **lock);
+__declspec(dllimport) int __stdcall SleepConditionVariableSRW(void **condition, void **lock, unsigned long milliseconds, unsigned long flags);
+__declspec(dllimport) void __stdcall WakeAllConditionVariable(void **condition);
+#if defined(__cplusplus)
+}
+#endif
+#else
+    #include <pthread.h>        // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()
+#endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GUI_TEXT_LAYOUT_STEP            4096        // Bytes placed between cancel or time budget checks
+#define GUI_TEXT_LAYOUT_BUDGET          2000        // Default time slice per update in microseconds
+
+// Job state flags are shared with the worker thread
+#if defined(_MSC_VER)
+    #define GUI_TEXT_LAYOUT_LOAD(x)     _InterlockedOr64((volatile long long *)&(x), 0)
+    #define GUI_TEXT_LAYOUT_STORE(x, v) _InterlockedExchange64((volatile long long *)&(x), (v))
+#else
+    #define GUI_TEXT_LAYOUT_LOAD(x)     __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+    #define GUI_TEXT_LAYOUT_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Layout parameters, as submitted
+typedef struct {
+    const char *text;
+    Font font;
+    float fontSize;
+    float spacing;
+    float width;                // Wrap width
+    int wrapMode;               // TEXT_WRAP_NONE, TEXT_WRAP_CHAR, TEXT_WRAP_WORD
+    float advance[128];         // ASCII glyph advances (including spacing)
+} GuiTextLayoutParams;
+
+// Layout lines, lineCount + 1 starts (last one is text end)
+typedef struct {
+    int *lineStarts;
+    float *lineWidths;
+    int lineCount;
+    int capacity;
+    float maxWidth;
+} GuiTextLayoutLines;
+
+struct GuiTextLayoutJob {
+    // Submitted layout and progress, owned by the worker while it runs
+    GuiTextLayoutParams params;
+    GuiTextLayoutLines lines;
+    int offset;                 // Next text byte to place
+    float x;                    // Current line width up to offset
+    int breakOffset;            // Word wrap break offset in current line (after last space), -1 if none
+    float breakX;               // Current line width up to break offset
+
+    // Completed layout, drawn until next one is completed
+    GuiTextLayoutParams readyParams;
+    GuiTextLayoutLines ready;
+
+    long long complete;         // Submitted layout completed (shared)
+    long long cancel;           // Stop request (shared)
+#if !defined(GUI_TEXT_LAYOUT_NO_THREADS)
+#if defined(_WIN32)
+    void *thread;
+    void *lock;                 // SRWLOCK, zero initialized
+    void *signal;               // CONDITION_VARIABLE, zero initialized
+#else
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t signal;
+#endif
+    bool threadActive;          // Worker thread running, waits for jobs until layout is unloaded
+    bool requested;             // Job submitted, not taken by worker yet (locked)
+    bool running;               // Job being placed by worker (locked)
+    bool quit;                  // Worker exit request (locked)
+#endif
+};
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+#if !defined(GUI_TEXT_LAYOUT_NO_THREADS)
+#if defined(_WIN32)
+static unsigned long __stdcall TextLayoutWorker(void *data);
+#else
+static void *TextLayoutWorker(void *data);
+#endif
+static void LockTextLayoutJob(GuiTextLayoutJob *job);
+static void UnlockTextLayoutJob(GuiTextLayoutJob *job);
+static void WaitTextLayoutJob(GuiTextLayoutJob *job);
+static void WakeTextLayoutJob(GuiTextLayoutJob *job);
+#endif
+static void StopTextLayoutJob(GuiTextLayoutJob *job);
+static bool LayoutTextStep(GuiTextLayoutJob *job, int budget);
+static void AddTextLayoutLine(GuiTextLayoutLines *lines, int start, float width);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+GuiTextLayout InitGuiTextLayout(void)
+{
+    GuiTextLayout layout = { 0 };
+
+    layout.budget = GUI_TEXT_LAYOUT_BUDGET;
+    layout.job = (GuiTextLayoutJob *)calloc(1, sizeof(GuiTextLayoutJob));
+
+#if !defined(GUI_TEXT_LAYOUT_NO_THREADS) && !defined(_WIN32)
+    if (layout.job != NULL)
+    {
+        pthread_mutex_init(&layout.job->lock, NULL);
+        pthread_cond_init(&layout.job->signal, NULL);
+    }
+#endif
+
+    return layout;
+}
+
+void UnloadGuiTextLayout(GuiTextLayout *layout)
+{
+    GuiTextLayoutJob *job = layout->job;
+
+    if (job != NULL)
+    {
+        StopTextLayoutJob(job);
+
+#if !defined(GUI_TEXT_LAYOUT_NO_THREADS)
+        if (job->threadActive)
+        {
+            LockTextLayoutJob(job);
+            job->quit = true;
+            WakeTextLayoutJob(job);
+            UnlockTextLayoutJob(job);
+
+        #if defined(_WIN32)
+            WaitForSingleObject(job->thread, 0xFFFFFFFF);
+            CloseHandle(job->thread);
+        #else
+            pthread_join(job->thread, NULL);
+        #endif
+        }
+    #if !defined(_WIN32)
+        pthread_mutex_destroy(&job->lock);
+        pthread_cond_destroy(&job->signal);
+    #endif
+#endif
+        free(job->lines.lineStarts);
+        free(job->lines.lineWidths);
+        free(job->ready.lineStarts);
+        free(job->ready.lineWidths);
+        free(job);
+    }
+
+    GuiTextLayout empty = { 0 };
+    *layout = empty;
+}
+
+// Submit layout job, previous job in progress is cancelled
+// NOTE: Nothing is computed here, layout is done by the worker or UpdateGuiTextLayout() time slices,
+// worker thread is created on first submit and signalled for next jobs
+void SubmitGuiTextLayout(GuiTextLayout *layout, const char *text, Font font, float fontSize, float spacing, float width, int wrapMode)
+{
+    GuiTextLayoutJob *job = layout->job;
+    if (job == NULL) return;
+
+    StopTextLayoutJob(job);
+
+    GuiTextLayoutParams *params = &job->params;
+    params->text = text;
+    params->font = font;
+    params->fontSize = fontSize;
+    params->spacing = spacing;
+    params->width = width;
+    params->wrapMode = wrapMode;
+
+    // ASCII advances looked up once for the whole text
+    float scaleFactor = fontSize/(float)font.baseSize;
+    for (int c = 0; c < 128; c++)
+    {
+        int glyph = GetGlyphIndex(font, (c < 32)? ' ' : c);
+        params->advance[c] = ((font.glyphs[glyph].advanceX != 0)? (float)font.glyphs[glyph].advanceX : font.recs[glyph].width)*scaleFactor + spacing;
+    }
+
+    params->advance['\n'] = 0.0f;
+    params->advance['\r'] = 0.0f;
+
+    job->lines.lineCount = 0;
+    job->lines.maxWidth = 0.0f;
+    AddTextLayoutLine(&job->lines, 0, 0.0f);
+    job->offset = 0;
+    job->x = 0.0f;
+    job->breakOffset = -1;
+    job->breakX = 0.0f;
+    job->complete = 0;
+    job->cancel = 0;
+    layout->pending = (text != NULL);
+
+    if (text == NULL) return;
+
+#if !defined(GUI_TEXT_LAYOUT_NO_THREADS)
+    if (!job->threadActive)
+    {
+    #if defined(_WIN32)
+        job->thread = CreateThread(NULL, 0, TextLayoutWorker, job, 0, NULL);
+        job->threadActive = (job->thread != NULL);
+    #else
+        job->threadActive = (pthread_create(&job->thread, NULL, TextLayoutWorker, job) == 0);
+    #endif
+    }
+
+    if (job->threadActive)
+    {
+        LockTextLayoutJob(job);
+        job->requested = true;
+        WakeTextLayoutJob(job);
+        UnlockTextLayoutJob(job);
+    }
+#endif
+}
+
+// Update layout job: run a time slice (no worker) or check worker completion
+// NOTE: Returns true when a new layout is completed, it replaces the previous one
+bool UpdateGuiTextLayout(GuiTextLayout *layout)
+{
+    GuiTextLayoutJob *job = layout->job;
+    if ((job == NULL) || !layout->pending) return false;
+
+    bool threadActive = false;
+#if !defined(GUI_TEXT_LAYOUT_NO_THREADS)
+    threadActive = job->threadActive;
+#endif
+
+    if (!threadActive)
+    {
+        // Time slice, budget checked every layout step
+        double endTime = GetTime() + (double)layout->budget/1000000.0;
+        while (!LayoutTextStep(job, GUI_TEXT_LAYOUT_STEP) && (GetTime() < endTime)) { }
+    }
+
+    if (!GUI_TEXT_LAYOUT_LOAD(job->complete)) return false;
+
+    StopTextLayoutJob(job);
+
+    // Completed lines become the layout in use, previous buffers are reused by next job
+    GuiTextLayoutLines lines = job->ready;
+    job->ready = job->lines;
+    job->lines = lines;
+    job->readyParams = job->params;
+
+    layout->text = job->readyParams.text;
+    layout->lineCount = job->ready.lineCount;
+    layout->width = job->readyParams.width;
+    layout->contentWidth = job->ready.maxWidth;
+    layout->pending = false;
+
+    return true;
+}
+
+// Get completed layout line text and width, NULL if line is not available
+// NOTE: Line length includes line break and word wrap spaces
+const char *GetGuiTextLayoutLine(const GuiTextLayout *layout, int line, int *length, float *width)
+{
+    GuiTextLayoutJob *job = layout->job;
+    if ((job == NULL) || (line < 0) || (line >= layout->lineCount)) return NULL;
+
+    if (length != NULL) *length = job->ready.lineStarts[line + 1] - job->ready.lineStarts[line];
+    if (width != NULL) *width = job->ready.lineWidths[line];
+
+    return job->readyParams.text + job->ready.lineStarts[line];
+}
+
+// Text layout view control
+// NOTE: Layouts are submitted again when gui font, text size or spacing change and wrapped ones when
+// view width changes, last completed layout is drawn meanwhile, only visible lines are drawn
+void GuiTextLayoutView(Rectangle bounds, GuiTextLayout *layout, Vector2 *scroll)
+{
+    GuiTextLayoutJob *job = layout->job;
+    if (job == NULL) return;
+
+    float padding = (float)GuiGetStyle(TEXTBOX, TEXT_PADDING);
+    float borderWidth = (float)GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    GuiTextLayoutParams *params = (layout->text != NULL)? &job->readyParams : &job->params;
+    float lineHeight = (float)GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+    if (lineHeight < params->fontSize) lineHeight = params->fontSize;
+
+    // Wrap width reserves the vertical scroll bar, so it does not depend on the layout height
+    float wrapWidth = bounds.width - 2*borderWidth - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) - 2*padding;
+
+    // Glyphs are drawn with gui font and text size, layout must use the same ones
+    Font font = GuiGetFont();
+    float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    float spacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    bool styleChanged = ((job->params.font.texture.id != font.texture.id) || (job->params.fontSize != fontSize) || (job->params.spacing != spacing));
+
+    if ((job->params.text != NULL) && (styleChanged || ((job->params.wrapMode != TEXT_WRAP_NONE) && (job->params.width != wrapWidth))))
+    {
+        SubmitGuiTextLayout(layout, job->params.text, font, fontSize, spacing, wrapWidth, job->params.wrapMode);
+    }
+
+    UpdateGuiTextLayout(layout);
+
+    Rectangle content = { 0, 0, wrapWidth + 2*padding, layout->lineCount*lineHeight };
+    if ((params->wrapMode == TEXT_WRAP_NONE) && (layout->contentWidth + 2*padding > content.width)) content.width = layout->contentWidth + 2*padding;
+
+    Rectangle view = { 0 };
+    GuiScrollPanel(bounds, NULL, content, scroll, &view);
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (layout->text == NULL) return;
+
+    float scaleFactor = job->readyParams.fontSize/(float)job->readyParams.font.baseSize;
+    Color textColor = GuiFade(GetColor(GuiGetStyle(TEXTBOX, (GuiGetState() == STATE_DISABLED)? TEXT_COLOR_DISABLED : TEXT_COLOR_NORMAL)), guiAlpha);
+
+    int firstLine = (int)(-scroll->y/lineHeight);
+    if (firstLine < 0) firstLine = 0;
+
+    GuiBeginScissor(view);
+
+    for (int line = firstLine; line < layout->lineCount; line++)
+    {
+        float y = view.y + scroll->y + line*lineHeight;
+        if (y >= view.y + view.height) break;
+
+        int length = 0;
+        const char *text = GetGuiTextLayoutLine(layout, line, &length, NULL);
+        float x = view.x + scroll->x + padding;
+
+        for (int i = 0; (i < length) && (x < view.x + view.width);)
+        {
+            int codepoint = (unsigned char)text[i];
+            int size = 1;
+            float advance = 0.0f;
+
+            if (codepoint < 128) advance = job->readyParams.advance[codepoint];
+            else
+            {
+                codepoint = GetCodepointNext(text + i, &size);
+                int glyph = GetGlyphIndex(job->readyParams.font, codepoint);
+                advance = ((job->readyParams.font.glyphs[glyph].advanceX != 0)? (float)job->readyParams.font.glyphs[glyph].advanceX : job->readyParams.font.recs[glyph].width)*scaleFactor + job->readyParams.spacing;
+            }
+
+            if ((x + advance > view.x) && (codepoint > ' ')) GuiDrawGlyph(codepoint, (Vector2){ x, y + (lineHeight - fontSize)/2 }, textColor);
+
+            x += advance;
+            i += size;
+        }
+    }
+
+    GuiEndScissor();
+    //--------------------------------------------------------------------
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+#if !defined(GUI_TEXT_LAYOUT_NO_THREADS)
+// Layout worker, waits for submitted jobs and places the whole text unless cancelled
+#if defined(_WIN32)
+static unsigned long __stdcall TextLayoutWorker(void *data)
+#else
+static void *TextLayoutWorker(void *data)
+#endif
+{
+    GuiTextLayoutJob *job = (GuiTextLayoutJob *)data;
+
+    LockTextLayoutJob(job);
+
+    while (!job->quit)
+    {
+        if (!job->requested) { WaitTextLayoutJob(job); continue; }
+
+        job->requested = false;
+        job->running = true;
+        UnlockTextLayoutJob(job);
+
+        while (!GUI_TEXT_LAYOUT_LOAD(job->cancel) && !LayoutTextStep(job, GUI_TEXT_LAYOUT_STEP)) { }
+
+        LockTextLayoutJob(job);
+        job->running = false;
+        WakeTextLayoutJob(job);
+    }
+
+    UnlockTextLayoutJob(job);
+
+    return 0;
+}
+
+// Lock job worker state
+static void LockTextLayoutJob(GuiTextLayoutJob *job)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&job->lock);
+#else
+    pthread_mutex_lock(&job->lock);
+#endif
+}
+
+// Unlock job worker state
+static void UnlockTextLayoutJob(GuiTextLayoutJob *job)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(&job->lock);
+#else
+    pthread_mutex_unlock(&job->lock);
+#endif
+}
+
+// Wait for job worker state change, lock must be held
+static void WaitTextLayoutJob(GuiTextLayoutJob *job)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW(&job->signal, &job->lock, 0xFFFFFFFF, 0);
+#else
+    pthread_cond_wait(&job->signal, &job->lock);
+#endif
+}
+
+// Signal job worker state change, lock must be held
+static void WakeTextLayoutJob(GuiTextLayoutJob *job)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(&job->signal);
+#else
+    pthread_cond_broadcast(&job->signal);
+#endif
+}
+#endif
+
+// Stop job in progress (cancelled if not completed), worker keeps waiting for next job
+static void StopTextLayoutJob(GuiTextLayoutJob *job)
+{
+#if !defined(GUI_TEXT_LAYOUT_NO_THREADS)
+    if (job->threadActive)
+    {
+        LockTextLayoutJob(job);
+        GUI_TEXT_LAYOUT_STORE(job->cancel, 1);
+        job->requested = false;
+        while (job->running) WaitTextLayoutJob(job);
+        UnlockTextLayoutJob(job);
+    }
+#else
+    (void)job;
+#endif
+}
+
+// Place up to budget text bytes, breaking lines by wrap mode, returns true when layout is completed
+static bool LayoutTextStep(GuiTextLayoutJob *job, int budget)
+{
+    if (GUI_TEXT_LAYOUT_LOAD(job->complete)) return true;
+
+    const GuiTextLayoutParams *params = &job->params;
+    const char *text = params->text;
+    GuiTextLayoutLines *lines = &job->lines;
+    float scaleFactor = params->fontSize/(float)params->font.baseSize;
+
+    int i = job->offset;
+    int end = i + budget;
+    float x = job->x;
+
+    while ((i < end) && (text[i] != '\0'))
+    {
+        int codepoint = (unsigned char)text[i];
+        int size = 1;
+        float advance = 0.0f;
+
+        if (codepoint == '\n')
+        {
+            AddTextLayoutLine(lines, i + 1, x);
+            x = 0.0f;
+            job->breakOffset = -1;
+            i++;
+            continue;
+        }
+
+        if (codepoint < 128) advance = params->advance[codepoint];
+        else
+        {
+            codepoint = GetCodepointNext(text + i, &size);
+            int glyph = GetGlyphIndex(params->font, codepoint);
+            advance = ((params->font.glyphs[glyph].advanceX != 0)? (float)params->font.glyphs[glyph].advanceX : params->font.recs[glyph].width)*scaleFactor + params->spacing;
+        }
+
+        // Break line when glyph does not fit, a line always gets at least one glyph
+        // NOTE: On word wrap, spaces do not break lines, they stay at the end of the line
+        if ((params->wrapMode != TEXT_WRAP_NONE) && (x + advance > params->width) && (i > lines->lineStarts[lines->lineCount - 1]) &&
+            !((params->wrapMode == TEXT_WRAP_WORD) && (codepoint == ' ')))
+        {
+            if ((params->wrapMode == TEXT_WRAP_WORD) && (job->breakOffset > lines->lineStarts[lines->lineCount - 1]))
+            {
+                // Word moves to next line, spaces before it stay at previous line end
+                AddTextLayoutLine(lines, job->breakOffset, job->breakX);
+                x -= job->breakX;
+            }
+            else
+            {
+                AddTextLayoutLine(lines, i, x);
+                x = 0.0f;
+            }
+
+            job->breakOffset = -1;
+        }
+
+        x += advance;
+        i += size;
+
+        if (codepoint == ' ') { job->breakOffset = i; job->breakX = x; }
+    }
+
+    job->offset = i;
+    job->x = x;
+
+    if (text[i] != '\0') return false;
+
+    // Close last line, last start is text end
+    lines->lineWidths[lines->lineCount - 1] = x;
+    if (x > lines->maxWidth) lines->maxWidth = x;
+    lines->lineStarts[lines->lineCount] = i;
+
+    GUI_TEXT_LAYOUT_STORE(job->complete, 1);
+
+    return true;
+}
+
+// Close current line with its width and start a new line
+// NOTE: Buffers always keep room for the text end start
+static void AddTextLayoutLine(GuiTextLayoutLines *lines, int start, float width)
+{
+    if (lines->lineCount + 2 > lines->capacity)
+    {
+        lines->capacity = (lines->capacity > 0)? lines->capacity*2 : 1024;
+        lines->lineStarts = (int *)realloc(lines->lineStarts, lines->capacity*sizeof(int));
+        lines->lineWidths = (float *)realloc(lines->lineWidths, lines->capacity*sizeof(float));
+    }
+
+    if (lines->lineCount > 0)
+    {
+        lines->lineWidths[lines->lineCount - 1] = width;
+        if (width > lines->maxWidth) lines->maxWidth = width;
+    }
+
+    lines->lineStarts[lines->lineCount++] = start;
+}
+
+#endif // GUI_TEXT_LAYOUT_IMPLEMENTATION
@@ -0,0 +1,115 @@
+/*******************************************************************************************
+*
+*   raygui - asynchronous layout of a large text
+*
+*   DEPENDENCIES:
+*       raylib 5.0  - Windowing/input management and drawing.
+*       raygui 4.5  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   USAGE:
+*       Resize the window, text is wrapped again without blocking frames
+*       Select wrap mode, previous layout is drawn until new one is completed
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+#define GUI_TEXT_LAYOUT_IMPLEMENTATION
+#include "gui_text_layout.h"
+
+#include <stdlib.h>                     // Required for: malloc(), free()
+#include <string.h>                     // Required for: memcpy(), strlen()
+
+#define GENERATED_TEXT_SIZE   (8*1024*1024)   // Generated text size in bytes
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+    InitWindow(screenWidth, screenHeight, "raygui - text layout");
+
+    // Generate a big text, random words and paragraphs
+    const char *words[] = { "lorem", "ipsum", "dolor", "sit", "amet,", "consectetur", "adipiscing", "elit.", "sed", "do", "eiusmod", "tempor" };
+    char *text = (char *)malloc(GENERATED_TEXT_SIZE + 1);
+    int length = 0;
+
+    while (length < GENERATED_TEXT_SIZE - 32)
+    {
+        const char *word = words[GetRandomValue(0, 11)];
+        int wordLength = (int)strlen(word);
+
+        memcpy(text + length, word, wordLength);
+        length += wordLength;
+        text[length++] = (GetRandomValue(0, 80) == 0)? '\n' : ' ';
+    }
+
+    text[length] = '\0';
+
+    GuiTextLayout layout = InitGuiTextLayout();
+    SubmitGuiTextLayout(&layout, text, GuiGetFont(), (float)GuiGetStyle(DEFAULT, TEXT_SIZE), (float)GuiGetStyle(DEFAULT, TEXT_SPACING), 0, TEXT_WRAP_WORD);
+
+    int wrapMode = TEXT_WRAP_WORD;
+    int previousWrapMode = wrapMode;
+    Vector2 scroll = { 0 };
+
+    SetTargetFPS(60);
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (wrapMode != previousWrapMode)
+        {
+            // Width is set by the view on next draw
+            SubmitGuiTextLayout(&layout, text, GuiGetFont(), (float)GuiGetStyle(DEFAULT, TEXT_SIZE), (float)GuiGetStyle(DEFAULT, TEXT_SPACING), 0, wrapMode);
+            previousWrapMode = wrapMode;
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            GuiToggleGroup((Rectangle){ 10, 10, 100, 24 }, "NONE;CHAR;WORD", &wrapMode);
+
+            GuiTextLayoutView((Rectangle){ 10, 44, (float)GetScreenWidth() - 20, (float)GetScreenHeight() - 78 }, &layout, &scroll);
+
+            GuiStatusBar((Rectangle){ 0, (float)GetScreenHeight() - 24, (float)GetScreenWidth(), 24 },
+                TextFormat("%i bytes, %i lines, width %i%s", length, layout.lineCount, (int)layout.width, layout.pending? " (layout pending)" : ""));
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadGuiTextLayout(&layout);
+    free(text);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,1054 @@
+/*******************************************************************************************
+*
+*   Text View v1.0 - Virtualized read-only viewer for huge text documents
+*
+*   MODULE USAGE:
+*       #define GUI_TEXT_VIEW_IMPLEMENTATION
+*       #include "gui_text_view.h"
+*
+*       INIT: GuiTextViewState state = InitGuiTextView();
+*       LOAD: LoadGuiTextViewFile(&state, fileName);      // File is memory mapped, not copied
+*             LoadGuiTextViewChunks(&state, chunks, chunkSizes, chunkCount);
+*       DRAW: GuiTextView(bounds, &state);
+*       FIND: GuiTextViewFindNext(&state, text);           // Search continues in GuiTextView() while state.finding
+*       FREE: UnloadGuiTextView(&state);
+*
+*   DESCRIPTION:
+*       Document bytes are never copied: a file is memory mapped (mmap/CreateFileMapping) and a
+*       chunked buffer is referenced as provided (it must stay valid until UnloadGuiTextView()).
+*       A worker thread scans the document for line breaks and publishes the line offsets index
+*       progressively, so the first screen is available while a multi-gigabyte file is still
+*       being indexed. Only the visible lines are measured and drawn; in wrap mode the visual
+*       rows of every measured line are kept in a small cache keyed by line index and width.
+*       Text search is time-sliced the same way: every GuiTextView() call scans a bounded number
+*       of bytes, so finding a missing word in a huge document never blocks the UI.
+*
+*       Control is drawn with raygui draw functions (gui alpha, state, transform and draw stream
+*       apply), so raygui implementation must be included before in the same translation unit.
+*
+*   CONFIGURATION:
+*       #define GUI_TEXT_VIEW_NO_THREADS
+*           Build the line index incrementally inside GuiTextView() calls instead of using a
+*           worker thread (automatically defined for PLATFORM_WEB)
+*
+*       #define RAYGUI_NO_SIMD
+*           Use scalar code for line break scanning and text search
+*
+*   NOTE: Text is expected to be UTF-8, invalid sequences are displayed as '?'
+*   NOTE: Lines longer than INT_MAX bytes are displayed truncated
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#ifndef GUI_TEXT_VIEW_H
+#define GUI_TEXT_VIEW_H
+
+typedef struct GuiTextViewIndex GuiTextViewIndex;   // Document, line index and caches (internal)
+
+// Gui text view context data
+typedef struct {
+
+    // Document info
+    long long size;             // Document size in bytes
+    long long lineCount;        // Lines available to display (grows while indexing)
+    bool indexed;               // Line index completed
+
+    // View variables
+    bool wrapText;              // Wrap lines to the view width
+    long long topLine;          // First visible line
+    int topRow;                 // First visible wrapped row of topLine (wrap mode)
+    float scrollX;              // Horizontal scroll in pixels (no wrap mode)
+
+    // Search variables
+    long long findOffset;       // Byte offset of last match, -1 if none
+    int findLength;             // Length in bytes of last match
+    bool finding;               // Search in progress, continued by GuiTextView()
+    bool findFailed;            // Last search wrapped around without a match
+
+    GuiTextViewIndex *index;
+
+} GuiTextViewState;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiTextViewState InitGuiTextView(void);
+bool LoadGuiTextViewFile(GuiTextViewState *state, const char *fileName);
+void LoadGuiTextViewChunks(GuiTextViewState *state, const char **chunks, const long long *chunkSizes, int chunkCount);
+void UnloadGuiTextView(GuiTextViewState *state);
+
+void GuiTextView(Rectangle bounds, GuiTextViewState *state);
+bool GuiTextViewFindNext(GuiTextViewState *state, const char *text);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_TEXT_VIEW_H
+
+/***********************************************************************************
+*
+*   GUI_TEXT_VIEW IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(GUI_TEXT_VIEW_IMPLEMENTATION)
+
+#include "../../src/raygui.h"
+
+#include <stdlib.h>     // Required for: calloc(), malloc(), realloc(), free()
+#include <string.h>     // Required for: memchr(), memcmp(), strlen()
+#include <limits.h>     // Required for: INT_MAX
+
+#if defined(PLATFORM_WEB) || defined(__EMSCRIPTEN__)
+    #define GUI_TEXT_VIEW_NO_THREADS
+#endif
+
+#if !defined(RAYGUI_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics
+    #define GUI_TEXT_VIEW_SSE2
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>         // Required for: _BitScanForward(), _InterlockedOr64(), _InterlockedExchange64()
+#endif
+
+#if defined(_WIN32)
+// NOTE: Required Win32 functions are declared manually to avoid windows.h conflicts with raylib
+#if defined(__cplusplus)
+extern "C" {
+#endif
+__declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *security, unsigned long creation, unsigned long flags, void *templateFile);
+__declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+__declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *security, unsigned long protect, unsigned long sizeHigh, unsigned long sizeLow, const char *name);
+__declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+__declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+#if !defined(GUI_TEXT_VIEW_NO_THREADS)
+__declspec(dllimport) void *__stdcall CreateThread(void *security, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+#endif
+#if defined(__cplusplus)
+}
+#endif
+#else
+    #include <fcntl.h>          // Required for: open()
+    #include <unistd.h>         // Required for: close()
+    #include <sys/mman.h>       // Required for: mmap(), munmap()
+    #include <sys/stat.h>       // Required for: fstat()
+    #if !defined(GUI_TEXT_VIEW_NO_THREADS)
+        #include <pthread.h>    // Required for: pthread_create(), pthread_join()
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GUI_TEXT_VIEW_INDEX_BLOCK        65536      // Line offsets per index block
+#define GUI_TEXT_VIEW_SCAN_STEP    (4*1024*1024)    // Bytes scanned between index publications
+#define GUI_TEXT_VIEW_FIND_STEP   (16*1024*1024)    // Bytes searched per GuiTextView() call
+#define GUI_TEXT_VIEW_WRAP_CACHE           256      // Lines with cached wrapped rows
+#define GUI_TEXT_VIEW_TAB_SIZE               4      // Tab width in spaces
+#define GUI_TEXT_VIEW_MAX_SCROLL     4194304.0f     // Max virtual content height for the scroll bar (exact in float)
+
+// Published index counters are shared with the worker thread
+#if defined(_MSC_VER)
+    #define GUI_TEXT_VIEW_LOAD(x)       _InterlockedOr64((volatile long long *)&(x), 0)
+    #define GUI_TEXT_VIEW_STORE(x, v)   _InterlockedExchange64((volatile long long *)&(x), (v))
+#else
+    #define GUI_TEXT_VIEW_LOAD(x)       __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+    #define GUI_TEXT_VIEW_STORE(x, v)   __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Wrapped rows of a line, relative to line start
+typedef struct {
+    long long line;             // Line index, -1 if empty
+    float width;                // Wrap width used
+    int rowCount;
+    int capacity;
+    int *rowStarts;             // Row start offsets from line start
+} GuiTextViewWrap;
+
+struct GuiTextViewIndex {
+    // Document data
+    const char **chunks;        // Document chunks (a mapped file is a single chunk)
+    long long *chunkOffsets;    // Document offset of every chunk, chunkCount + 1 entries
+    int chunkCount;
+    long long size;
+
+    // Mapped file data
+    void *mapData;
+#if defined(_WIN32)
+    void *fileHandle;
+    void *mapHandle;
+#endif
+
+    // Line index, written by the worker and read after a published count
+    long long **blocks;         // Line start offsets in blocks of GUI_TEXT_VIEW_INDEX_BLOCK
+    int blockCount;
+    long long builtCount;       // Lines recorded (worker only)
+    long long scanOffset;       // Next offset to scan (worker only)
+    long long lineCount;        // Lines published (shared)
+    long long complete;         // Indexing finished (shared)
+    long long cancel;           // Stop request (shared)
+#if !defined(GUI_TEXT_VIEW_NO_THREADS)
+#if defined(_WIN32)
+    void *thread;
+#else
+    pthread_t thread;
+#endif
+    bool threadActive;
+#endif
+
+    // Measure cache
+    unsigned int fontId;        // Font texture used to build the advance table
+    float fontSize;
+    float spacing;
+    float advance[128];         // ASCII glyph advances (including spacing)
+    GuiTextViewWrap wrap[GUI_TEXT_VIEW_WRAP_CACHE];
+    float maxLineWidth;         // Widest line measured (no wrap mode content width)
+
+    // Line bytes crossing a chunk boundary are copied here
+    char *lineBuffer;
+    long long lineBufferSize;
+
+    // Search in progress
+    char *findText;             // Searched text copy
+    int findTextLength;
+    long long findStart;        // Offset where search started
+    long long findPosition;     // Next match start offset to check
+    int findPass;               // 0: start to document end, 1: document start to start
+};
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+static void SetupTextViewIndex(GuiTextViewState *state, GuiTextViewIndex *index);
+static void BuildTextViewIndex(GuiTextViewIndex *index, long long budget);
+static long long GetTextViewLineStart(const GuiTextViewIndex *index, long long line);
+static long long GetTextViewLineFromOffset(const GuiTextViewIndex *index, long long count, long long offset);
+static const char *GetTextViewLine(GuiTextViewIndex *index, long long line, int *length);
+static GuiTextViewWrap *GetTextViewWrap(GuiTextViewIndex *index, long long line, float width);
+static bool StepTextViewFind(GuiTextViewState *state, long long budget);
+static long long FindTextViewRange(const GuiTextViewIndex *index, long long from, long long to, const char *text, int length);
+static long long FindTextViewBytes(const char *data, long long size, const char *pattern, int length);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+GuiTextViewState InitGuiTextView(void)
+{
+    GuiTextViewState state = { 0 };
+
+    state.findOffset = -1;
+
+    return state;
+}
+
+// Load text view document from file, mapped in memory (not copied)
+bool LoadGuiTextViewFile(GuiTextViewState *state, const char *fileName)
+{
+    UnloadGuiTextView(state);
+
+    GuiTextViewIndex *index = (GuiTextViewIndex *)calloc(1, sizeof(GuiTextViewIndex));
+    long long size = 0;
+
+#if defined(_WIN32)
+    // GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000003, NULL, 3, 0x80, NULL);
+    if (file == (void *)(long long)-1) { free(index); return false; }
+
+    GetFileSizeEx(file, &size);
+
+    if (size > 0)
+    {
+        // PAGE_READONLY, FILE_MAP_READ
+        index->mapHandle = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL);
+        if (index->mapHandle != NULL) index->mapData = MapViewOfFile(index->mapHandle, 0x0004, 0, 0, 0);
+        if (index->mapData == NULL)
+        {
+            if (index->mapHandle != NULL) CloseHandle(index->mapHandle);
+            CloseHandle(file);
+            free(index);
+            return false;
+        }
+    }
+
+    index->fileHandle = file;
+#else
+    int file = open(fileName, O_RDONLY);
+    if (file < 0) { free(index); return false; }
+
+    struct stat info = { 0 };
+    if (fstat(file, &info) == 0) size = (long long)info.st_size;
+
+    if (size > 0)
+    {
+        index->mapData = mmap(NULL, (size_t)size, PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (index->mapData == MAP_FAILED)
+        {
+            close(file);
+            free(index);
+            return false;
+        }
+
+    #if defined(POSIX_MADV_SEQUENTIAL)
+        posix_madvise(index->mapData, (size_t)size, POSIX_MADV_SEQUENTIAL);
+    #endif
+    }
+
+    close(file);        // Mapping keeps a reference to the file
+#endif
+
+    index->chunkCount = (size > 0)? 1 : 0;
+    index->chunks = (const char **)calloc(1, sizeof(const char *));
+    index->chunkOffsets = (long long *)calloc(2, sizeof(long long));
+    index->chunks[0] = (const char *)index->mapData;
+    index->chunkOffsets[1] = size;
+    index->size = size;
+
+    SetupTextViewIndex(state, index);
+
+    return true;
+}
+
+// Load text view document from a chunked buffer
+// NOTE: Chunks are referenced, not copied, they must remain valid until UnloadGuiTextView()
+void LoadGuiTextViewChunks(GuiTextViewState *state, const char **chunks, const long long *chunkSizes, int chunkCount)
+{
+    UnloadGuiTextView(state);
+
+    GuiTextViewIndex *index = (GuiTextViewIndex *)calloc(1, sizeof(GuiTextViewIndex));
+
+    index->chunks = (const char **)calloc(chunkCount + 1, sizeof(const char *));
+    index->chunkOffsets = (long long *)calloc(chunkCount + 2, sizeof(long long));
+
+    // Empty chunks are skipped, so every chunk holds at least one byte
+    for (int i = 0; i < chunkCount; i++)
+    {
+        if (chunkSizes[i] <= 0) continue;
+
+        index->chunks[index->chunkCount] = chunks[i];
+        index->chunkOffsets[index->chunkCount + 1] = index->chunkOffsets[index->chunkCount] + chunkSizes[i];
+        index->chunkCount++;
+    }
+
+    index->size = index->chunkOffsets[index->chunkCount];
+
+    SetupTextViewIndex(state, index);
+}
+
+// Unload text view document, stopping the indexing worker
+void UnloadGuiTextView(GuiTextViewState *state)
+{
+    GuiTextViewIndex *index = state->index;
+
+    if (index != NULL)
+    {
+#if !defined(GUI_TEXT_VIEW_NO_THREADS)
+        if (index->threadActive)
+        {
+            GUI_TEXT_VIEW_STORE(index->cancel, 1);
+    #if defined(_WIN32)
+            WaitForSingleObject(index->thread, 0xFFFFFFFF);
+            CloseHandle(index->thread);
+    #else
+            pthread_join(index->thread, NULL);
+    #endif
+        }
+#endif
+        if (index->mapData != NULL)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(index->mapData);
+            CloseHandle(index->mapHandle);
+#else
+            munmap(index->mapData, (size_t)index->size);
+#endif
+        }
+#if defined(_WIN32)
+        if (index->fileHandle != NULL) CloseHandle(index->fileHandle);
+#endif
+        for (int i = 0; i < index->blockCount; i++) free(index->blocks[i]);
+        for (int i = 0; i < GUI_TEXT_VIEW_WRAP_CACHE; i++) free(index->wrap[i].rowStarts);
+
+        free(index->blocks);
+        free(index->chunks);
+        free(index->chunkOffsets);
+        free(index->lineBuffer);
+        free(index->findText);
+        free(index);
+    }
+
+    bool wrapText = state->wrapText;
+    *state = InitGuiTextView();
+    state->wrapText = wrapText;
+}
+
+// Text view control
+void GuiTextView(Rectangle bounds, GuiTextViewState *state)
+{
+    GuiTextViewIndex *index = state->index;
+
+    // Update index and document info
+    //--------------------------------------------------------------------
+    if (index != NULL)
+    {
+#if defined(GUI_TEXT_VIEW_NO_THREADS)
+        if (!index->complete) BuildTextViewIndex(index, GUI_TEXT_VIEW_SCAN_STEP*4);
+#endif
+        state->indexed = (GUI_TEXT_VIEW_LOAD(index->complete) != 0);
+
+        if (state->finding) StepTextViewFind(state, GUI_TEXT_VIEW_FIND_STEP);
+
+        // Last recorded line is only available once its end is known
+        state->lineCount = GUI_TEXT_VIEW_LOAD(index->lineCount);
+        if (!state->indexed && (state->lineCount > 0)) state->lineCount--;
+    }
+    //--------------------------------------------------------------------
+
+    Font font = GuiGetFont();
+    float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    float spacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    float lineHeight = (float)GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+    if (lineHeight < fontSize) lineHeight = fontSize;
+
+    if (index != NULL)
+    {
+        // Rebuild ASCII advances table and flush wrap cache on font change
+        if ((index->fontId != font.texture.id) || (index->fontSize != fontSize) || (index->spacing != spacing))
+        {
+            float scaleFactor = fontSize/(float)font.baseSize;
+
+            for (int c = 0; c < 128; c++)
+            {
+                int glyph = GetGlyphIndex(font, (c < 32)? ' ' : c);
+                float advance = (font.glyphs[glyph].advanceX != 0)? (float)font.glyphs[glyph].advanceX : font.recs[glyph].width;
+                index->advance[c] = advance*scaleFactor + spacing;
+            }
+
+            index->advance['\t'] = index->advance[' ']*GUI_TEXT_VIEW_TAB_SIZE;
+            index->fontId = font.texture.id;
+            index->fontSize = fontSize;
+            index->spacing = spacing;
+            index->maxLineWidth = 0;
+
+            for (int i = 0; i < GUI_TEXT_VIEW_WRAP_CACHE; i++) index->wrap[i].line = -1;
+        }
+    }
+
+    // Compute scroll panel content from the current top position
+    // NOTE: Lines can be billions of pixels tall in total, scroll bar uses a clamped virtual height
+    long long lineCount = state->lineCount;
+    float viewHeight = bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    long long visibleLines = (long long)(viewHeight/lineHeight);
+    if (visibleLines < 1) visibleLines = 1;
+
+    long long maxTopLine = state->wrapText? lineCount - 1 : lineCount - visibleLines;
+    if (maxTopLine < 0) maxTopLine = 0;
+    if (state->topLine > maxTopLine) { state->topLine = maxTopLine; state->topRow = 0; }
+    if (state->topLine < 0) state->topLine = 0;
+
+    float contentHeight = (float)lineCount*lineHeight;
+    if (contentHeight > GUI_TEXT_VIEW_MAX_SCROLL) contentHeight = GUI_TEXT_VIEW_MAX_SCROLL;
+    float scrollRange = contentHeight - viewHeight;
+
+    Rectangle content = { 0, 0, bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH), contentHeight };
+    if (!state->wrapText && (index != NULL) && (index->maxLineWidth > content.width)) content.width = index->maxLineWidth;
+
+    Vector2 scroll = { -state->scrollX, 0.0f };
+    if ((scrollRange > 0) && (maxTopLine > 0)) scroll.y = -(float)((double)state->topLine/(double)maxTopLine*scrollRange);
+    float prevScrollY = scroll.y;
+
+    Rectangle view = { 0 };
+    GuiScrollPanel(bounds, NULL, content, &scroll, &view);
+
+    // Update control
+    //--------------------------------------------------------------------
+    int rowMove = 0;
+
+    if ((GuiGetState() != STATE_DISABLED) && !GuiIsLocked() && !guiControlExclusiveMode && CheckCollisionPointRec(GetTransformedMousePosition(), bounds))
+    {
+        float wheel = GetMouseWheelMove();
+
+        // Vertical wheel scrolling moves by rows instead of virtual pixels
+        if ((wheel != 0) && !IsKeyDown(KEY_LEFT_CONTROL) && !IsKeyDown(KEY_LEFT_SHIFT)) { rowMove = -(int)(wheel*3); scroll.y = prevScrollY; }
+
+        if (IsKeyPressed(KEY_DOWN) || IsKeyPressedRepeat(KEY_DOWN)) rowMove++;
+        if (IsKeyPressed(KEY_UP) || IsKeyPressedRepeat(KEY_UP)) rowMove--;
+        if (IsKeyPressed(KEY_PAGE_DOWN) || IsKeyPressedRepeat(KEY_PAGE_DOWN)) rowMove += (int)visibleLines - 1;
+        if (IsKeyPressed(KEY_PAGE_UP) || IsKeyPressedRepeat(KEY_PAGE_UP)) rowMove -= (int)visibleLines - 1;
+        if (IsKeyPressed(KEY_HOME) && IsKeyDown(KEY_LEFT_CONTROL)) { state->topLine = 0; state->topRow = 0; }
+        if (IsKeyPressed(KEY_END) && IsKeyDown(KEY_LEFT_CONTROL)) { state->topLine = maxTopLine; state->topRow = 0; }
+    }
+
+    // Scroll bar dragged: map virtual position back to a line
+    if ((scroll.y != prevScrollY) && (scrollRange > 0))
+    {
+        state->topLine = (long long)((double)-scroll.y/scrollRange*(double)maxTopLine + 0.5);
+        state->topRow = 0;
+    }
+
+    state->scrollX = -scroll.x;
+
+    if ((index != NULL) && (rowMove != 0))
+    {
+        if (state->wrapText)
+        {
+            for (; rowMove > 0; rowMove--)
+            {
+                GuiTextViewWrap *wrap = GetTextViewWrap(index, state->topLine, view.width);
+                if (state->topRow + 1 < wrap->rowCount) state->topRow++;
+                else if (state->topLine < maxTopLine) { state->topLine++; state->topRow = 0; }
+                else break;
+            }
+
+            for (; rowMove < 0; rowMove++)
+            {
+                if (state->topRow > 0) state->topRow--;
+                else if (state->topLine > 0)
+                {
+                    state->topLine--;
+                    state->topRow = GetTextViewWrap(index, state->topLine, view.width)->rowCount - 1;
+                }
+                else break;
+            }
+        }
+        else
+        {
+            state->topLine += rowMove;
+            if (state->topLine > maxTopLine) state->topLine = maxTopLine;
+            if (state->topLine < 0) state->topLine = 0;
+        }
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if ((index == NULL) || (lineCount == 0)) return;
+
+    Color textColor = GuiFade(GetColor(GuiGetStyle(TEXTBOX, (GuiGetState() == STATE_DISABLED)? TEXT_COLOR_DISABLED : TEXT_COLOR_NORMAL)), guiAlpha);
+    Color findColor = Fade(GetColor(GuiGetStyle(TEXTBOX, BORDER_COLOR_PRESSED)), 0.4f);
+    float scaleFactor = fontSize/(float)font.baseSize;
+    float padding = (float)GuiGetStyle(TEXTBOX, TEXT_PADDING);
+
+    GuiBeginScissor(view);
+
+    long long line = state->topLine;
+    int row = state->wrapText? state->topRow : 0;
+    float y = view.y;
+
+    while ((y < view.y + view.height) && (line < lineCount))
+    {
+        // NOTE: Wrap measure can reuse the line buffer, so it goes before getting line bytes
+        GuiTextViewWrap *wrap = state->wrapText? GetTextViewWrap(index, line, view.width) : NULL;
+        if ((wrap != NULL) && (row >= wrap->rowCount)) row = wrap->rowCount - 1;
+
+        int length = 0;
+        const char *text = GetTextViewLine(index, line, &length);
+        long long lineStart = GetTextViewLineStart(index, line);
+        if ((length > 0) && (text[length - 1] == '\r')) length--;
+
+        int rowStart = (wrap != NULL)? wrap->rowStarts[row] : 0;
+        int rowEnd = ((wrap != NULL) && (row + 1 < wrap->rowCount))? wrap->rowStarts[row + 1] : length;
+
+        float x = view.x + padding - (state->wrapText? 0 : state->scrollX);
+        float lineWidth = 0;
+
+        for (int i = rowStart; i < rowEnd;)
+        {
+            int codepoint = (unsigned char)text[i];
+            int size = 1;
+            float advance = 0;
+
+            if (codepoint < 128) advance = index->advance[codepoint];
+            else
+            {
+                // Decode UTF-8 sequence, bounded to row end
+                if (((codepoint & 0xe0) == 0xc0) && (i + 1 < rowEnd)) { codepoint = ((codepoint & 0x1f) << 6) | (text[i + 1] & 0x3f); size = 2; }
+                else if (((codepoint & 0xf0) == 0xe0) && (i + 2 < rowEnd)) { codepoint = ((codepoint & 0x0f) << 12) | ((text[i + 1] & 0x3f) << 6) | (text[i + 2] & 0x3f); size = 3; }
+                else if (((codepoint & 0xf8) == 0xf0) && (i + 3 < rowEnd)) { codepoint = ((codepoint & 0x07) << 18) | ((text[i + 1] & 0x3f) << 12) | ((text[i + 2] & 0x3f) << 6) | (text[i + 3] & 0x3f); size = 4; }
+                else codepoint = '?';
+
+                int glyph = GetGlyphIndex(font, codepoint);
+                advance = ((font.glyphs[glyph].advanceX != 0)? (float)font.glyphs[glyph].advanceX : font.recs[glyph].width)*scaleFactor + spacing;
+            }
+
+            // Highlight last find match
+            long long offset = lineStart + i;
+            if ((state->findOffset >= 0) && (offset >= state->findOffset) && (offset < state->findOffset + state->findLength))
+            {
+                GuiDrawRectangle((Rectangle){ x, y, advance, lineHeight }, 0, BLANK, findColor);
+            }
+
+            // Only glyphs inside the view are drawn, measure continues for the scroll width
+            if ((x + advance > view.x) && (x < view.x + view.width) && (codepoint > ' '))
+            {
+                GuiDrawGlyph(codepoint, (Vector2){ x, y + (lineHeight - fontSize)/2 }, textColor);
+            }
+            else if (x >= view.x + view.width)
+            {
+                // Rest of the line is not visible, its width is estimated for the scroll bar
+                lineWidth += (float)(rowEnd - i)*index->advance['n'];
+                break;
+            }
+
+            x += advance;
+            lineWidth += advance;
+            i += size;
+        }
+
+        if (!state->wrapText && (lineWidth + 2*padding > index->maxLineWidth)) index->maxLineWidth = lineWidth + 2*padding;
+
+        y += lineHeight;
+
+        if (state->wrapText && (row + 1 < wrap->rowCount)) row++;
+        else { line++; row = 0; }
+    }
+
+    GuiEndScissor();
+    //--------------------------------------------------------------------
+}
+
+// Find next occurrence of text after last match (or from top line), wrapping around document end
+// NOTE: Search is time-sliced, returns true if a match is found right away, otherwise it continues
+// inside GuiTextView() calls while state->finding; match is highlighted and scrolled into view
+bool GuiTextViewFindNext(GuiTextViewState *state, const char *text)
+{
+    GuiTextViewIndex *index = state->index;
+    int length = (text != NULL)? (int)strlen(text) : 0;
+
+    state->findFailed = false;
+
+    if ((index == NULL) || (length == 0) || (length > index->size)) { state->finding = false; return false; }
+
+    // Same search requested again while in progress, just keep searching
+    bool pending = state->finding && (index->findTextLength == length) && (memcmp(index->findText, text, length) == 0);
+
+    if (!pending)
+    {
+        index->findText = (char *)realloc(index->findText, length);
+        memcpy(index->findText, text, length);
+        index->findTextLength = length;
+        index->findStart = (state->findOffset >= 0)? state->findOffset + 1 : GetTextViewLineStart(index, state->topLine);
+        index->findPosition = index->findStart;
+        index->findPass = 0;
+        state->finding = true;
+    }
+
+    return StepTextViewFind(state, GUI_TEXT_VIEW_FIND_STEP);
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+#if !defined(GUI_TEXT_VIEW_NO_THREADS)
+// Indexing worker, scans the whole document unless cancelled
+#if defined(_WIN32)
+static unsigned long __stdcall TextViewIndexWorker(void *data)
+#else
+static void *TextViewIndexWorker(void *data)
+#endif
+{
+    GuiTextViewIndex *index = (GuiTextViewIndex *)data;
+
+    while (!GUI_TEXT_VIEW_LOAD(index->complete) && !GUI_TEXT_VIEW_LOAD(index->cancel)) BuildTextViewIndex(index, GUI_TEXT_VIEW_SCAN_STEP);
+
+    return 0;
+}
+#endif
+
+// Attach document to state and start indexing
+static void SetupTextViewIndex(GuiTextViewState *state, GuiTextViewIndex *index)
+{
+    // Lines can not exceed size + 1, so block table never grows while the worker writes it
+    index->blockCount = (int)((index->size + 1)/GUI_TEXT_VIEW_INDEX_BLOCK + 1);
+    index->blocks = (long long **)calloc(index->blockCount, sizeof(long long *));
+    index->blocks[0] = (long long *)malloc(GUI_TEXT_VIEW_INDEX_BLOCK*sizeof(long long));
+    index->blocks[0][0] = 0;
+    index->builtCount = 1;
+
+    for (int i = 0; i < GUI_TEXT_VIEW_WRAP_CACHE; i++) index->wrap[i].line = -1;
+
+    state->index = index;
+    state->size = index->size;
+
+#if !defined(GUI_TEXT_VIEW_NO_THREADS)
+    // Small documents are indexed right away
+    if (index->size > GUI_TEXT_VIEW_SCAN_STEP)
+    {
+    #if defined(_WIN32)
+        index->thread = CreateThread(NULL, 0, TextViewIndexWorker, index, 0, NULL);
+        index->threadActive = (index->thread != NULL);
+    #else
+        index->threadActive = (pthread_create(&index->thread, NULL, TextViewIndexWorker, index) == 0);
+    #endif
+    }
+
+    if (!index->threadActive) BuildTextViewIndex(index, index->size + 1);
+#endif
+}
+
+// Scan up to budget bytes for line breaks, publishing recorded lines
+static void BuildTextViewIndex(GuiTextViewIndex *index, long long budget)
+{
+    long long offset = index->scanOffset;
+    long long end = offset + budget;
+    if (end > index->size) end = index->size;
+
+    int c = 0;
+    while ((c < index->chunkCount) && (index->chunkOffsets[c + 1] <= offset)) c++;
+
+    for (; (c < index->chunkCount) && (offset < end); c++)
+    {
+        const char *data = index->chunks[c];
+        long long base = index->chunkOffsets[c];
+        long long i = offset - base;
+        long long size = ((end < index->chunkOffsets[c + 1])? end : index->chunkOffsets[c + 1]) - base;
+
+        #define GUI_TEXT_VIEW_ADD_LINE(start) { \
+            long long line = index->builtCount++; \
+            long long *block = index->blocks[line/GUI_TEXT_VIEW_INDEX_BLOCK]; \
+            if (block == NULL) block = index->blocks[line/GUI_TEXT_VIEW_INDEX_BLOCK] = (long long *)malloc(GUI_TEXT_VIEW_INDEX_BLOCK*sizeof(long long)); \
+            block[line%GUI_TEXT_VIEW_INDEX_BLOCK] = (start); }
+
+#if defined(GUI_TEXT_VIEW_SSE2)
+        // Compare 16 bytes at once, every set mask bit is a line break
+        const __m128i newLine = _mm_set1_epi8('\n');
+
+        for (; i + 16 <= size; i += 16)
+        {
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(data + i)), newLine));
+
+            while (mask != 0)
+            {
+    #if defined(_MSC_VER)
+                unsigned long bit = 0;
+                _BitScanForward(&bit, mask);
+    #else
+                int bit = __builtin_ctz(mask);
+    #endif
+                GUI_TEXT_VIEW_ADD_LINE(base + i + bit + 1);
+                mask &= mask - 1;
+            }
+        }
+#endif
+        for (; i < size; i++)
+        {
+            const char *next = (const char *)memchr(data + i, '\n', (size_t)(size - i));
+            if (next == NULL) { i = size; break; }
+
+            i = next - data;
+            GUI_TEXT_VIEW_ADD_LINE(base + i + 1);
+        }
+
+        #undef GUI_TEXT_VIEW_ADD_LINE
+
+        offset = base + i;
+    }
+
+    index->scanOffset = offset;
+    GUI_TEXT_VIEW_STORE(index->lineCount, index->builtCount);
+    if (offset >= index->size) GUI_TEXT_VIEW_STORE(index->complete, 1);
+}
+
+// Get document offset where line starts
+static long long GetTextViewLineStart(const GuiTextViewIndex *index, long long line)
+{
+    return index->blocks[line/GUI_TEXT_VIEW_INDEX_BLOCK][line%GUI_TEXT_VIEW_INDEX_BLOCK];
+}
+
+// Get line containing offset, binary search over count published lines
+static long long GetTextViewLineFromOffset(const GuiTextViewIndex *index, long long count, long long offset)
+{
+    long long low = 0;
+    long long high = count - 1;
+
+    while (low < high)
+    {
+        long long mid = low + (high - low + 1)/2;
+        if (GetTextViewLineStart(index, mid) <= offset) low = mid;
+        else high = mid - 1;
+    }
+
+    return low;
+}
+
+// Get line bytes without line break, contiguous in memory
+// NOTE: Lines inside one chunk point into the document, lines crossing chunks are copied
+static const char *GetTextViewLine(GuiTextViewIndex *index, long long line, int *length)
+{
+    long long start = GetTextViewLineStart(index, line);
+    long long end = index->size;
+    if (line + 1 < GUI_TEXT_VIEW_LOAD(index->lineCount)) end = GetTextViewLineStart(index, line + 1) - 1;
+
+    // NOTE: Lines longer than INT_MAX bytes are truncated
+    if (end - start > INT_MAX) end = start + INT_MAX;
+
+    *length = (int)(end - start);
+    if (*length <= 0) { *length = 0; return ""; }
+
+    int c = 0;
+    while (index->chunkOffsets[c + 1] <= start) c++;
+
+    if (end <= index->chunkOffsets[c + 1]) return index->chunks[c] + (start - index->chunkOffsets[c]);
+
+    if (index->lineBufferSize < *length)
+    {
+        index->lineBufferSize = *length;
+        index->lineBuffer = (char *)realloc(index->lineBuffer, (size_t)*length);
+    }
+
+    for (long long copied = 0; copied < *length; c++)
+    {
+        long long from = start + copied - index->chunkOffsets[c];
+        long long size = index->chunkOffsets[c + 1] - index->chunkOffsets[c] - from;
+        if (size > *length - copied) size = *length - copied;
+
+        memcpy(index->lineBuffer + copied, index->chunks[c] + from, (size_t)size);
+        copied += size;
+    }
+
+    return index->lineBuffer;
+}
+
+// Get wrapped rows of a line for the provided width, from cache when possible
+static GuiTextViewWrap *GetTextViewWrap(GuiTextViewIndex *index, long long line, float width)
+{
+    GuiTextViewWrap *wrap = &index->wrap[line%GUI_TEXT_VIEW_WRAP_CACHE];
+    if ((wrap->line == line) && (wrap->width == width)) return wrap;
+
+    int length = 0;
+    const char *text = GetTextViewLine(index, line, &length);
+
+    Font font = GuiGetFont();
+    float scaleFactor = index->fontSize/(float)font.baseSize;
+    float spacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    float maxWidth = width - 2*GuiGetStyle(TEXTBOX, TEXT_PADDING);
+
+    wrap->line = line;
+    wrap->width = width;
+    wrap->rowCount = 0;
+
+    int rowStart = 0;
+    int lastSpace = -1;
+    float rowWidth = 0;
+
+    for (int i = 0; i <= length;)
+    {
+        if ((wrap->rowCount + 1) >= wrap->capacity)
+        {
+            wrap->capacity = (wrap->capacity == 0)? 8 : wrap->capacity*2;
+            wrap->rowStarts = (int *)realloc(wrap->rowStarts, wrap->capacity*sizeof(int));
+        }
+
+        if (i == length) { wrap->rowStarts[wrap->rowCount++] = rowStart; break; }
+
+        int codepoint = (unsigned char)text[i];
+        int size = 1;
+        float advance = 0;
+
+        if (codepoint < 128) advance = index->advance[codepoint];
+        else
+        {
+            if (((codepoint & 0xe0) == 0xc0) && (i + 1 < length)) { codepoint = ((codepoint & 0x1f) << 6) | (text[i + 1] & 0x3f); size = 2; }
+            else if (((codepoint & 0xf0) == 0xe0) && (i + 2 < length)) { codepoint = ((codepoint & 0x0f) << 12) | ((text[i + 1] & 0x3f) << 6) | (text[i + 2] & 0x3f); size = 3; }
+            else if (((codepoint & 0xf8) == 0xf0) && (i + 3 < length)) { codepoint = ((codepoint & 0x07) << 18) | ((text[i + 1] & 0x3f) << 12) | ((text[i + 2] & 0x3f) << 6) | (text[i + 3] & 0x3f); size = 4; }
+            else codepoint = '?';
+
+            int glyph = GetGlyphIndex(font, codepoint);
+            advance = ((font.glyphs[glyph].advanceX != 0)? (float)font.glyphs[glyph].advanceX : font.recs[glyph].width)*scaleFactor + spacing;
+        }
+
+        if ((rowWidth + advance > maxWidth) && (i > rowStart))
+        {
+            // Break after last space in row when possible, otherwise at current glyph
+            int next = (lastSpace >= rowStart)? lastSpace + 1 : i;
+
+            wrap->rowStarts[wrap->rowCount++] = rowStart;
+            rowStart = next;
+            lastSpace = -1;
+            rowWidth = 0;
+            i = next;
+            continue;
+        }
+
+        if ((codepoint == ' ') || (codepoint == '\t')) lastSpace = i;
+
+        rowWidth += advance;
+        i += size;
+    }
+
+    return wrap;
+}
+
+// Continue search in progress for up to budget bytes, true if a match is found
+static bool StepTextViewFind(GuiTextViewState *state, long long budget)
+{
+    GuiTextViewIndex *index = state->index;
+    int length = index->findTextLength;
+    long long found = -1;
+
+    while ((found < 0) && (budget > 0) && (index->findPass < 2))
+    {
+        // Pass range of match starts, second pass wraps around up to search start
+        long long passEnd = (index->findPass == 0)? index->size - length + 1 : index->findStart;
+        if (passEnd > index->size - length + 1) passEnd = index->size - length + 1;
+
+        long long sliceEnd = ((passEnd - index->findPosition) > budget)? index->findPosition + budget : passEnd;
+
+        if (sliceEnd > index->findPosition)
+        {
+            // Matches starting inside the slice can end after it
+            found = FindTextViewRange(index, index->findPosition, sliceEnd + length - 1, index->findText, length);
+            budget -= sliceEnd - index->findPosition;
+            index->findPosition = sliceEnd;
+        }
+
+        if ((found < 0) && (index->findPosition >= passEnd)) { index->findPass++; index->findPosition = 0; }
+    }
+
+    if (found < 0)
+    {
+        if (index->findPass >= 2) { state->finding = false; state->findFailed = true; }
+        return false;
+    }
+
+    state->finding = false;
+    state->findOffset = found;
+    state->findLength = length;
+
+    // Scroll match line into view (when already indexed)
+    long long count = GUI_TEXT_VIEW_LOAD(index->lineCount);
+    if ((count > 0) && (found >= GetTextViewLineStart(index, count - 1)) && !GUI_TEXT_VIEW_LOAD(index->complete)) return true;
+
+    state->topLine = GetTextViewLineFromOffset(index, count, found);
+    state->topRow = 0;
+
+    if (state->wrapText)
+    {
+        GuiTextViewWrap *wrap = NULL;
+        for (int i = 0; i < GUI_TEXT_VIEW_WRAP_CACHE; i++) if (index->wrap[i].line == state->topLine) wrap = &index->wrap[i];
+
+        // Keep match row visible inside long wrapped lines
+        if (wrap != NULL)
+        {
+            long long offset = found - GetTextViewLineStart(index, state->topLine);
+            while ((state->topRow + 1 < wrap->rowCount) && (wrap->rowStarts[state->topRow + 1] <= offset)) state->topRow++;
+        }
+    }
+
+    return true;
+}
+
+// Find first occurrence of text fully contained in document range [from, to), -1 if not found
+static long long FindTextViewRange(const GuiTextViewIndex *index, long long from, long long to, const char *text, int length)
+{
+    if (to > index->size) to = index->size;
+
+    for (int c = 0; c < index->chunkCount; c++)
+    {
+        long long chunkStart = index->chunkOffsets[c];
+        long long chunkEnd = index->chunkOffsets[c + 1];
+        if ((chunkEnd <= from) || (chunkStart >= to)) continue;
+
+        // Search inside chunk
+        long long begin = (from > chunkStart)? from : chunkStart;
+        long long end = (to < chunkEnd)? to : chunkEnd;
+        long long pos = FindTextViewBytes(index->chunks[c] + (begin - chunkStart), end - begin, text, length);
+        if (pos >= 0) return begin + pos;
+
+        // Search matches crossing the chunk end, byte by byte
+        for (long long p = ((chunkEnd - length + 1) > begin)? chunkEnd - length + 1 : begin; (p < chunkEnd) && (p + length <= to); p++)
+        {
+            int i = 0;
+            int k = c;
+            for (; i < length; i++)
+            {
+                while (p + i >= index->chunkOffsets[k + 1]) k++;
+                if (index->chunks[k][p + i - index->chunkOffsets[k]] != text[i]) break;
+            }
+
+            if (i == length) return p;
+        }
+    }
+
+    return -1;
+}
+
+// Find first occurrence of pattern in data, -1 if not found
+// NOTE: SSE2 path filters candidates comparing first and last pattern bytes 16 positions at once
+static long long FindTextViewBytes(const char *data, long long size, const char *pattern, int length)
+{
+    long long i = 0;
+
+    if (size < length) return -1;
+
+#if defined(GUI_TEXT_VIEW_SSE2)
+    if (length > 1)
+    {
+        const __m128i first = _mm_set1_epi8(pattern[0]);
+        const __m128i last = _mm_set1_epi8(pattern[length - 1]);
+
+        for (; i + length - 1 + 16 <= size; i += 16)
+        {
+            __m128i blockFirst = _mm_loadu_si128((const __m128i *)(data + i));
+            __m128i blockLast = _mm_loadu_si128((const __m128i *)(data + i + length - 1));
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)));
+
+            while (mask != 0)
+            {
+    #if defined(_MSC_VER)
+                unsigned long bit = 0;
+                _BitScanForward(&bit, mask);
+    #else
+                int bit = __builtin_ctz(mask);
+    #endif
+                if (memcmp(data + i + bit + 1, pattern + 1, length - 2) == 0) return i + bit;
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+
+    while (i + length <= size)
+    {
+        const char *next = (const char *)memchr(data + i, pattern[0], (size_t)(size - length + 1 - i));
+        if (next == NULL) break;
+
+        i = next - data;
+        if (memcmp(data + i, pattern, length) == 0) return i;
+        i++;
+    }
+
+    return -1;
+}
+
+#endif // GUI_TEXT_VIEW_IMPLEMENTATION
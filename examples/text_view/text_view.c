@@ -0,0 +1,95 @@
+/*******************************************************************************************
+*
+*   raygui - text view for huge text files
+*
+*   DEPENDENCIES:
+*       raylib 5.0  - Windowing/input management and drawing.
+*       raygui 4.5  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   USAGE:
+*       Drop a text file into the window (or pass it as first argument) to view it
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+#define GUI_TEXT_VIEW_IMPLEMENTATION
+#include "gui_text_view.h"
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 560;
+
+    InitWindow(screenWidth, screenHeight, "raygui - text view");
+
+    GuiTextViewState textViewState = InitGuiTextView();
+    LoadGuiTextViewFile(&textViewState, (argc > 1)? argv[1] : __FILE__);
+
+    char findText[128] = { 0 };
+    bool findEditMode = false;
+
+    SetTargetFPS(60);
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsFileDropped())
+        {
+            FilePathList droppedFiles = LoadDroppedFiles();
+
+            if (droppedFiles.count > 0) LoadGuiTextViewFile(&textViewState, droppedFiles.paths[0]);
+
+            UnloadDroppedFiles(droppedFiles);
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            GuiTextView((Rectangle){ 10, 40, (float)screenWidth - 20, (float)screenHeight - 80 }, &textViewState);
+
+            GuiCheckBox((Rectangle){ 10, 12, 16, 16 }, "Wrap lines", &textViewState.wrapText);
+
+            if (GuiTextBox((Rectangle){ 420, 8, 250, 24 }, findText, 128, findEditMode)) findEditMode = !findEditMode;
+            if (GuiButton((Rectangle){ 680, 8, 110, 24 }, "Find next")) GuiTextViewFindNext(&textViewState, findText);
+
+            GuiStatusBar((Rectangle){ 0, (float)screenHeight - 30, (float)screenWidth, 30 },
+                TextFormat("%lld bytes, %lld lines%s%s", textViewState.size, textViewState.lineCount,
+                    textViewState.indexed? "" : " (indexing...)", textViewState.finding? " - searching..." : textViewState.findFailed? " - text not found" : ""));
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadGuiTextView(&textViewState);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
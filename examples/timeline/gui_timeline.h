@@ -0,0 +1,649 @@
+/*******************************************************************************************
+*
+*   Timeline v1.0 - Tracks and clips sequencer control with interval index
+*
+*   MODULE USAGE:
+*       #define GUI_TIMELINE_IMPLEMENTATION
+*       #include "gui_timeline.h"
+*
+*       INIT: GuiTimelineState state = InitGuiTimeline(trackCount, duration);
+*       EDIT: int clip = GuiTimelineAddClip(&state, track, start, length, text);
+*             GuiTimelineMoveClip(&state, clip, track, start, length);
+*             GuiTimelineRemoveClip(&state, clip);
+*       DRAW: GuiTimeline(bounds, &state);
+*       FIND: int count = GuiTimelineQueryClips(&state, track, start, end, clips, maxClips);
+*       FREE: UnloadGuiTimeline(&state);
+*
+*   DESCRIPTION:
+*       Clips of every track are kept in an interval tree: a treap ordered by clip start where
+*       every node stores the maximum clip end of its subtree. Clips overlapping a time range
+*       are found in start order visiting only the subtrees that can overlap it, so drawing and
+*       mouse picking cost O(log n + visible) per visible track, for tracks with thousands of
+*       clips. Adding, moving and removing a clip updates the tree of its tracks in O(log n).
+*
+*       Scrolling uses GuiScrollPanel() (tracks area content is the timeline duration at current
+*       zoom), time ruler lines are drawn with GuiGrid(), ticks step changes with zoom level.
+*       Control is drawn with raygui draw functions (gui alpha, state, transform and draw stream
+*       apply), so raygui implementation must be included before in the same translation unit.
+*
+*   CONTROLS:
+*       Mouse click and drag on ruler       - Move playhead
+*       Mouse click and drag on clip        - Select and move clip (time and track)
+*       Mouse wheel (SHIFT for time)        - Scroll tracks (time)
+*       CTRL + Mouse wheel                  - Zoom time around mouse position
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#ifndef GUI_TIMELINE_H
+#define GUI_TIMELINE_H
+
+typedef struct GuiTimelineIndex GuiTimelineIndex;   // Clips data and tracks interval trees (internal)
+
+// Gui timeline clip
+typedef struct {
+    int track;                  // Track index, -1 for removed clip
+    float start;                // Start time in seconds
+    float length;               // Length in seconds
+    const char *text;           // Clip text (not copied), NULL for none
+} GuiTimelineClip;
+
+// Gui timeline context data
+typedef struct {
+
+    // Timeline data
+    int trackCount;
+    int clipCount;              // Clips in timeline (removed clips not included)
+    float duration;             // Timeline length in seconds
+    const char **trackNames;    // Tracks names, NULL for track numbers
+
+    // View variables
+    float pixelsPerSecond;      // Time zoom level
+    float trackHeight;          // Track height in pixels
+    Vector2 scroll;             // Tracks area scroll (GuiScrollPanel())
+    float playhead;             // Playhead time in seconds
+    int selectedClip;           // Selected clip id, -1 if none
+
+    // Drag variables
+    int dragClip;               // Clip being moved, -1 if none
+    float dragOffset;           // Mouse time offset from dragged clip start
+    bool dragPlayhead;          // Playhead being moved
+
+    GuiTimelineIndex *index;
+
+} GuiTimelineState;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiTimelineState InitGuiTimeline(int trackCount, float duration);
+void UnloadGuiTimeline(GuiTimelineState *state);
+
+int GuiTimelineAddClip(GuiTimelineState *state, int track, float start, float length, const char *text); // Add clip, returns clip id (-1 if not valid)
+void GuiTimelineMoveClip(GuiTimelineState *state, int clip, int track, float start, float length);      // Move clip, index updated incrementally
+void GuiTimelineRemoveClip(GuiTimelineState *state, int clip);                                          // Remove clip, id can be reused by next added clip
+GuiTimelineClip GuiTimelineGetClip(const GuiTimelineState *state, int clip);                            // Get clip data, track is -1 if not available
+int GuiTimelineQueryClips(const GuiTimelineState *state, int track, float start, float end, int *clips, int maxClips); // Get clips overlapping time range in start order, returns total count
+
+int GuiTimeline(Rectangle bounds, GuiTimelineState *state);  // Timeline control, returns 1 when playhead or clips are changed by user
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_TIMELINE_H
+
+/***********************************************************************************
+*
+*   GUI_TIMELINE IMPLEMENTATION
+*
+************************************************************************************/
+#if defined(GUI_TIMELINE_IMPLEMENTATION)
+
+#include "../../src/raygui.h"
+
+#include <stdlib.h>     // Required for: calloc(), malloc(), realloc(), free()
+#include <math.h>       // Required for: floorf()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GUI_TIMELINE_HEADER_WIDTH        96         // Tracks names column width
+#define GUI_TIMELINE_RULER_HEIGHT        24         // Time ruler height
+#define GUI_TIMELINE_MIN_TICK_SPACING    80         // Minimum pixels between ruler major ticks
+#define GUI_TIMELINE_MIN_ZOOM          0.5f         // Minimum pixels per second
+#define GUI_TIMELINE_MAX_ZOOM       2000.0f         // Maximum pixels per second
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Interval tree node, one per clip (node index is clip id)
+typedef struct {
+    GuiTimelineClip clip;
+    int left;                   // Left child, clips starting before, -1 if none
+    int right;                  // Right child, clips starting after, -1 if none
+    float maxEnd;               // Maximum clip end in subtree
+} GuiTimelineNode;
+
+struct GuiTimelineIndex {
+    GuiTimelineNode *nodes;     // Clips nodes, indexed by clip id
+    int nodeCount;              // Clip ids in use (including removed clips)
+    int nodeCapacity;
+    int freeNode;               // First removed clip id to reuse, -1 if none (linked by left)
+
+    int *roots;                 // Interval tree root of every track, -1 for empty track
+
+    int *visible;               // Clips query results for drawing and picking
+    int visibleCapacity;
+};
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int GetTimelineNodePriority(int node);
+static bool IsTimelineNodeBefore(const GuiTimelineNode *nodes, int node, int other);
+static void UpdateTimelineNode(GuiTimelineNode *nodes, int node);
+static int InsertTimelineNode(GuiTimelineNode *nodes, int root, int node);
+static int RemoveTimelineNode(GuiTimelineNode *nodes, int root, int node);
+static int MergeTimelineNodes(GuiTimelineNode *nodes, int left, int right);
+static void QueryTimelineNode(const GuiTimelineNode *nodes, int node, float start, float end, int *clips, int maxClips, int *count);
+static int QueryTimelineVisible(GuiTimelineIndex *index, int track, float start, float end);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+GuiTimelineState InitGuiTimeline(int trackCount, float duration)
+{
+    GuiTimelineState state = { 0 };
+
+    state.trackCount = (trackCount > 0)? trackCount : 1;
+    state.duration = (duration > 0.0f)? duration : 1.0f;
+    state.pixelsPerSecond = 50.0f;
+    state.trackHeight = 32.0f;
+    state.selectedClip = -1;
+    state.dragClip = -1;
+
+    state.index = (GuiTimelineIndex *)calloc(1, sizeof(GuiTimelineIndex));
+    state.index->freeNode = -1;
+    state.index->roots = (int *)malloc(state.trackCount*sizeof(int));
+    for (int i = 0; i < state.trackCount; i++) state.index->roots[i] = -1;
+
+    return state;
+}
+
+void UnloadGuiTimeline(GuiTimelineState *state)
+{
+    if (state->index != NULL)
+    {
+        free(state->index->nodes);
+        free(state->index->roots);
+        free(state->index->visible);
+        free(state->index);
+    }
+
+    state->index = NULL;
+    state->clipCount = 0;
+}
+
+// Add clip, returns clip id (-1 if track or length is not valid)
+// NOTE: Clips must have a length greater than 0, empty clips can not be queried, drawn or picked
+int GuiTimelineAddClip(GuiTimelineState *state, int track, float start, float length, const char *text)
+{
+    GuiTimelineIndex *index = state->index;
+    if ((index == NULL) || (track < 0) || (track >= state->trackCount) || (length <= 0.0f)) return -1;
+
+    int clip = index->freeNode;
+
+    if (clip >= 0) index->freeNode = index->nodes[clip].left;
+    else
+    {
+        if (index->nodeCount == index->nodeCapacity)
+        {
+            index->nodeCapacity = (index->nodeCapacity > 0)? index->nodeCapacity*2 : 256;
+            index->nodes = (GuiTimelineNode *)realloc(index->nodes, index->nodeCapacity*sizeof(GuiTimelineNode));
+        }
+
+        clip = index->nodeCount++;
+    }
+
+    GuiTimelineNode *node = &index->nodes[clip];
+    node->clip.track = track;
+    node->clip.start = start;
+    node->clip.length = length;
+    node->clip.text = text;
+
+    index->roots[track] = InsertTimelineNode(index->nodes, index->roots[track], clip);
+    state->clipCount++;
+
+    return clip;
+}
+
+// Move clip to a new track, start and length
+// NOTE: Clip is removed from its track tree and inserted again, only its tree paths are updated,
+// clip is not changed if track or length (greater than 0 required) is not valid
+void GuiTimelineMoveClip(GuiTimelineState *state, int clip, int track, float start, float length)
+{
+    GuiTimelineIndex *index = state->index;
+    if ((index == NULL) || (clip < 0) || (clip >= index->nodeCount) || (index->nodes[clip].clip.track < 0)) return;
+    if ((track < 0) || (track >= state->trackCount) || (length <= 0.0f)) return;
+
+    GuiTimelineClip *data = &index->nodes[clip].clip;
+    if ((data->track == track) && (data->start == start) && (data->length == length)) return;
+
+    index->roots[data->track] = RemoveTimelineNode(index->nodes, index->roots[data->track], clip);
+
+    data->track = track;
+    data->start = start;
+    data->length = length;
+
+    index->roots[track] = InsertTimelineNode(index->nodes, index->roots[track], clip);
+}
+
+// Remove clip, its id can be reused by next added clip
+void GuiTimelineRemoveClip(GuiTimelineState *state, int clip)
+{
+    GuiTimelineIndex *index = state->index;
+    if ((index == NULL) || (clip < 0) || (clip >= index->nodeCount) || (index->nodes[clip].clip.track < 0)) return;
+
+    GuiTimelineNode *node = &index->nodes[clip];
+    index->roots[node->clip.track] = RemoveTimelineNode(index->nodes, index->roots[node->clip.track], clip);
+
+    node->clip.track = -1;
+    node->left = index->freeNode;
+    index->freeNode = clip;
+    state->clipCount--;
+
+    if (state->selectedClip == clip) state->selectedClip = -1;
+    if (state->dragClip == clip) state->dragClip = -1;
+}
+
+// Get clip data, track is -1 if clip is not available
+GuiTimelineClip GuiTimelineGetClip(const GuiTimelineState *state, int clip)
+{
+    GuiTimelineClip result = { -1, 0.0f, 0.0f, NULL };
+
+    if ((state->index != NULL) && (clip >= 0) && (clip < state->index->nodeCount)) result = state->index->nodes[clip].clip;
+
+    return result;
+}
+
+// Get clips overlapping time range [start, end) in start order, up to maxClips are written
+// NOTE: Returns total overlapping clips count, it can be greater than maxClips
+int GuiTimelineQueryClips(const GuiTimelineState *state, int track, float start, float end, int *clips, int maxClips)
+{
+    if ((state->index == NULL) || (track < 0) || (track >= state->trackCount)) return 0;
+
+    int count = 0;
+    QueryTimelineNode(state->index->nodes, state->index->roots[track], start, end, clips, maxClips, &count);
+
+    return count;
+}
+
+// Timeline control
+int GuiTimeline(Rectangle bounds, GuiTimelineState *state)
+{
+    // Ruler major ticks steps (seconds) and subdivisions
+    static const float tickSteps[] = { 0.1f, 0.5f, 1.0f, 5.0f, 10.0f, 30.0f, 60.0f, 300.0f, 600.0f, 1800.0f, 3600.0f };
+    static const int tickSubdivs[] = { 5, 5, 5, 5, 5, 6, 6, 5, 5, 6, 6 };
+
+    int result = 0;
+    GuiTimelineIndex *index = state->index;
+    if (index == NULL) return result;
+
+    float pps = state->pixelsPerSecond;
+    Rectangle ruler = { bounds.x + GUI_TIMELINE_HEADER_WIDTH, bounds.y, bounds.width - GUI_TIMELINE_HEADER_WIDTH, GUI_TIMELINE_RULER_HEIGHT };
+    Rectangle panel = { ruler.x, bounds.y + GUI_TIMELINE_RULER_HEIGHT, ruler.width, bounds.height - GUI_TIMELINE_RULER_HEIGHT };
+    Rectangle content = { 0, 0, state->duration*pps, state->trackCount*state->trackHeight };
+
+    Vector2 prevScroll = state->scroll;
+    Rectangle view = { 0 };
+    GuiScrollPanel(panel, NULL, content, &state->scroll, &view);
+
+    // Update control
+    //--------------------------------------------------------------------
+    Vector2 mouse = GetTransformedMousePosition();
+    float mouseTime = (mouse.x - view.x - state->scroll.x)/pps;
+    int mouseTrack = (int)floorf((mouse.y - view.y - state->scroll.y)/state->trackHeight);
+
+    if ((GuiGetState() != STATE_DISABLED) && !GuiIsLocked() && !guiControlExclusiveMode)
+    {
+        // Zoom time around mouse position, scroll panel CTRL scrolling is discarded
+        float wheel = GetMouseWheelMove();
+        if ((wheel != 0) && IsKeyDown(KEY_LEFT_CONTROL) && CheckCollisionPointRec(mouse, panel))
+        {
+            pps *= (wheel > 0)? 1.25f : 0.8f;
+            if (pps < GUI_TIMELINE_MIN_ZOOM) pps = GUI_TIMELINE_MIN_ZOOM;
+            if (pps > GUI_TIMELINE_MAX_ZOOM) pps = GUI_TIMELINE_MAX_ZOOM;
+
+            state->scroll.y = prevScroll.y;
+            state->scroll.x = -(mouseTime*pps - (mouse.x - view.x));
+            if (state->scroll.x > 0) state->scroll.x = 0;
+            state->pixelsPerSecond = pps;
+            mouseTime = (mouse.x - view.x - state->scroll.x)/pps;
+        }
+
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+        {
+            if (CheckCollisionPointRec(mouse, ruler)) state->dragPlayhead = true;
+            else if (CheckCollisionPointRec(mouse, view))
+            {
+                // Pick topmost clip under mouse (last drawn), one pixel wide time range
+                state->selectedClip = -1;
+
+                if ((mouseTrack >= 0) && (mouseTrack < state->trackCount))
+                {
+                    int count = QueryTimelineVisible(index, mouseTrack, mouseTime, mouseTime + 1.0f/pps);
+                    if (count > 0) state->selectedClip = index->visible[count - 1];
+                }
+
+                if (state->selectedClip >= 0)
+                {
+                    state->dragClip = state->selectedClip;
+                    state->dragOffset = mouseTime - index->nodes[state->dragClip].clip.start;
+                }
+
+                result = 1;
+            }
+        }
+
+        if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
+        {
+            if (state->dragPlayhead)
+            {
+                float playhead = mouseTime;
+                if (playhead < 0.0f) playhead = 0.0f;
+                if (playhead > state->duration) playhead = state->duration;
+
+                if (playhead != state->playhead) { state->playhead = playhead; result = 1; }
+            }
+            else if (state->dragClip >= 0)
+            {
+                GuiTimelineClip clip = index->nodes[state->dragClip].clip;
+                float start = mouseTime - state->dragOffset;
+                if (start + clip.length > state->duration) start = state->duration - clip.length;
+                if (start < 0.0f) start = 0.0f;     // Clip longer than duration starts at 0
+                int track = (mouseTrack < 0)? 0 : (mouseTrack >= state->trackCount)? state->trackCount - 1 : mouseTrack;
+
+                if ((start != clip.start) || (track != clip.track))
+                {
+                    GuiTimelineMoveClip(state, state->dragClip, track, start, clip.length);
+                    result = 1;
+                }
+            }
+        }
+        else
+        {
+            state->dragPlayhead = false;
+            state->dragClip = -1;
+        }
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    // NOTE: Drawn with raygui controls and draw functions, so gui alpha, state, transform,
+    // draw stream and cached regions apply, clipping uses GuiBeginScissor()
+    //--------------------------------------------------------------------
+    int controlState = (GuiGetState() == STATE_DISABLED)? STATE_DISABLED : STATE_NORMAL;
+    float padding = (float)GuiGetStyle(BUTTON, TEXT_PADDING) + 4;
+    float viewStart = -state->scroll.x/pps;
+    float viewEnd = viewStart + view.width/pps;
+
+    Color baseColor = GetColor(GuiGetStyle(DEFAULT, BASE + controlState*3));
+
+    // Tracks names column, vertical scroll follows tracks area
+    Rectangle header = { bounds.x, view.y, GUI_TIMELINE_HEADER_WIDTH, view.height };
+    GuiDrawRectangle((Rectangle){ bounds.x, bounds.y, GUI_TIMELINE_HEADER_WIDTH, bounds.height }, 0, BLANK, baseColor);
+
+    int firstTrack = (int)(-state->scroll.y/state->trackHeight);
+    int lastTrack = (int)((-state->scroll.y + view.height)/state->trackHeight);
+    if (firstTrack < 0) firstTrack = 0;
+    if (lastTrack > state->trackCount - 1) lastTrack = state->trackCount - 1;
+
+    GuiBeginScissor(header);
+    for (int track = firstTrack; track <= lastTrack; track++)
+    {
+        float y = view.y + state->scroll.y + track*state->trackHeight;
+        const char *name = ((state->trackNames != NULL) && (state->trackNames[track] != NULL))? state->trackNames[track] : TextFormat("Track %i", track + 1);
+
+        GuiLabel((Rectangle){ header.x + padding, y, header.width - padding, state->trackHeight }, name);
+        GuiLine((Rectangle){ header.x, y + state->trackHeight - 1, header.width, 0 }, NULL);
+    }
+    GuiEndScissor();
+
+    // Time ruler, major ticks step is the shortest one keeping minimum spacing
+    int step = 0;
+    while ((step < (int)(sizeof(tickSteps)/sizeof(tickSteps[0])) - 1) && (tickSteps[step]*pps < GUI_TIMELINE_MIN_TICK_SPACING)) step++;
+
+    float tickSpacing = tickSteps[step]*pps;
+    float firstTick = floorf(viewStart/tickSteps[step])*tickSteps[step];
+    float firstTickX = view.x + state->scroll.x + firstTick*pps;
+
+    GuiDrawRectangle(ruler, 0, BLANK, baseColor);
+
+    GuiBeginScissor((Rectangle){ view.x, ruler.y, view.width, ruler.height });
+        GuiGrid((Rectangle){ firstTickX, ruler.y, view.width + tickSpacing, ruler.height }, NULL, tickSpacing, tickSubdivs[step], NULL);
+
+        for (float x = firstTickX, time = firstTick; x < view.x + view.width; x += tickSpacing, time += tickSteps[step])
+        {
+            int seconds = (int)(time + 0.5f);
+            const char *label = (tickSteps[step] < 1.0f)? TextFormat("%.1f", time) : TextFormat("%i:%02i", seconds/60, seconds%60);
+            GuiDrawText(label, (Rectangle){ x + 3, ruler.y + 2, tickSpacing - 3, (float)GuiGetStyle(DEFAULT, TEXT_SIZE) }, TEXT_ALIGN_LEFT, GetColor(GuiGetStyle(DEFAULT, TEXT + controlState*3)));
+        }
+    GuiEndScissor();
+
+    // Tracks clips, only visible clips of visible tracks are visited
+    GuiBeginScissor(view);
+    for (int track = firstTrack; track <= lastTrack; track++)
+    {
+        float y = view.y + state->scroll.y + track*state->trackHeight;
+        GuiLine((Rectangle){ view.x, y + state->trackHeight - 1, view.width, 0 }, NULL);
+
+        int count = QueryTimelineVisible(index, track, viewStart, viewEnd);
+
+        for (int i = 0; i < count; i++)
+        {
+            int clip = index->visible[i];
+            const GuiTimelineClip *data = &index->nodes[clip].clip;
+            int clipState = ((clip == state->selectedClip) && (controlState != STATE_DISABLED))? STATE_PRESSED : controlState;
+
+            // NOTE: Clip rectangle is clamped to view, long clips can be millions of pixels wide
+            float x0 = view.x + state->scroll.x + data->start*pps;
+            float x1 = x0 + data->length*pps;
+            if (x0 < view.x - 2) x0 = view.x - 2;
+            if (x1 > view.x + view.width + 2) x1 = view.x + view.width + 2;
+            if (x1 - x0 < 1) x1 = x0 + 1;
+
+            Rectangle rec = { x0, y + 2, x1 - x0, state->trackHeight - 5 };
+            GuiDrawRectangle(rec, 1, GetColor(GuiGetStyle(BUTTON, BORDER + clipState*3)), GetColor(GuiGetStyle(BUTTON, BASE + clipState*3)));
+
+            // Clip text is only drawn when it fits, measured with gui text cache
+            if ((data->text != NULL) && (rec.width > 2*padding) && ((GetTextWidth(data->text) + 2*padding) <= rec.width))
+            {
+                GuiDrawText(data->text, (Rectangle){ rec.x + padding, rec.y, rec.width - 2*padding, rec.height }, TEXT_ALIGN_LEFT, GetColor(GuiGetStyle(BUTTON, TEXT + clipState*3)));
+            }
+        }
+    }
+    GuiEndScissor();
+
+    // Playhead, over ruler and tracks
+    float playheadX = view.x + state->scroll.x + state->playhead*pps;
+    if ((playheadX >= view.x) && (playheadX < view.x + view.width))
+    {
+        GuiDrawRectangle((Rectangle){ playheadX - 1, ruler.y, 2, ruler.height + view.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (controlState == STATE_DISABLED)? BORDER_COLOR_DISABLED : BORDER_COLOR_PRESSED)));
+    }
+    //--------------------------------------------------------------------
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get node priority, clip id hash (deterministic, keeps treap balanced in average)
+static unsigned int GetTimelineNodePriority(int node)
+{
+    unsigned int hash = (unsigned int)node*2654435761u;
+    return hash ^ (hash >> 16);
+}
+
+// Check if node goes before other node in tree order: start time, clip id for equal starts
+static bool IsTimelineNodeBefore(const GuiTimelineNode *nodes, int node, int other)
+{
+    if (nodes[node].clip.start != nodes[other].clip.start) return (nodes[node].clip.start < nodes[other].clip.start);
+    return (node < other);
+}
+
+// Update node subtree maximum clip end from its children
+static void UpdateTimelineNode(GuiTimelineNode *nodes, int node)
+{
+    float maxEnd = nodes[node].clip.start + nodes[node].clip.length;
+
+    if ((nodes[node].left >= 0) && (nodes[nodes[node].left].maxEnd > maxEnd)) maxEnd = nodes[nodes[node].left].maxEnd;
+    if ((nodes[node].right >= 0) && (nodes[nodes[node].right].maxEnd > maxEnd)) maxEnd = nodes[nodes[node].right].maxEnd;
+
+    nodes[node].maxEnd = maxEnd;
+}
+
+// Insert node in tree, returns new root
+static int InsertTimelineNode(GuiTimelineNode *nodes, int root, int node)
+{
+    if (root < 0)
+    {
+        nodes[node].left = -1;
+        nodes[node].right = -1;
+        UpdateTimelineNode(nodes, node);
+        return node;
+    }
+
+    if (IsTimelineNodeBefore(nodes, node, root))
+    {
+        nodes[root].left = InsertTimelineNode(nodes, nodes[root].left, node);
+
+        // Rotate right if child has higher priority
+        int child = nodes[root].left;
+        if (GetTimelineNodePriority(child) > GetTimelineNodePriority(root))
+        {
+            nodes[root].left = nodes[child].right;
+            UpdateTimelineNode(nodes, root);
+            nodes[child].right = root;
+            root = child;
+        }
+    }
+    else
+    {
+        nodes[root].right = InsertTimelineNode(nodes, nodes[root].right, node);
+
+        // Rotate left if child has higher priority
+        int child = nodes[root].right;
+        if (GetTimelineNodePriority(child) > GetTimelineNodePriority(root))
+        {
+            nodes[root].right = nodes[child].left;
+            UpdateTimelineNode(nodes, root);
+            nodes[child].left = root;
+            root = child;
+        }
+    }
+
+    UpdateTimelineNode(nodes, root);
+
+    return root;
+}
+
+// Remove node from tree, returns new root
+// NOTE: Node clip start must not be changed before removal, it is used to find the node
+static int RemoveTimelineNode(GuiTimelineNode *nodes, int root, int node)
+{
+    if (root < 0) return root;
+    if (root == node) return MergeTimelineNodes(nodes, nodes[node].left, nodes[node].right);
+
+    if (IsTimelineNodeBefore(nodes, node, root)) nodes[root].left = RemoveTimelineNode(nodes, nodes[root].left, node);
+    else nodes[root].right = RemoveTimelineNode(nodes, nodes[root].right, node);
+
+    UpdateTimelineNode(nodes, root);
+
+    return root;
+}
+
+// Merge two trees, all left tree nodes go before right tree nodes, returns new root
+static int MergeTimelineNodes(GuiTimelineNode *nodes, int left, int right)
+{
+    if (left < 0) return right;
+    if (right < 0) return left;
+
+    if (GetTimelineNodePriority(left) > GetTimelineNodePriority(right))
+    {
+        nodes[left].right = MergeTimelineNodes(nodes, nodes[left].right, right);
+        UpdateTimelineNode(nodes, left);
+        return left;
+    }
+    else
+    {
+        nodes[right].left = MergeTimelineNodes(nodes, left, nodes[right].left);
+        UpdateTimelineNode(nodes, right);
+        return right;
+    }
+}
+
+// Find clips overlapping [start, end) in subtree, in tree order
+// NOTE: Subtrees ending before start are skipped, right subtrees are skipped once clips start after end
+static void QueryTimelineNode(const GuiTimelineNode *nodes, int node, float start, float end, int *clips, int maxClips, int *count)
+{
+    if ((node < 0) || (nodes[node].maxEnd <= start)) return;
+
+    QueryTimelineNode(nodes, nodes[node].left, start, end, clips, maxClips, count);
+
+    if (nodes[node].clip.start >= end) return;
+
+    if (nodes[node].clip.start + nodes[node].clip.length > start)
+    {
+        if (*count < maxClips) clips[*count] = node;
+        (*count)++;
+    }
+
+    QueryTimelineNode(nodes, nodes[node].right, start, end, clips, maxClips, count);
+}
+
+// Find clips of track overlapping [start, end) into visible clips buffer, returns count
+static int QueryTimelineVisible(GuiTimelineIndex *index, int track, float start, float end)
+{
+    int count = 0;
+    QueryTimelineNode(index->nodes, index->roots[track], start, end, index->visible, index->visibleCapacity, &count);
+
+    if (count > index->visibleCapacity)
+    {
+        // Buffer grows to fit all results, query again
+        while (index->visibleCapacity < count) index->visibleCapacity = (index->visibleCapacity > 0)? index->visibleCapacity*2 : 256;
+        index->visible = (int *)realloc(index->visible, index->visibleCapacity*sizeof(int));
+
+        count = 0;
+        QueryTimelineNode(index->nodes, index->roots[track], start, end, index->visible, index->visibleCapacity, &count);
+    }
+
+    return count;
+}
+
+#endif // GUI_TIMELINE_IMPLEMENTATION
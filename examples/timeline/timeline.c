@@ -0,0 +1,112 @@
+/*******************************************************************************************
+*
+*   raygui - timeline with thousands of clips
+*
+*   DEPENDENCIES:
+*       raylib 5.0  - Windowing/input management and drawing.
+*       raygui 4.5  - Immediate-mode GUI controls.
+*
+*   COMPILATION (Windows - MinGW):
+*       gcc -o $(NAME_PART).exe $(FILE_NAME) -I../../src -lraylib -lopengl32 -lgdi32 -std=c99
+*
+*   USAGE:
+*       Drag clips to move them, drag the ruler to move the playhead, CTRL + mouse wheel to zoom
+*       Press SPACE to play/pause, DELETE to remove selected clip
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#define RAYGUI_IMPLEMENTATION
+#include "../../src/raygui.h"
+
+#undef RAYGUI_IMPLEMENTATION            // Avoid including raygui implementation again
+#define GUI_TIMELINE_IMPLEMENTATION
+#include "gui_timeline.h"
+
+#define TRACK_COUNT             12
+#define CLIPS_PER_TRACK       2000
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //---------------------------------------------------------------------------------------
+    const int screenWidth = 960;
+    const int screenHeight = 540;
+
+    InitWindow(screenWidth, screenHeight, "raygui - timeline");
+
+    // One hour timeline, clips of 1 to 4 seconds packed on every track
+    GuiTimelineState timeline = InitGuiTimeline(TRACK_COUNT, 3600.0f);
+    const char *clipNames[4] = { "Intro", "Dialog", "Music", "FX" };
+
+    for (int track = 0; track < TRACK_COUNT; track++)
+    {
+        float time = 0.0f;
+
+        for (int i = 0; i < CLIPS_PER_TRACK; i++)
+        {
+            float length = (float)GetRandomValue(10, 40)/10.0f;
+            GuiTimelineAddClip(&timeline, track, time, length, clipNames[GetRandomValue(0, 3)]);
+            time += length + (float)GetRandomValue(0, 5)/10.0f;
+        }
+    }
+
+    bool playing = false;
+
+    SetTargetFPS(60);
+    //---------------------------------------------------------------------------------------
+
+    // Main game loop
+    while (!WindowShouldClose())    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        if (IsKeyPressed(KEY_SPACE)) playing = !playing;
+        if (IsKeyPressed(KEY_DELETE)) GuiTimelineRemoveClip(&timeline, timeline.selectedClip);
+
+        if (playing)
+        {
+            timeline.playhead += GetFrameTime();
+            if (timeline.playhead > timeline.duration) timeline.playhead = 0.0f;
+        }
+
+        // Clips under playhead on first track, same query used by the control for drawing
+        int playingClip = -1;
+        GuiTimelineQueryClips(&timeline, 0, timeline.playhead, timeline.playhead, &playingClip, 1);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+            GuiTimeline((Rectangle){ 10, 10, (float)screenWidth - 20, (float)screenHeight - 50 }, &timeline);
+
+            GuiTimelineClip selected = GuiTimelineGetClip(&timeline, timeline.selectedClip);
+            GuiStatusBar((Rectangle){ 0, (float)screenHeight - 30, (float)screenWidth, 30 },
+                TextFormat("Clips: %i | Zoom: %.1f px/s | Playhead: %.2f s | Track 1 clip: %i | Selected: %s",
+                    timeline.clipCount, timeline.pixelsPerSecond, timeline.playhead, playingClip,
+                    (selected.track >= 0)? TextFormat("%i (track %i, %.2f s)", timeline.selectedClip, selected.track + 1, selected.start) : "none"));
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadGuiTimeline(&timeline);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+# raygui size report
+#
+# Reports object size and instruction cache footprint of raygui implementation objects,
+# run by raygui_size_report target:
+#
+#   cmake -DOBJECTS="name=object;..." -DSIZE_TOOL=size -DNM_TOOL=nm -P SizeReport.cmake
+#
+# Code size is the sum of .text sections, cache lines are 64 bytes, largest functions
+# are the ones most likely to evict each other from instruction cache
+
+cmake_minimum_required(VERSION 3.15)
+
+set(CACHE_LINE_SIZE 64)
+set(LARGEST_FUNCTIONS 5)
+
+message("")
+message("raygui size report (bytes)")
+message("")
+message("  configuration          object      code     rodata    data+bss  cache lines")
+
+foreach(entry ${OBJECTS})
+    string(REPLACE "=" ";" entry "${entry}")
+    list(GET entry 0 name)
+    list(GET entry 1 object)
+
+    file(SIZE ${object} objectSize)
+    set(code 0)
+    set(rodata 0)
+    set(data 0)
+
+    # Sections sizes, SysV format: name size address
+    if(SIZE_TOOL)
+        execute_process(COMMAND ${SIZE_TOOL} -A ${object} OUTPUT_VARIABLE sections ERROR_QUIET)
+        string(REPLACE "\n" ";" sections "${sections}")
+
+        foreach(section ${sections})
+            if(section MATCHES "^([._a-zA-Z0-9]+)[ \t]+([0-9]+)")
+                set(sectionName ${CMAKE_MATCH_1})
+                set(sectionSize ${CMAKE_MATCH_2})
+
+                if(sectionName MATCHES "^\\.text")
+                    math(EXPR code "${code} + ${sectionSize}")
+                elseif(sectionName MATCHES "^\\.rodata")
+                    math(EXPR rodata "${rodata} + ${sectionSize}")
+                elseif(sectionName MATCHES "^\\.(data|bss)")
+                    math(EXPR data "${data} + ${sectionSize}")
+                endif()
+            endif()
+        endforeach()
+    endif()
+
+    math(EXPR lines "(${code} + ${CACHE_LINE_SIZE} - 1)/${CACHE_LINE_SIZE}")
+
+    string(SUBSTRING "${name}                      " 0 22 column)
+    set(row "  ${column}")
+    foreach(value ${objectSize} ${code} ${rodata} ${data} ${lines})
+        string(LENGTH "${value}" length)
+        math(EXPR padding "10 - ${length}")
+        string(REPEAT " " ${padding} spaces)
+        string(APPEND row " ${spaces}${value}")
+    endforeach()
+    message("${row}")
+
+    # Largest functions, symbol sizes from nm
+    if(NM_TOOL)
+        execute_process(COMMAND ${NM_TOOL} --size-sort --reverse-sort -S ${object} OUTPUT_VARIABLE symbols ERROR_QUIET)
+        string(REPLACE "\n" ";" symbols "${symbols}")
+
+        set(count 0)
+        set(functions "")
+        foreach(symbol ${symbols})
+            if((count LESS LARGEST_FUNCTIONS) AND (symbol MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tT] (.+)$"))
+                math(EXPR functionSize "0x${CMAKE_MATCH_1}" OUTPUT_FORMAT DECIMAL)
+                list(APPEND functions "${CMAKE_MATCH_2} ${functionSize}")
+                math(EXPR count "${count} + 1")
+            endif()
+        endforeach()
+
+        string(REPLACE ";" ", " functions "${functions}")
+        if(functions)
+            message("      largest functions: ${functions}")
+        endif()
+    endif()
+endforeach()
+
+message("")
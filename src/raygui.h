@@ -94,13 +94,16 @@
 *
 *   RAYGUI ICONS (guiIcons):
 *       raygui could use a global array containing icons data (allocated on data segment by default),
-*       a custom icons set could be loaded over this array using GuiLoadIcons(), but loaded icons set
-*       must be same RAYGUI_ICON_SIZE and no more than RAYGUI_ICON_MAX_ICONS will be loaded
+*       a custom icons set could be loaded over this array using GuiLoadIcons(), icons that do not
+*       fit in the array (RAYGUI_ICON_MAX_ICONS icons of RAYGUI_ICON_SIZE) are not loaded
+*
+*       Icons size is a runtime value of the icons set in use: GuiSetIcons() sets any icons data
+*       (16x16, 32x32, 64x64... icons), so bigger or multiple sets can be kept by the user and swapped
 *
 *       Every icon is codified in binary form, using 1 bit per pixel, so, every 16x16 icon
 *       requires 8 integers (16*16/32) to be stored in memory.
 *
-*       When the icon is draw, actually one quad per pixel is drawn if the bit for that pixel is set.
+*       When the icon is draw, one quad is drawn for every run of set pixels in a row.
 *
 *       The global icons array size is fixed and depends on the number of icons and size:
 *
@@ -134,6 +137,61 @@
 *           Includes custom ricons.h header defining a set of custom icons,
 *           this file can be generated using rGuiIcons tool
 *
+*       #define RAYGUI_NO_TEXTBOX
+*           Avoid GuiTextBox(), GuiValueBox(), GuiValueBoxFloat() and GuiSpinner() controls (and text undo history)
+*
+*       #define RAYGUI_NO_COLORPICKER
+*           Avoid GuiColorPicker(), GuiColorPanel(), GuiColorBar*() and GuiColorPalette() controls (and color textures)
+*
+*       #define RAYGUI_NO_LISTVIEW
+*           Avoid GuiListView() and GuiListViewEx() controls
+*
+*       #define RAYGUI_NO_TABBAR
+*           Avoid GuiTabBar() control
+*
+*       #define RAYGUI_NO_MESSAGEBOX
+*           Avoid GuiMessageBox() and GuiTextInputBox() controls
+*           NOTE: GuiTextInputBox() is also avoided with RAYGUI_NO_TEXTBOX
+*
+*       #define RAYGUI_NO_GRID
+*           Avoid GuiGrid() control
+*
+*       #define RAYGUI_NO_TEXT_CACHE
+*           Avoid text measurement cache, every GetTextWidth() call processes text glyphs
+*           NOTE: Cache size can be configured with RAYGUI_TEXT_CACHE_SIZE (entries, power of 2),
+*           entries are aged by GuiBeginFrame() calls if used, by time otherwise (60 ticks per second),
+*           in RAYGUI_STANDALONE mode GuiBeginFrame() must be called every frame to age entries
+*
+*       #define RAYGUI_NO_SIMD
+*           Avoid SIMD intrinsics (SSE2/AVX2/NEON) usage on text processing and colors conversion, scalar code is used instead
+*
+*       #define RAYGUI_NO_COLOR_TEXTURES
+*           Avoid cached textures for GuiColorPanelHSV() and GuiColorBarHue(), vertex color gradients are drawn instead
+*           NOTE: Cache size can be configured with RAYGUI_COLOR_TEXTURE_CACHE_SIZE (textures)
+*
+*       #define RAYGUI_MAX_TRANSFORMS
+*           Maximum nested transforms pushed with GuiPushTransform() (by default 8)
+*
+*       #define RAYGUI_MAX_CACHED_REGIONS
+*           Maximum regions recorded with GuiBeginCachedRegion() (by default 16, least recently used is replaced)
+*
+*       #define RAYGUI_SURFACES_MEMORY_BUDGET
+*           Render textures memory used by GuiBeginCachedSurface() (by default 16 MB, least recently used is unloaded)
+*           NOTE: In RAYGUI_STANDALONE mode cached surfaces are replayed as cached regions (no render textures)
+*
+*       #define RAYGUI_MAX_SKIN_SLICES
+*           Maximum skin slices loaded with GuiSetSkin() or from .rgs style (by default 64)
+*
+*       #define RAYGUI_DRAW_STREAM_OCCLUDERS
+*           Opaque fills considered by draw stream occlusion culling (by default 32, largest ones are kept)
+*
+*       #define RAYGUI_DRAW_STREAM_MERGE_DISTANCE
+*           Previous draw commands checked for same color rectangles merging in draw stream (by default 32)
+*
+*       #define RAYGUI_NO_TEXT_UNDO
+*           Avoid undo/redo history for GuiTextBox(), GuiValueBox() and GuiValueBoxFloat()
+*           NOTE: History is bounded: RAYGUI_TEXT_UNDO_MAX_CONTROLS, RAYGUI_TEXT_UNDO_MAX_STEPS, RAYGUI_TEXT_UNDO_DATA_SIZE
+*
 *       #define RAYGUI_DEBUG_RECS_BOUNDS
 *           Draw control bounds rectangles for debug
 *
@@ -147,6 +205,29 @@
 *                         ADDED: GuiDropdonwBox() properties: DROPDOWN_ARROW_HIDDEN, DROPDOWN_ROLL_UP
 *                         ADDED: GuiListView() property: LIST_ITEMS_BORDER_WIDTH
 *                         ADDED: Multiple new icons
+*                         ADDED: Text measurement cache, frame-aged, GuiBeginFrame() and GuiGetStats()
+*                         ADDED: Text ASCII fast path, SIMD runs detection and glyphs advance table
+*                         ADDED: Text controls undo/redo history (CTRL+Z, CTRL+Y), GuiClearUndoHistory()
+*                         ADDED: GuiTextBox() clipboard paste (CTRL+V), validated bulk text insertion
+*                         ADDED: GuiFormatInteger(), GuiFormatFloat(), value text cache for value boxes
+*                         ADDED: GuiConvertHSVtoRGB(), GuiConvertRGBtoHSV(), batch colors conversion
+*                         ADDED: GuiColorPalette(), color swatches grid control
+*                         ADDED: Color panel and hue bar cached textures, exact colors in a single quad
+*                         ADDED: Controls nine-slice skins (SKIN_SLICE property), GuiSetSkin(), .rgs skin section
+*                         ADDED: New DEFAULT property: BORDER_RADIUS, anti-aliased rounded rectangles from corner atlas
+*                         ADDED: Corner atlas packed in style font atlas, text, shapes and rounded rectangles in a single batch
+*                         ADDED: Draw stream, GuiBeginDrawStream(), GuiEndDrawStream(), occlusion culling of covered fills
+*                         ADDED: GuiBeginScissor(), GuiEndScissor(), scissor mode recorded in draw stream (BeginScissorMode() is not)
+*                         ADDED: Draw stream merging of adjacent and overlapping same color rectangles
+*                         ADDED: Draw stream vertex arrays export, GuiGetDrawData(), GuiSetDrawDataBuffers()
+*                         ADDED: GuiPushTransform(), GuiPopTransform(), zoomable canvases with viewport culling
+*                         ADDED: GuiBeginCachedRegion(), GuiEndCachedRegion(), unchanged regions draw commands replay
+*                         ADDED: GuiBeginCachedSurface(), GuiEndCachedSurface(), unchanged panels drawn from render texture
+*                         ADDED: GuiUnloadCachedSurfaces(), cached surfaces premultiplied alpha, DRAW_COMMAND_SURFACE
+*                         ADDED: GuiSetIcons(), GuiGetIconSize(), GuiGetIconCount(), runtime icons size and count, icon ids up to 5 digits
+*                         ADDED: GuiGetTextIconPrefix(), single icon prefix parser for text measure and drawing
+*                         ADDED: Draw stream commands export, DRAW_COMMAND_ICON, icons as single commands for software renderers
+*                         ADDED: RAYGUI_NO_TEXTBOX, RAYGUI_NO_COLORPICKER, RAYGUI_NO_LISTVIEW, RAYGUI_NO_TABBAR, RAYGUI_NO_MESSAGEBOX, RAYGUI_NO_GRID
 *                         REVIEWED: GuiTabBar(), close tab with mouse middle button
 *                         REVIEWED: GuiScrollPanel(), scroll speed proportional to content
 *                         REVIEWED: GuiDropdownBox(), support roll up and hidden arrow
@@ -265,6 +346,7 @@
 *
 *   DEPENDENCIES:
 *       raylib 5.0  - Inputs reading (keyboard/mouse), shapes drawing, font loading and text drawing
+*       rlgl 5.0    - Blend factors setup for cached surfaces rendering (rlgl.h, included with raylib)
 *
 *   STANDALONE MODE:
 *       By default raygui depends on raylib mostly for the inputs and the drawing functionality but that dependency can be disabled
@@ -280,9 +362,15 @@
 *           - bool IsKeyDown(int key);
 *           - bool IsKeyPressed(int key);
 *           - int GetCharPressed(void);         // -- GuiTextBox(), GuiValueBox()
+*           - const char *GetClipboardText(void);   // -- GuiTextBox()
 *
 *           - void DrawRectangle(int x, int y, int width, int height, Color color); // -- GuiDrawRectangle()
 *           - void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4); // -- GuiColorPicker()
+*           - void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // -- GuiColorPicker(), GuiSetSkin(), GuiDrawRectangle() rounded
+*           - void UpdateTexture(Texture2D texture, const void *pixels);   // -- GuiColorPicker(), update cached color texture
+*           - void UnloadTexture(Texture2D texture);                 // -- GuiColorPicker(), GuiLoadStyle()
+*           - void BeginScissorMode(int x, int y, int width, int height); // -- GuiBeginScissor()
+*           - void EndScissorMode(void);                             // -- GuiEndScissor()
 *
 *           - Font GetFontDefault(void);                            // -- GuiLoadStyleDefault()
 *           - Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // -- GuiLoadStyle()
@@ -365,6 +453,9 @@
 #ifndef RAYGUI_CALLOC
     #define RAYGUI_CALLOC(n,sz)     calloc(n,sz)
 #endif
+#ifndef RAYGUI_REALLOC
+    #define RAYGUI_REALLOC(p,sz)    realloc(p,sz)
+#endif
 #ifndef RAYGUI_FREE
     #define RAYGUI_FREE(p)          free(p)
 #endif
@@ -467,6 +558,76 @@ typedef struct GuiStyleProp {
     int propertyValue;          // Property value
 } GuiStyleProp;
 
+// Gui skin slice, nine-slice region in skin atlas texture
+// NOTE: Borders keep their size, edges and center are stretched to fill control bounds
+typedef struct GuiSkinSlice {
+    Rectangle source;           // Slice rectangle in skin texture
+    int left;                   // Left border width
+    int top;                    // Top border height
+    int right;                  // Right border width
+    int bottom;                 // Bottom border height
+} GuiSkinSlice;
+
+// Gui stats, internal counters for current frame
+// NOTE: Counters are reset on GuiBeginFrame(), on time based frame change (60 ticks per second) if it is never called
+typedef struct GuiStats {
+    unsigned int frame;         // Current frame counter
+    int textCacheHits;          // Text measurements served by text cache
+    int textCacheMisses;        // Text measurements requiring glyphs processing
+    int textCacheEvictions;     // Text cache entries replaced by new ones
+    int valueTextFormats;       // Values formatted to text by value boxes (value changed or not cached)
+    int colorTextureUpdates;    // Color panel and hue bar textures generated (hue or size changed, not cached)
+    int drawCommands;           // Draw commands recorded in draw stream
+    int drawCommandsCulled;     // Draw commands removed by occlusion culling (covered by later opaque fills)
+    float drawCulledArea;       // Draw area removed by occlusion culling (pixels)
+    int drawCommandsMerged;     // Draw commands merged into previous same color rectangles
+    int regionsReplayed;        // Cached regions drawn from recorded commands (controls not processed)
+    int regionsRecorded;        // Cached regions processed and recorded (changed, hovered or not cached)
+    int surfacesRendered;       // Cached surfaces rendered into render textures
+    int surfacesMemory;         // Cached surfaces render textures memory (bytes)
+} GuiStats;
+
+// Gui draw command, primitive emitted by controls drawing
+// NOTE: Commands are recorded between GuiBeginDrawStream() and GuiEndDrawStream(), drawn immediately otherwise
+typedef struct GuiDrawCommand {
+    int type;                   // Command type (GuiDrawCommandType)
+    int codepoint;              // Glyph codepoint (DRAW_COMMAND_GLYPH)
+    Rectangle rec;              // Destination rectangle, glyph position and size (advance, font size), scissor rectangle
+    Rectangle source;           // Texture source rectangle (DRAW_COMMAND_TEXTURE)
+    Texture2D texture;          // Texture (DRAW_COMMAND_TEXTURE)
+    Color colors[4];            // Color or tint, gradient corners: top-left, bottom-left, bottom-right, top-right
+} GuiDrawCommand;
+
+// Gui draw vertex, interleaved position, texture coordinates and color
+typedef struct GuiDrawVertex {
+    float x, y;                 // Vertex position (screen)
+    float u, v;                 // Vertex texture coordinates (normalized)
+    unsigned char r, g, b, a;   // Vertex color
+} GuiDrawVertex;
+
+// Gui draw range, quads drawn with same texture, scissor and blending
+// NOTE: Indices are relative to vertexOffset, so 16-bit indices address up to 65536 vertices per range
+typedef struct GuiDrawRange {
+    unsigned int textureId;     // Texture id, 0 for no texture (shapes texture not set)
+    Rectangle scissor;          // Scissor rectangle, zero size for no scissor
+    bool premultiplied;         // Premultiplied alpha texture, blend factors ONE, ONE_MINUS_SRC_ALPHA
+    int vertexOffset;           // First vertex of range, base vertex for indices
+    int indexOffset;            // First index of range
+    int indexCount;             // Indices count, 6 per quad
+} GuiDrawRange;
+
+// Gui draw data, vertex arrays of a finished draw stream
+// NOTE: Quads vertices are top-left, bottom-left, bottom-right, top-right, same as raylib
+typedef struct GuiDrawData {
+    GuiDrawVertex *vertices;    // Vertices array
+    unsigned short *indices;    // Indices array (16-bit)
+    GuiDrawRange *ranges;       // Draw ranges array
+    int vertexCount;            // Vertices count
+    int indexCount;             // Indices count
+    int rangeCount;             // Draw ranges count
+    int droppedQuads;           // Quads not exported, provided buffers are full
+} GuiDrawData;
+
 /*
 // Controls text style -NOT USED-
 // NOTE: Text style is defined by control
@@ -511,6 +672,26 @@ typedef enum {
     TEXT_WRAP_WORD
 } GuiTextWrapMode;
 
+// Gui draw command type
+typedef enum {
+    DRAW_COMMAND_RECTANGLE = 0, // Filled rectangle
+    DRAW_COMMAND_GRADIENT,      // Rectangle with corners colors gradient
+    DRAW_COMMAND_TEXTURE,       // Texture source rectangle into destination rectangle
+    DRAW_COMMAND_GLYPH,         // Gui font glyph
+    DRAW_COMMAND_SCISSOR_BEGIN, // Begin scissor mode
+    DRAW_COMMAND_SCISSOR_END,   // End scissor mode
+    DRAW_COMMAND_ICON,          // Gui icon, codepoint is icon id, rectangle is icon bounds (DRAW_STREAM_EXPORT_COMMANDS)
+    DRAW_COMMAND_SURFACE        // Premultiplied alpha texture (cached surface), same fields as DRAW_COMMAND_TEXTURE
+} GuiDrawCommandType;
+
+// Gui draw stream processing flags
+typedef enum {
+    DRAW_STREAM_CULL_OCCLUDED = 1,      // Remove fills and glyphs fully covered by later opaque fills (same scissor)
+    DRAW_STREAM_MERGE_RECTANGLES = 2,   // Merge adjacent and overlapping same color rectangles (painter's order kept)
+    DRAW_STREAM_EXPORT_VERTICES = 4,    // Build vertex arrays (GuiGetDrawData()) instead of drawing, for custom renderers
+    DRAW_STREAM_EXPORT_COMMANDS = 8     // Keep draw commands (GuiGetDrawStream()) instead of drawing, icons are single commands
+} GuiDrawStreamFlags;
+
 // Gui controls
 typedef enum {
     // Default -> populates to all controls when set
@@ -556,6 +737,7 @@ typedef enum {
     TEXT_PADDING,               // Control text padding, not considering border
     TEXT_ALIGNMENT,             // Control text horizontal alignment inside control text bound (after border and padding)
     //TEXT_WRAP_MODE              // Control text wrap-mode inside text bounds -> GLOBAL for all controls
+    SKIN_SLICE,                 // Control skin slice index + 1 (0 for no skin), slices for every state are consecutive
 } GuiControlProperty;
 
 // TODO: Which text styling properties should be global or per-control?
@@ -576,7 +758,8 @@ typedef enum {
     BACKGROUND_COLOR,           // Background color
     TEXT_LINE_SPACING,          // Text spacing between lines
     TEXT_ALIGNMENT_VERTICAL,    // Text vertical alignment inside text bounds (after border and padding)
-    TEXT_WRAP_MODE              // Text wrap-mode inside text bounds
+    TEXT_WRAP_MODE,             // Text wrap-mode inside text bounds
+    BORDER_RADIUS               // Rectangles corners radius, anti-aliased rounded corners (0 for square corners)
     //TEXT_DECORATION             // Text decoration: 0-None, 1-Underline, 2-Line-through, 3-Overline
     //TEXT_DECORATION_THICK       // Text decoration line thickness
 } GuiDefaultProperty;
@@ -690,6 +873,25 @@ RAYGUIAPI bool GuiIsLocked(void);                               // Check if gui
 RAYGUIAPI void GuiSetAlpha(float alpha);                        // Set gui controls alpha (global state), alpha goes from 0.0f to 1.0f
 RAYGUIAPI void GuiSetState(int state);                          // Set gui state (global state)
 RAYGUIAPI int GuiGetState(void);                                // Get gui state (global state)
+RAYGUIAPI void GuiBeginFrame(void);                             // Begin gui frame (optional), ages internal caches and resets stats
+RAYGUIAPI void GuiPushTransform(Vector2 offset, float scale);   // Push gui transform (translate and uniform scale), applied to controls input and drawing
+RAYGUIAPI void GuiPopTransform(void);                           // Pop gui transform, previous transform restored
+RAYGUIAPI bool GuiBeginCachedRegion(const void *key, Rectangle bounds, unsigned int version); // Begin cached region, returns true if region controls must be processed
+RAYGUIAPI void GuiEndCachedRegion(void);                        // End cached region, required after GuiBeginCachedRegion() in any case
+RAYGUIAPI bool GuiBeginCachedSurface(const void *key, Rectangle bounds, unsigned int version); // Begin cached surface, region drawn as a single textured quad while unchanged
+RAYGUIAPI void GuiEndCachedSurface(void);                       // End cached surface, required after GuiBeginCachedSurface() in any case
+RAYGUIAPI void GuiUnloadCachedSurfaces(void);                   // Unload all cached surfaces render textures (i.e. before CloseWindow())
+RAYGUIAPI GuiStats GuiGetStats(void);                           // Get gui internal stats for current frame
+RAYGUIAPI void GuiClearUndoHistory(const void *key);            // Clear undo history of text controls editing key text/value (NULL for all)
+
+// Draw stream functions
+RAYGUIAPI void GuiBeginDrawStream(int flags);                   // Begin recording gui draw commands instead of drawing, flags: GuiDrawStreamFlags (use GuiBeginScissor() inside, not BeginScissorMode())
+RAYGUIAPI void GuiEndDrawStream(void);                          // End recording gui draw commands, process and draw them
+RAYGUIAPI const GuiDrawCommand *GuiGetDrawStream(int *count);   // Get draw commands of last draw stream (after processing)
+RAYGUIAPI void GuiBeginScissor(Rectangle bounds);               // Begin scissor mode, recorded in draw stream
+RAYGUIAPI void GuiEndScissor(void);                             // End scissor mode, recorded in draw stream
+RAYGUIAPI GuiDrawData GuiGetDrawData(void);                     // Get vertex arrays of last draw stream (DRAW_STREAM_EXPORT_VERTICES)
+RAYGUIAPI void GuiSetDrawDataBuffers(GuiDrawVertex *vertices, int maxVertices, unsigned short *indices, int maxIndices, GuiDrawRange *ranges, int maxRanges); // Set draw data buffers, NULL for internal growable buffers
 
 // Font set/get functions
 RAYGUIAPI void GuiSetFont(Font font);                           // Set gui custom font (global state)
@@ -702,18 +904,31 @@ RAYGUIAPI int GuiGetStyle(int control, int property);           // Get one style
 // Styles loading functions
 RAYGUIAPI void GuiLoadStyle(const char *fileName);              // Load style file over global style variable (.rgs)
 RAYGUIAPI void GuiLoadStyleDefault(void);                       // Load style default over global style
+RAYGUIAPI void GuiSetSkin(Texture2D texture, const GuiSkinSlice *slices, int count); // Set skin texture (id 0 for gui font atlas) and slices, count 0 to disable skin
 
 // Tooltips management functions
 RAYGUIAPI void GuiEnableTooltip(void);                          // Enable gui tooltips (global state)
 RAYGUIAPI void GuiDisableTooltip(void);                         // Disable gui tooltips (global state)
 RAYGUIAPI void GuiSetTooltip(const char *tooltip);              // Set tooltip string
 
+// Values formatting functions (no allocations, no printf)
+RAYGUIAPI int GuiFormatInteger(char *buffer, int value);        // Format integer as text into buffer (12 bytes min), returns text length
+RAYGUIAPI int GuiFormatFloat(char *buffer, float value, int precision); // Format float with precision decimals (-1 for shortest round-trip text) into buffer (32 bytes min), returns text length
+
+// Color conversion functions (batch processing, SIMD when available)
+RAYGUIAPI void GuiConvertHSVtoRGB(const Vector3 *hsv, Vector3 *rgb, int count); // Convert colors array from HSV to RGB (normalized), arrays can be the same
+RAYGUIAPI void GuiConvertRGBtoHSV(const Vector3 *rgb, Vector3 *hsv, int count); // Convert colors array from RGB to HSV (normalized), arrays can be the same
+
 // Icons functionality
 RAYGUIAPI const char *GuiIconText(int iconId, const char *text); // Get text with icon id prepended (if supported)
+RAYGUIAPI int GuiGetTextIconPrefix(const char *text, int *iconId); // Get text icon prefix (#iconId#, up to 5 digits) size in bytes, 0 if none
 #if !defined(RAYGUI_NO_ICONS)
 RAYGUIAPI void GuiSetIconScale(int scale);                      // Set default icon drawing size
 RAYGUIAPI unsigned int *GuiGetIcons(void);                      // Get raygui icons data pointer
 RAYGUIAPI char **GuiLoadIcons(const char *fileName, bool loadIconsName); // Load raygui icons file (.rgi) into internal icons data
+RAYGUIAPI void GuiSetIcons(unsigned int *icons, int iconSize, int iconCount); // Set icons data in use (any icons size), NULL to restore internal icons data
+RAYGUIAPI int GuiGetIconSize(void);                             // Get icons size in pixels of icons data in use
+RAYGUIAPI int GuiGetIconCount(void);                            // Get icons count of icons data in use, valid icon ids are below it
 RAYGUIAPI void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color); // Draw icon using pixel size at specified position
 #endif
 
@@ -724,7 +939,9 @@ RAYGUIAPI int GuiWindowBox(Rectangle bounds, const char *title);
 RAYGUIAPI int GuiGroupBox(Rectangle bounds, const char *text);                                         // Group Box control with text name
 RAYGUIAPI int GuiLine(Rectangle bounds, const char *text);                                             // Line separator control, could contain text
 RAYGUIAPI int GuiPanel(Rectangle bounds, const char *text);                                            // Panel control, useful to group controls
+#if !defined(RAYGUI_NO_TABBAR)
 RAYGUIAPI int GuiTabBar(Rectangle bounds, const char **text, int count, int *active);                  // Tab Bar control, returns TAB to be closed or -1
+#endif
 RAYGUIAPI int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector2 *scroll, Rectangle *view); // Scroll Panel control
 
 // Basic controls set
@@ -738,29 +955,42 @@ RAYGUIAPI int GuiCheckBox(Rectangle bounds, const char *text, bool *checked);
 RAYGUIAPI int GuiComboBox(Rectangle bounds, const char *text, int *active);                            // Combo Box control
 
 RAYGUIAPI int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMode);          // Dropdown Box control
+#if !defined(RAYGUI_NO_TEXTBOX)
 RAYGUIAPI int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode); // Spinner control
 RAYGUIAPI int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, int maxValue, bool editMode); // Value Box control, updates input text with numbers
 RAYGUIAPI int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float *value, bool editMode); // Value box control for float values
 RAYGUIAPI int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode);                   // Text Box control, updates input text
+#endif
 
 RAYGUIAPI int GuiSlider(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue); // Slider control
 RAYGUIAPI int GuiSliderBar(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue); // Slider Bar control
 RAYGUIAPI int GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRight, float *value, float minValue, float maxValue); // Progress Bar control
 RAYGUIAPI int GuiStatusBar(Rectangle bounds, const char *text);                                        // Status Bar control, shows info text
 RAYGUIAPI int GuiDummyRec(Rectangle bounds, const char *text);                                         // Dummy control for placeholders
+#if !defined(RAYGUI_NO_GRID)
 RAYGUIAPI int GuiGrid(Rectangle bounds, const char *text, float spacing, int subdivs, Vector2 *mouseCell); // Grid control
+#endif
 
 // Advance controls set
+#if !defined(RAYGUI_NO_LISTVIEW)
 RAYGUIAPI int GuiListView(Rectangle bounds, const char *text, int *scrollIndex, int *active);          // List View control
 RAYGUIAPI int GuiListViewEx(Rectangle bounds, const char **text, int count, int *scrollIndex, int *active, int *focus); // List View with extended parameters
+#endif
+#if !defined(RAYGUI_NO_MESSAGEBOX)
 RAYGUIAPI int GuiMessageBox(Rectangle bounds, const char *title, const char *message, const char *buttons); // Message Box control, displays a message
+#endif
+#if !defined(RAYGUI_NO_MESSAGEBOX) && !defined(RAYGUI_NO_TEXTBOX)
 RAYGUIAPI int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, const char *buttons, char *text, int textMaxSize, bool *secretViewActive); // Text Input Box control, ask for text, supports secret
+#endif
+#if !defined(RAYGUI_NO_COLORPICKER)
 RAYGUIAPI int GuiColorPicker(Rectangle bounds, const char *text, Color *color);                        // Color Picker control (multiple color controls)
 RAYGUIAPI int GuiColorPanel(Rectangle bounds, const char *text, Color *color);                         // Color Panel control
 RAYGUIAPI int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha);                      // Color Bar Alpha control
 RAYGUIAPI int GuiColorBarHue(Rectangle bounds, const char *text, float *value);                        // Color Bar Hue control
 RAYGUIAPI int GuiColorPickerHSV(Rectangle bounds, const char *text, Vector3 *colorHsv);                // Color Picker control that avoids conversion to RGB on each call (multiple color controls)
 RAYGUIAPI int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv);                 // Color Panel control that updates Hue-Saturation-Value color value, used by GuiColorPickerHSV()
+RAYGUIAPI int GuiColorPalette(Rectangle bounds, const char *text, const Color *colors, int count, int columns, int *active); // Color Palette control, swatches grid, returns true when a swatch is selected
+#endif
 //----------------------------------------------------------------------------------------------------------
 
 #if !defined(RAYGUI_NO_ICONS)
@@ -1049,7 +1279,45 @@ typedef enum {
 #include <stdlib.h>             // Required for: malloc(), calloc(), free() [GuiLoadStyle(), GuiLoadIcons()]
 #include <string.h>             // Required for: strlen() [GuiTextBox(), GuiValueBox()], memset(), memcpy()
 #include <stdarg.h>             // Required for: va_list, va_start(), vfprintf(), va_end() [TextFormat()]
-#include <math.h>               // Required for: roundf() [GuiColorPicker()]
+#include <math.h>               // Required for: roundf() [GuiColorPicker()], floor(), log10(), pow() [GuiFormatFloat()]
+
+#if !defined(RAYGUI_STANDALONE)
+    #include "rlgl.h"           // Required for: rlSetBlendFactorsSeparate() [GuiRenderCachedSurface()]
+#endif
+
+// SIMD support for text processing and colors conversion, detected from compiler target
+#if !defined(RAYGUI_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RAYGUI_SIMD_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics [GetTextLineSize(), GetTextAsciiRun(), GuiConvertHSVtoRGB()]
+        #if defined(__AVX2__)
+            #define RAYGUI_SIMD_AVX2
+            #include <immintrin.h>  // Required for: AVX2 intrinsics [GetTextAsciiRun()]
+        #endif
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #define RAYGUI_SIMD_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics [GetTextLineSize(), GetTextAsciiRun(), GuiConvertHSVtoRGB()]
+    #endif
+    #if defined(_MSC_VER)
+        #include <intrin.h>         // Required for: _BitScanForward() [GuiBitScanForward()]
+    #endif
+#endif
+
+// Features only used by excluded controls families are excluded too
+#if defined(RAYGUI_NO_TEXTBOX) && !defined(RAYGUI_NO_TEXT_UNDO)
+    #define RAYGUI_NO_TEXT_UNDO
+#endif
+#if defined(RAYGUI_NO_COLORPICKER) && !defined(RAYGUI_NO_COLOR_TEXTURES)
+    #define RAYGUI_NO_COLOR_TEXTURES
+#endif
+
+// Aligned SIMD loads can read some bytes after the end of the text (same page, never faulting),
+// address sanitizer does not know about it so those functions are excluded from instrumentation
+#if defined(__GNUC__) || defined(__clang__)
+    #define RAYGUI_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+    #define RAYGUI_NO_SANITIZE_ADDRESS
+#endif
 
 #ifdef __cplusplus
     #define RAYGUI_CLITERAL(name) name
@@ -1083,7 +1351,7 @@ typedef enum {
 // every 16x16 icon requires 8 integers (16*16/32) to be stored
 //
 // NOTE 2: A different icon set could be loaded over this array using GuiLoadIcons(),
-// but loaded icons set must be same RAYGUI_ICON_SIZE and no more than RAYGUI_ICON_MAX_ICONS
+// icons that do not fit in the array are not loaded, GuiSetIcons() can be used for bigger sets
 //
 // guiIcons size is by default: 256*(16*16/32) = 2048*4 = 8192 bytes = 8 KB
 //----------------------------------------------------------------------------------
@@ -1354,6 +1622,9 @@ static unsigned int *guiIconsPtr = guiIcons;
 #ifndef RAYGUI_ICON_SIZE
     #define RAYGUI_ICON_SIZE             0
 #endif
+#ifndef RAYGUI_ICON_MAX_ICONS
+    #define RAYGUI_ICON_MAX_ICONS        0
+#endif
 
 // WARNING: Those values define the total size of the style data array,
 // if changed, previous saved styles could become incompatible
@@ -1377,6 +1648,10 @@ static bool guiLocked = false;                  // Gui lock state (no inputs pro
 static float guiAlpha = 1.0f;                   // Gui controls transparency
 
 static unsigned int guiIconScale = 1;           // Gui icon default scale (if icons enabled)
+static int guiIconSize = RAYGUI_ICON_SIZE;      // Gui icons size of icons data in use (pixels, squared)
+#if !defined(RAYGUI_NO_ICONS)
+static int guiIconCount = RAYGUI_ICON_MAX_ICONS; // Gui icons count of icons data in use
+#endif
 
 static bool guiTooltip = false;                 // Tooltip enabled/disabled
 static const char *guiTooltipPtr = NULL;        // Tooltip string pointer (string provided by user)
@@ -1384,10 +1659,201 @@ static const char *guiTooltipPtr = NULL;        // Tooltip string pointer (strin
 static bool guiControlExclusiveMode = false;    // Gui control exclusive mode (no inputs processed except current control)
 static Rectangle guiControlExclusiveRec = { 0 }; // Gui control exclusive bounds rectangle, used as an unique identifier
 
+//----------------------------------------------------------------------------------
+// Gui Transform Global Variables
+//
+// NOTE: Controls bounds are transformed to screen: screen = bounds*scale + offset, mouse position
+// is transformed back to controls space, out of viewport (screen or scissor) controls are culled
+//----------------------------------------------------------------------------------
+#if !defined(RAYGUI_MAX_TRANSFORMS)
+    #define RAYGUI_MAX_TRANSFORMS       8       // Maximum nested transforms
+#endif
+
+typedef struct GuiTransform {
+    Vector2 offset;             // Transform translation (screen)
+    float scale;                // Transform uniform scale
+} GuiTransform;
+
+static GuiTransform guiTransform = { { 0.0f, 0.0f }, 1.0f };    // Current transform, combined with parents
+static GuiTransform guiTransformStack[RAYGUI_MAX_TRANSFORMS] = { 0 };   // Previous transforms, restored on GuiPopTransform()
+static int guiTransformCount = 0;           // Transforms pushed, culling only applied with transforms
+static Rectangle guiScissorRec = { 0 };     // Current scissor rectangle (screen), transformed viewport
+static bool guiScissorActive = false;       // Scissor mode active, viewport limited to scissor rectangle
+
+//----------------------------------------------------------------------------------
+// Gui Cached Regions Global Variables
+//
+// NOTE: Regions draw commands are recorded (transformed) when processed, and replayed while
+// version, bounds, transform and gui state are unchanged and mouse is not over region
+//----------------------------------------------------------------------------------
+#if !defined(RAYGUI_MAX_CACHED_REGIONS)
+    #define RAYGUI_MAX_CACHED_REGIONS   16      // Maximum cached regions
+#endif
+#if !defined(RAYGUI_SURFACES_MEMORY_BUDGET)
+    #define RAYGUI_SURFACES_MEMORY_BUDGET   (16*1024*1024)  // Cached surfaces render textures memory budget (bytes)
+#endif
+
+typedef struct GuiCachedRegion {
+    const void *key;            // Region key, NULL for unused region
+    unsigned int lastUsed;      // Last use counter value, to replace least recently used region
+    unsigned int version;       // Region content version, provided by user
+    Rectangle bounds;           // Region bounds
+    GuiTransform transform;     // Transform used on recording
+    GuiState state;             // Gui state used on recording
+    bool locked;                // Gui lock used on recording
+    float alpha;                // Gui alpha used on recording
+    bool valid;                 // Recorded commands can be replayed
+    GuiDrawCommand *commands;   // Recorded draw commands (transformed), buffer reused
+    int commandCount;           // Recorded draw commands count
+    int commandCapacity;        // Recorded draw commands buffer capacity
+    bool surface;               // Region is a cached surface, rendered into texture once recorded
+#if !defined(RAYGUI_STANDALONE)
+    RenderTexture2D target;     // Surface render texture, region bounds size (screen)
+    Rectangle targetRec;        // Surface render texture rectangle on screen (pixel aligned)
+    bool targetValid;           // Surface render texture contains recorded commands
+#endif
+} GuiCachedRegion;
+
+static GuiCachedRegion guiCachedRegions[RAYGUI_MAX_CACHED_REGIONS] = { 0 };    // Cached regions
+static unsigned int guiCachedRegionCounter = 0;     // Cached regions use counter
+static GuiCachedRegion *guiCachedRegionRecording = NULL;    // Cached region being recorded
+static int guiCachedRegionDepth = 0;                // Cached regions nesting depth, nested regions are not cached
+#if !defined(RAYGUI_STANDALONE)
+static int guiSurfacesMemory = 0;                   // Cached surfaces render textures memory (bytes)
+#endif
+
+#if !defined(RAYGUI_NO_TEXTBOX)
 static int textBoxCursorIndex = 0;              // Cursor index, shared by all GuiTextBox*()
 //static int blinkCursorFrameCounter = 0;       // Frame counter for cursor blinking
 static int autoCursorCooldownCounter = 0;       // Cooldown frame counter for automatic cursor movement on key-down
 static int autoCursorDelayCounter = 0;          // Delay frame counter for automatic cursor movement
+#endif
+
+static unsigned int guiFrameCounter = 1;        // Frame counter, advanced by GuiBeginFrame(), used to age internal caches
+static bool guiFrameManual = false;             // Frame counter advanced by GuiBeginFrame(), time based otherwise
+static GuiStats guiStats = { 0 };               // Gui internal stats for current frame
+
+#if !defined(RAYGUI_DRAW_STREAM_OCCLUDERS)
+    #define RAYGUI_DRAW_STREAM_OCCLUDERS    32      // Opaque fills considered by occlusion culling, largest ones are kept
+#endif
+#if !defined(RAYGUI_DRAW_STREAM_MERGE_DISTANCE)
+    #define RAYGUI_DRAW_STREAM_MERGE_DISTANCE   32  // Previous draw commands checked for same color rectangles merging
+#endif
+
+#define DRAW_COMMAND_REMOVED    -1              // Draw command removed by draw stream processing
+
+static GuiDrawCommand *guiDrawCommands = NULL;  // Draw stream commands, buffer reused between frames
+static int guiDrawCommandCount = 0;             // Draw stream commands count
+static int guiDrawCommandCapacity = 0;          // Draw stream commands buffer capacity
+static bool guiDrawStreamActive = false;        // Draw stream recording state
+static int guiDrawStreamFlags = 0;              // Draw stream processing flags
+
+static GuiDrawData guiDrawData = { 0 };         // Draw stream vertex arrays, buffers reused between frames
+static int guiDrawVertexCapacity = 0;           // Draw data vertices buffer capacity
+static int guiDrawIndexCapacity = 0;            // Draw data indices buffer capacity
+static int guiDrawRangeCapacity = 0;            // Draw data ranges buffer capacity
+static bool guiDrawDataExternal = false;        // Draw data buffers provided by user, not grown or freed
+static Texture2D guiShapesTexture = { 0 };      // Shapes texture set by raygui (SetShapesTexture()), used on vertex arrays export
+static Rectangle guiShapesRec = { 0 };          // Shapes texture white rectangle
+
+#if !defined(RAYGUI_NO_TEXTBOX)
+#if !defined(RAYGUI_VALUE_TEXT_CACHE_SIZE)
+    #define RAYGUI_VALUE_TEXT_CACHE_SIZE    64      // Value boxes with value text cached (power of 2)
+#endif
+
+// Value text cache entry, value is formatted again only when it changes
+typedef struct GuiValueTextEntry {
+    const int *key;             // Value address, NULL for empty entry
+    int value;                  // Value formatted
+    int length;                 // Text length
+    char text[12];              // Value text
+} GuiValueTextEntry;
+
+static GuiValueTextEntry guiValueTextCache[RAYGUI_VALUE_TEXT_CACHE_SIZE] = { 0 };   // Value text cache, direct mapped by value address
+#endif
+
+#if !defined(RAYGUI_NO_COLOR_TEXTURES)
+#if !defined(RAYGUI_COLOR_TEXTURE_CACHE_SIZE)
+    #define RAYGUI_COLOR_TEXTURE_CACHE_SIZE   4     // Color panel and hue bar textures, least recently used one is replaced
+#endif
+
+// Color texture cache entry: color panel saturation-value square for one hue, or hue bar
+typedef struct GuiColorTextureEntry {
+    Texture2D texture;          // Texture with exact colors, id 0 for empty entry
+    float hue;                  // Color panel hue, -1.0f for hue bar
+    unsigned int lastUsed;      // Last use counter value, to replace least recently used entry
+} GuiColorTextureEntry;
+
+static GuiColorTextureEntry guiColorTextures[RAYGUI_COLOR_TEXTURE_CACHE_SIZE] = { 0 };   // Color textures cache
+static unsigned int guiColorTextureCounter = 0;     // Color textures use counter
+#endif
+
+#if !defined(RAYGUI_NO_TEXT_CACHE)
+#if !defined(RAYGUI_TEXT_CACHE_SIZE)
+    #define RAYGUI_TEXT_CACHE_SIZE      512     // Text measurement cache entries (power of 2)
+#endif
+#if !defined(RAYGUI_TEXT_CACHE_WAYS)
+    #define RAYGUI_TEXT_CACHE_WAYS        4     // Text measurement cache entries per hash set
+#endif
+#if !defined(RAYGUI_TEXT_CACHE_MAX_AGE)
+    #define RAYGUI_TEXT_CACHE_MAX_AGE   120     // Frames (or 1/60 s ticks) an entry is kept without being used
+#endif
+
+// Text measurement cache entry
+// NOTE: Entries are identified by text bytes hash and length, plus the font/size/spacing used to measure,
+// a second independent hash of text bytes is checked on hit, so hash collisions are not reported as hits
+typedef struct GuiTextCacheEntry {
+    unsigned int hash;          // Text bytes hash (FNV-1a)
+    unsigned int check;         // Text bytes second hash (rotate-multiply), independent of hash
+    unsigned int fontKey;       // Font id, size and spacing hash
+    int length;                 // Text length in bytes
+    unsigned int frame;         // Last frame entry was used, 0 for empty entry
+    float width;                // Measured text width (without icon)
+} GuiTextCacheEntry;
+
+static GuiTextCacheEntry guiTextCache[RAYGUI_TEXT_CACHE_SIZE] = { 0 };   // Text measurement cache, fixed size
+#endif
+
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+#if !defined(RAYGUI_TEXT_UNDO_MAX_CONTROLS)
+    #define RAYGUI_TEXT_UNDO_MAX_CONTROLS    8      // Text controls with undo history, least recently used one is replaced
+#endif
+#if !defined(RAYGUI_TEXT_UNDO_MAX_STEPS)
+    #define RAYGUI_TEXT_UNDO_MAX_STEPS      64      // Undo steps per control (ring buffer)
+#endif
+#if !defined(RAYGUI_TEXT_UNDO_DATA_SIZE)
+    #define RAYGUI_TEXT_UNDO_DATA_SIZE    1024      // Edited bytes stored per control (ring buffer)
+#endif
+
+// Text undo step: replace deleted bytes by inserted bytes at position
+// NOTE: Step data is stored in history data ring, deleted bytes followed by inserted bytes
+typedef struct GuiTextUndoStep {
+    int position;               // Edit position in text (bytes)
+    int deleted;                // Bytes deleted at position
+    int inserted;               // Bytes inserted at position
+    unsigned int data;          // Step data offset (absolute, wrapped to data ring size)
+} GuiTextUndoStep;
+
+// Text undo history for one control
+typedef struct GuiTextUndoHistory {
+    const void *key;            // Text buffer (or value) edited by the control, NULL for unused history
+    unsigned int lastUsed;      // Last use counter value, to replace least recently used history
+    GuiTextUndoStep steps[RAYGUI_TEXT_UNDO_MAX_STEPS];  // Steps ring buffer
+    unsigned int first;         // Oldest step (absolute, wrapped to steps ring size)
+    unsigned int count;         // Steps recorded
+    unsigned int current;       // Steps applied, next ones can be redone
+    unsigned int dataHead;      // Next free data byte (absolute, wrapped to data ring size)
+    bool coalesce;              // Last step can be extended by next edit (typing burst)
+    char data[RAYGUI_TEXT_UNDO_DATA_SIZE];              // Steps data ring buffer
+} GuiTextUndoHistory;
+
+static GuiTextUndoHistory guiTextUndo[RAYGUI_TEXT_UNDO_MAX_CONTROLS] = { 0 };  // Text controls undo history
+static unsigned int guiTextUndoCounter = 0;     // Text undo history use counter
+#endif
+
+static float guiAsciiAdvance[128] = { 0 };      // ASCII glyphs width for current font and text size, spacing not included
+static unsigned int guiAsciiAdvanceKey = 0;     // Font key used to compute ASCII glyphs width table
+static bool guiAsciiAdvanceReady = false;       // ASCII glyphs width table computed flag
 
 //----------------------------------------------------------------------------------
 // Style data array for all gui style properties (allocated on data segment by default)
@@ -1405,6 +1871,41 @@ static unsigned int guiStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI
 
 static bool guiStyleLoaded = false;         // Style loaded flag for lazy style initialization
 
+//----------------------------------------------------------------------------------
+// Gui Skin Global Variables
+//
+// NOTE: Controls with SKIN_SLICE property are drawn as nine textured quads from skin texture,
+// slice for a control state is: SKIN_SLICE - 1 + state. Skin texture defaults to gui font atlas,
+// same texture as text and shapes (SetShapesTexture()), so full UI can be drawn in a single batch
+//----------------------------------------------------------------------------------
+#if !defined(RAYGUI_MAX_SKIN_SLICES)
+    #define RAYGUI_MAX_SKIN_SLICES      64      // Maximum skin slices
+#endif
+
+static GuiSkinSlice guiSkinSlices[RAYGUI_MAX_SKIN_SLICES] = { 0 };  // Skin slices
+static int guiSkinSliceCount = 0;           // Skin slices loaded, 0 for no skin
+static Texture2D guiSkinTexture = { 0 };    // Skin texture, id 0 uses gui font atlas texture
+
+//----------------------------------------------------------------------------------
+// Gui Rounded Rectangles Global Variables
+//
+// NOTE: Corner atlas contains anti-aliased rounded rectangles for some radius values, filled and
+// bordered (border width 1..4), every shape is (2*radius + 2) pixels wide and it is drawn as a
+// nine-slice: corners keep size, 2 pixels edges and center are stretched, 9 quads per shape.
+// Corner atlas is packed under the font atlas image of styles loaded by raygui, like skins, so
+// rounded rectangles use the same texture as text and shapes; fonts not loaded by raygui
+// (default font, GuiSetFont()) use a separate texture, released by style loading
+//----------------------------------------------------------------------------------
+#define RAYGUI_CORNER_RADIUS_COUNT      7       // Corner atlas radius values
+#define RAYGUI_CORNER_MAX_BORDER        4       // Corner atlas maximum border width
+#define RAYGUI_CORNER_CELL_SIZE        36       // Corner atlas cell width, for max radius shape and padding
+#define RAYGUI_CORNER_ATLAS_WIDTH     ((RAYGUI_CORNER_MAX_BORDER + 1)*RAYGUI_CORNER_CELL_SIZE)  // Corner atlas width
+
+static const int guiCornerRadius[RAYGUI_CORNER_RADIUS_COUNT] = { 2, 3, 4, 6, 8, 12, 16 };   // Corner atlas radius values
+static Texture2D guiCornerAtlas = { 0 };    // Corner atlas separate texture, generated on first rounded rectangle if required
+static unsigned int guiCornerFontId = 0;    // Font atlas texture id containing corner atlas, 0 if none
+static int guiCornerOffsetY = 0;            // Corner atlas position in font atlas
+
 //----------------------------------------------------------------------------------
 // Standalone Mode Functions Declaration
 //
@@ -1419,9 +1920,18 @@ static bool guiStyleLoaded = false;         // Style loaded flag for lazy style
 #define KEY_UP              265
 #define KEY_BACKSPACE       259
 #define KEY_ENTER           257
+#define KEY_V                86
+#define KEY_Y                89
+#define KEY_Z                90
+#define KEY_LEFT_SHIFT      340
+#define KEY_LEFT_CONTROL    341
+#define KEY_RIGHT_SHIFT     344
+#define KEY_RIGHT_CONTROL   345
 
 #define MOUSE_LEFT_BUTTON     0
 
+#define PIXELFORMAT_UNCOMPRESSED_R8G8B8A8   7
+
 // Input required functions
 //-------------------------------------------------------------------------------
 static Vector2 GetMousePosition(void);
@@ -1433,12 +1943,18 @@ static bool IsMouseButtonReleased(int button);
 static bool IsKeyDown(int key);
 static bool IsKeyPressed(int key);
 static int GetCharPressed(void);         // -- GuiTextBox(), GuiValueBox()
+static const char *GetClipboardText(void);  // -- GuiTextBox()
 //-------------------------------------------------------------------------------
 
 // Drawing required functions
 //-------------------------------------------------------------------------------
 static void DrawRectangle(int x, int y, int width, int height, Color color);        // -- GuiDrawRectangle()
 static void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4); // -- GuiColorPicker()
+static void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // -- GuiColorPicker(), GuiSetSkin(), GuiDrawRectangle() rounded
+static void UpdateTexture(Texture2D texture, const void *pixels);   // -- GuiColorPicker(), update cached color texture
+static void UnloadTexture(Texture2D texture);                       // -- GuiColorPicker(), GuiLoadStyle()
+static void BeginScissorMode(int x, int y, int width, int height);  // -- GuiBeginScissor()
+static void EndScissorMode(void);                                   // -- GuiEndScissor()
 //-------------------------------------------------------------------------------
 
 // Text required functions
@@ -1472,8 +1988,6 @@ static float TextToFloat(const char *text);         // Get float value from text
 
 static int GetCodepointNext(const char *text, int *codepointSize);  // Get next codepoint in a UTF-8 encoded text
 static const char *CodepointToUTF8(int codepoint, int *byteSize);   // Encode codepoint into UTF-8 text (char array size returned as parameter)
-
-static void DrawRectangleGradientV(int posX, int posY, int width, int height, Color color1, Color color2);  // Draw rectangle vertical gradient
 //-------------------------------------------------------------------------------
 
 #endif      // RAYGUI_STANDALONE
@@ -1482,17 +1996,81 @@ static void DrawRectangleGradientV(int posX, int posY, int width, int height, Co
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize);    // Load style from memory (binary only)
+static void GuiUpdateFrame(void);                               // Update time based frame counter, resetting stats on frame change
 
 static int GetTextWidth(const char *text);                      // Gui get text width using gui font and style
+static unsigned int GetFontKey(float fontSize, float spacing);  // Get key identifying current font and style
+static int GetTextLineSize(const char *text);                   // Get text size in bytes until end of text or line break
+static int GetTextAsciiRun(const char *text, int length);       // Get number of ASCII bytes at the start of text
+static const float *GetTextAsciiAdvances(void);                 // Get ASCII glyphs width table for current font and text size
+static float GetGlyphWidth(int codepoint);                      // Get glyph width for codepoint, using current font and text size
+#if !defined(RAYGUI_NO_TEXT_CACHE)
+static unsigned int GetTextHash(const char *text, int length, unsigned int *check);  // Get text bytes hash (FNV-1a) and second independent hash
+static bool GuiTextCacheGet(unsigned int hash, unsigned int check, int length, unsigned int fontKey, float *width);  // Get text width from cache
+static void GuiTextCacheSet(unsigned int hash, unsigned int check, int length, unsigned int fontKey, float width);   // Store text width into cache
+#endif
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+static GuiTextUndoHistory *GetTextUndoHistory(const void *key, bool create);  // Get text undo history for key text/value
+static void GuiTextUndoRecord(const void *key, int position, const char *deleted, int deletedLength, const char *inserted, int insertedLength);  // Record text edit
+static bool GuiTextUndoUpdate(const void *key, char *text, int textSize, int *cursor);  // Check undo/redo keys and apply step to text
+static void GuiTextUndoBreak(const void *key);                  // Finish current typing burst, next edit starts a new step
+#endif
+static int GuiFormatUnsigned(char *buffer, unsigned long long value, int minDigits);  // Format unsigned integer as text, zero padded to minDigits
+#if !defined(RAYGUI_NO_TEXTBOX)
+static const char *GetValueText(const int *value, int *length); // Get value text from value boxes cache, formatted again if value changed
+static int GetTextValidSequence(const char *text, int length, bool multiline);  // Get size of valid UTF-8 sequence at start of text
+static int GuiTextInsert(char *text, int textSize, int textLength, int position, const char *insert, int insertLength, bool multiline);  // Insert validated UTF-8 text span
+#endif
 static Rectangle GetTextBounds(int control, Rectangle bounds);  // Get text bounds considering control bounds
 static const char *GetTextIcon(const char *text, int *iconId);  // Get text icon if provided and move text cursor
 
 static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, Color tint);     // Gui draw text using default font
 static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color);   // Gui draw rectangle using default raygui style
+static bool GuiDrawSkin(int control, int state, Rectangle rec); // Gui draw control skin slice for state (nine quads), false if control has no skin
+static void GuiDrawNineSlice(Texture2D texture, GuiSkinSlice slice, Rectangle rec, Color tint, bool center);  // Gui draw texture nine-slice (nine quads)
+static int GetCornerIndex(Rectangle rec, int borderWidth);      // Get corner atlas radius index for rectangle, -1 for square corners
+static GuiSkinSlice GetCornerSlice(int cornerIndex, int borderWidth, int offsetY); // Get corner atlas nine-slice for radius index and border width (0 for filled)
+static void GenCornerAtlas(unsigned char *pixels, int width, int channels, int offsetY); // Generate corner atlas coverage into pixels buffer
+#if !defined(RAYGUI_STANDALONE)
+static int GuiPackCornerAtlas(Image *image);                    // Pack corner atlas under font atlas image, returns its position
+#endif
+static void GuiUnloadCornerAtlas(void);                         // Unload corner atlas separate texture
+
+static void GuiDrawFill(int x, int y, int width, int height, Color color); // Gui draw filled rectangle (draw command)
+#if !defined(RAYGUI_NO_COLORPICKER)
+static void GuiDrawGradient(Rectangle rec, Color topLeft, Color bottomLeft, Color bottomRight, Color topRight); // Gui draw gradient rectangle (draw command)
+#endif
+static void GuiDrawTexture(Texture2D texture, Rectangle source, Rectangle dest, Color tint); // Gui draw texture rectangle (draw command)
+static void GuiDrawGlyph(int codepoint, Vector2 position, Color tint);  // Gui draw gui font glyph using text size (draw command)
+static void GuiPushDrawCommand(GuiDrawCommand command);         // Record draw command in draw stream or draw it
+static void GuiEmitDrawCommand(GuiDrawCommand command);         // Add screen draw command to draw stream or draw it
+static bool GuiBeginCachedRegionEx(const void *key, Rectangle bounds, unsigned int version, bool surface);   // Begin cached region or surface
+static void GuiCachedRegionEdit(bool editMode);                 // Keep cached region being recorded from replay while a control is edited
+#if !defined(RAYGUI_STANDALONE)
+static void GuiRenderCachedSurface(GuiCachedRegion *region);    // Render cached surface recorded commands into its render texture
+static void GuiUnloadCachedSurface(GuiCachedRegion *region);    // Unload cached surface render texture
+#endif
+static void GuiRunDrawCommand(const GuiDrawCommand *command);   // Draw command using backend drawing functions
+static void GuiMergeDrawStream(void);                           // Merge same color rectangles into previous ones, keeping painter's order
+static void GuiCullDrawStream(void);                            // Remove draw commands fully covered by later opaque fills
+static Vector2 GetTransformedMousePosition(void);               // Get mouse position in current transform space
+static Rectangle GetTransformedRec(Rectangle rec);              // Get rectangle transformed to screen by current transform
+static bool GuiIsCulled(Rectangle bounds);                      // Check if bounds are out of transformed viewport (only with transforms)
+static void GuiBuildDrawData(void);                             // Build vertex arrays from draw stream commands
+#if !defined(RAYGUI_NO_ICONS)
+static void GuiDrawIconRuns(const GuiDrawCommand *command, const Rectangle *scissor);  // Draw icon command as rectangles, one per run of set pixels in a row
+#endif
+static void GuiPushDrawQuad(unsigned int textureId, Rectangle scissor, bool premultiplied, Rectangle rec, Rectangle uv, const Color *colors);    // Add quad to draw data
+static void *GuiGrowDrawBuffer(void *buffer, int *capacity, int count, int itemSize);      // Grow draw data buffer to fit count items
 
 static const char **GuiTextSplit(const char *text, char delimiter, int *count, int *textRow);   // Split controls text into multiple strings
+#if !defined(RAYGUI_NO_COLORPICKER)
 static Vector3 ConvertHSVtoRGB(Vector3 hsv);                    // Convert color data from HSV to RGB
 static Vector3 ConvertRGBtoHSV(Vector3 rgb);                    // Convert color data from RGB to HSV
+#endif
+#if !defined(RAYGUI_NO_COLOR_TEXTURES)
+static Texture2D GetColorTexture(float hue, int width, int height); // Get cached color panel (hue) or hue bar (hue < 0) texture
+#endif
 
 static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue);   // Scroll bar control, used by GuiScrollPanel()
 static void GuiTooltip(Rectangle controlRec);                   // Draw tooltip using control rec position
@@ -1534,783 +2112,1090 @@ void GuiSetState(int state) { guiState = (GuiState)state; }
 // Get gui state (global state)
 int GuiGetState(void) { return guiState; }
 
-// Set custom gui font
-// NOTE: Font loading/unloading is external to raygui
-void GuiSetFont(Font font)
+// Begin gui frame
+// NOTE: Optional, it advances the frame counter used to age internal caches and resets frame stats,
+// if never called, caches are aged and stats reset by time instead (required in RAYGUI_STANDALONE mode)
+void GuiBeginFrame(void)
 {
-    if (font.texture.id > 0)
-    {
-        // NOTE: If we try to setup a font but default style has not been
-        // lazily loaded before, it will be overwritten, so we need to force
-        // default style loading first
-        if (!guiStyleLoaded) GuiLoadStyleDefault();
+    guiFrameManual = true;
+    guiFrameCounter++;
+    if (guiFrameCounter == 0) guiFrameCounter = 1;  // Frame 0 reserved for empty cache entries
 
-        guiFont = font;
-    }
+    memset(&guiStats, 0, sizeof(GuiStats));
 }
 
-// Get custom gui font
-Font GuiGetFont(void)
+// Update frame counter by time (60 ticks per second) if frames are not provided by GuiBeginFrame()
+// NOTE: Frame stats are reset on frame change, same as GuiBeginFrame() does
+static void GuiUpdateFrame(void)
 {
-    return guiFont;
-}
+#if !defined(RAYGUI_STANDALONE)
+    if (guiFrameManual) return;
 
-// Set control style property value
-void GuiSetStyle(int control, int property, int value)
-{
-    if (!guiStyleLoaded) GuiLoadStyleDefault();
-    guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+    unsigned int frame = (unsigned int)(GetTime()*60.0) + 1;
+    if (frame == 0) frame = 1;      // Frame 0 reserved for empty cache entries
 
-    // Default properties are propagated to all controls
-    if ((control == 0) && (property < RAYGUI_MAX_PROPS_BASE))
+    if (frame != guiFrameCounter)
     {
-        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++) guiStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+        guiFrameCounter = frame;
+        memset(&guiStats, 0, sizeof(GuiStats));
     }
+#endif
 }
 
-// Get control style property value
-int GuiGetStyle(int control, int property)
+// Push gui transform (translate and uniform scale), applied to controls input and drawing
+// NOTE: Transform is combined with current one, offset is in current transform space
+void GuiPushTransform(Vector2 offset, float scale)
 {
-    if (!guiStyleLoaded) GuiLoadStyleDefault();
-    return guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
+    if (guiTransformCount < RAYGUI_MAX_TRANSFORMS)
+    {
+        guiTransformStack[guiTransformCount] = guiTransform;
+
+        guiTransform.offset.x += offset.x*guiTransform.scale;
+        guiTransform.offset.y += offset.y*guiTransform.scale;
+        guiTransform.scale *= scale;
+    }
+    else RAYGUI_LOG("WARNING: Gui transforms stack is full, transform not applied");
+
+    guiTransformCount++;
 }
 
-//----------------------------------------------------------------------------------
-// Gui Controls Functions Definition
-//----------------------------------------------------------------------------------
+// Pop gui transform, previous transform restored
+void GuiPopTransform(void)
+{
+    if (guiTransformCount <= 0) return;
 
-// Window Box control
-int GuiWindowBox(Rectangle bounds, const char *title)
+    guiTransformCount--;
+    if (guiTransformCount < RAYGUI_MAX_TRANSFORMS) guiTransform = guiTransformStack[guiTransformCount];
+}
+
+// Get gui internal stats for current frame
+GuiStats GuiGetStats(void)
 {
-    // Window title bar height (including borders)
-    // NOTE: This define is also used by GuiMessageBox() and GuiTextInputBox()
-    #if !defined(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
-        #define RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT        24
-    #endif
+    GuiUpdateFrame();
 
-    int result = 0;
-    //GuiState state = guiState;
+    GuiStats stats = guiStats;
+    stats.frame = guiFrameCounter;
+#if !defined(RAYGUI_STANDALONE)
+    stats.surfacesMemory = guiSurfacesMemory;
+#endif
 
-    int statusBarHeight = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT;
+    return stats;
+}
 
-    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)statusBarHeight };
-    if (bounds.height < statusBarHeight*2.0f) bounds.height = statusBarHeight*2.0f;
+// Begin recording gui draw commands instead of drawing
+// NOTE: Only raygui drawing is recorded, any other drawing until GuiEndDrawStream() is drawn below the gui
+// WARNING: Recorded commands are drawn by GuiEndDrawStream(), so BeginScissorMode() and BeginMode2D() called
+// while recording have no effect on them; use GuiBeginScissor()/GuiEndScissor() (recorded as scissor commands)
+// and GuiPushTransform()/GuiPopTransform() instead, or enclose the whole stream in BeginMode2D()/EndMode2D()
+void GuiBeginDrawStream(int flags)
+{
+    guiDrawCommandCount = 0;
+    guiDrawStreamFlags = flags;
+    guiDrawStreamActive = true;
+}
 
-    Rectangle windowPanel = { bounds.x, bounds.y + (float)statusBarHeight - 1, bounds.width, bounds.height - (float)statusBarHeight + 1 };
-    Rectangle closeButtonRec = { statusBar.x + statusBar.width - GuiGetStyle(STATUSBAR, BORDER_WIDTH) - 20,
-                                 statusBar.y + statusBarHeight/2.0f - 18.0f/2.0f, 18, 18 };
+// End recording gui draw commands, process and draw them
+void GuiEndDrawStream(void)
+{
+    if (!guiDrawStreamActive) return;
 
-    // Update control
-    //--------------------------------------------------------------------
-    // NOTE: Logic is directly managed by button
-    //--------------------------------------------------------------------
+    guiDrawStreamActive = false;
+    GuiUpdateFrame();
+    guiStats.drawCommands += guiDrawCommandCount;
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiStatusBar(statusBar, title); // Draw window header as status bar
-    GuiPanel(windowPanel, NULL);    // Draw window base
+    if (guiDrawStreamFlags & (DRAW_STREAM_MERGE_RECTANGLES | DRAW_STREAM_CULL_OCCLUDED))
+    {
+        // NOTE: Merging first, merged rectangles are larger occluders
+        if (guiDrawStreamFlags & DRAW_STREAM_MERGE_RECTANGLES) GuiMergeDrawStream();
+        if (guiDrawStreamFlags & DRAW_STREAM_CULL_OCCLUDED) GuiCullDrawStream();
 
-    // Draw window close button
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-#if defined(RAYGUI_NO_ICONS)
-    result = GuiButton(closeButtonRec, "x");
-#else
-    result = GuiButton(closeButtonRec, GuiIconText(ICON_CROSS_SMALL, NULL));
-#endif
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
-    //--------------------------------------------------------------------
+        // Remove merged and culled commands, keeping commands order
+        int count = 0;
+        for (int i = 0; i < guiDrawCommandCount; i++)
+        {
+            if (guiDrawCommands[i].type != DRAW_COMMAND_REMOVED) guiDrawCommands[count++] = guiDrawCommands[i];
+        }
 
-    return result;      // Window close button clicked: result = 1
+        guiDrawCommandCount = count;
+    }
+
+    if (guiDrawStreamFlags & DRAW_STREAM_EXPORT_VERTICES) GuiBuildDrawData();
+    else if (!(guiDrawStreamFlags & DRAW_STREAM_EXPORT_COMMANDS)) for (int i = 0; i < guiDrawCommandCount; i++) GuiRunDrawCommand(&guiDrawCommands[i]);
 }
 
-// Group Box control with text name
-int GuiGroupBox(Rectangle bounds, const char *text)
+// Get draw commands of last draw stream (after processing)
+// NOTE: Returned commands are valid until next GuiBeginDrawStream()
+const GuiDrawCommand *GuiGetDrawStream(int *count)
 {
-    #if !defined(RAYGUI_GROUPBOX_LINE_THICK)
-        #define RAYGUI_GROUPBOX_LINE_THICK     1
-    #endif
+    if (count != NULL) *count = guiDrawCommandCount;
 
-    int result = 0;
-    GuiState state = guiState;
+    return guiDrawCommands;
+}
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)));
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, RAYGUI_GROUPBOX_LINE_THICK }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)));
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - 1, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)));
+// Begin scissor mode, recorded in draw stream
+void GuiBeginScissor(Rectangle bounds)
+{
+    bounds = GetTransformedRec(bounds);
 
-    GuiLine(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y - GuiGetStyle(DEFAULT, TEXT_SIZE)/2, bounds.width, (float)GuiGetStyle(DEFAULT, TEXT_SIZE) }, text);
-    //--------------------------------------------------------------------
+    GuiDrawCommand command = { 0 };
+    command.type = DRAW_COMMAND_SCISSOR_BEGIN;
+    command.rec = RAYGUI_CLITERAL(Rectangle){ (float)((int)bounds.x), (float)((int)bounds.y), (float)((int)bounds.width), (float)((int)bounds.height) };
 
-    return result;
+    guiScissorRec = command.rec;
+    guiScissorActive = true;
+
+    GuiPushDrawCommand(command);
 }
 
-// Line control
-int GuiLine(Rectangle bounds, const char *text)
+// End scissor mode, recorded in draw stream
+void GuiEndScissor(void)
 {
-    #if !defined(RAYGUI_LINE_ORIGIN_SIZE)
-        #define RAYGUI_LINE_MARGIN_TEXT  12
-    #endif
-    #if !defined(RAYGUI_LINE_TEXT_PADDING)
-        #define RAYGUI_LINE_TEXT_PADDING  4
-    #endif
+    GuiDrawCommand command = { 0 };
+    command.type = DRAW_COMMAND_SCISSOR_END;
 
-    int result = 0;
-    GuiState state = guiState;
+    guiScissorActive = false;
 
-    Color color = GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR));
+    GuiPushDrawCommand(command);
+}
 
-    // Draw control
-    //--------------------------------------------------------------------
-    if (text == NULL) GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height/2, bounds.width, 1 }, 0, BLANK, color);
-    else
+// Begin cached region, returns true if region controls must be processed
+// NOTE: Region is replayed (returns false) while version, bounds, transform and gui state are unchanged,
+// mouse is not over bounds and no control is in exclusive or edit mode. Regions controls must not have effects
+// other than drawing out of version changes, style changes must be reflected on version
+bool GuiBeginCachedRegion(const void *key, Rectangle bounds, unsigned int version)
+{
+    return GuiBeginCachedRegionEx(key, bounds, version, false);
+}
+
+// End cached region, required after GuiBeginCachedRegion() in any case
+void GuiEndCachedRegion(void)
+{
+    if (guiCachedRegionDepth <= 0) return;
+
+    guiCachedRegionDepth--;
+    if (guiCachedRegionDepth == 0)
     {
-        Rectangle textBounds = { 0 };
-        textBounds.width = (float)GetTextWidth(text) + 2;
-        textBounds.height = bounds.height;
-        textBounds.x = bounds.x + RAYGUI_LINE_MARGIN_TEXT;
-        textBounds.y = bounds.y;
+        // Exclusive mode started inside region (i.e. slider dragging), controls must keep being processed
+        if ((guiCachedRegionRecording != NULL) && guiControlExclusiveMode) guiCachedRegionRecording->valid = false;
 
-        // Draw line with embedded text label: "--- text --------------"
-        GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height/2, RAYGUI_LINE_MARGIN_TEXT - RAYGUI_LINE_TEXT_PADDING, 1 }, 0, BLANK, color);
-        GuiDrawText(text, textBounds, TEXT_ALIGN_LEFT, color);
-        GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + 12 + textBounds.width + 4, bounds.y + bounds.height/2, bounds.width - textBounds.width - RAYGUI_LINE_MARGIN_TEXT - RAYGUI_LINE_TEXT_PADDING, 1 }, 0, BLANK, color);
+#if !defined(RAYGUI_STANDALONE)
+        if ((guiCachedRegionRecording != NULL) && guiCachedRegionRecording->surface && guiCachedRegionRecording->valid) GuiRenderCachedSurface(guiCachedRegionRecording);
+#endif
+        guiCachedRegionRecording = NULL;
     }
-    //--------------------------------------------------------------------
+}
 
-    return result;
+// Begin cached surface, region drawn as a single textured quad while unchanged
+// NOTE: Surface is rendered into a render texture once processed (not hovered), replayed as cached region
+// if memory budget is exceeded or in RAYGUI_STANDALONE mode. Surface alpha accumulates coverage (separate
+// blend factors) and it is composited with premultiplied alpha, so translucent controls look as drawn on screen
+// WARNING: Surface is rendered with BeginTextureMode() at GuiEndCachedSurface(), that resets BeginMode2D() camera,
+// BeginScissorMode() and BeginBlendMode() states set by the caller, they must not enclose cached surfaces,
+// use GuiPushTransform() and GuiBeginScissor() instead (surface is replayed as cached region inside GuiBeginScissor())
+bool GuiBeginCachedSurface(const void *key, Rectangle bounds, unsigned int version)
+{
+    return GuiBeginCachedRegionEx(key, bounds, version, true);
 }
 
-// Panel control
-int GuiPanel(Rectangle bounds, const char *text)
+// End cached surface, required after GuiBeginCachedSurface() in any case
+void GuiEndCachedSurface(void)
 {
-    #if !defined(RAYGUI_PANEL_BORDER_WIDTH)
-        #define RAYGUI_PANEL_BORDER_WIDTH   1
-    #endif
+    GuiEndCachedRegion();
+}
 
-    int result = 0;
-    GuiState state = guiState;
+// Unload all cached surfaces render textures
+// NOTE: Surfaces are rendered again when processed, required before closing window
+void GuiUnloadCachedSurfaces(void)
+{
+#if !defined(RAYGUI_STANDALONE)
+    for (int i = 0; i < RAYGUI_MAX_CACHED_REGIONS; i++)
+    {
+        GuiUnloadCachedSurface(&guiCachedRegions[i]);
 
-    // Text will be drawn as a header bar (if provided)
-    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT };
-    if ((text != NULL) && (bounds.height < RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f)) bounds.height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f;
+        // Region without surface texture would be replayed from its recorded commands
+        if (guiCachedRegions[i].surface) guiCachedRegions[i].valid = false;
+    }
+#endif
+}
 
-    if (text != NULL)
+// Get vertex arrays of last draw stream (DRAW_STREAM_EXPORT_VERTICES)
+// NOTE: Returned arrays are valid until next GuiEndDrawStream(), ready to be uploaded as is
+GuiDrawData GuiGetDrawData(void)
+{
+    return guiDrawData;
+}
+
+// Set draw data buffers, NULL for internal growable buffers
+// NOTE: Provided buffers are not grown, quads not fitting are dropped (GuiDrawData.droppedQuads)
+void GuiSetDrawDataBuffers(GuiDrawVertex *vertices, int maxVertices, unsigned short *indices, int maxIndices, GuiDrawRange *ranges, int maxRanges)
+{
+    if (!guiDrawDataExternal)
     {
-        // Move panel bounds after the header bar
-        bounds.y += (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 1;
-        bounds.height -= (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 1;
+        RAYGUI_FREE(guiDrawData.vertices);
+        RAYGUI_FREE(guiDrawData.indices);
+        RAYGUI_FREE(guiDrawData.ranges);
     }
 
-    // Draw control
-    //--------------------------------------------------------------------
-    if (text != NULL) GuiStatusBar(statusBar, text);  // Draw panel header as status bar
+    guiDrawData = RAYGUI_CLITERAL(GuiDrawData){ 0 };
+    guiDrawDataExternal = ((vertices != NULL) && (indices != NULL) && (ranges != NULL));
 
-    GuiDrawRectangle(bounds, RAYGUI_PANEL_BORDER_WIDTH, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED: LINE_COLOR)),
-                     GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BASE_COLOR_DISABLED : BACKGROUND_COLOR)));
-    //--------------------------------------------------------------------
+    if (guiDrawDataExternal)
+    {
+        guiDrawData.vertices = vertices;
+        guiDrawData.indices = indices;
+        guiDrawData.ranges = ranges;
+        guiDrawVertexCapacity = maxVertices;
+        guiDrawIndexCapacity = maxIndices;
+        guiDrawRangeCapacity = maxRanges;
+    }
+    else
+    {
+        guiDrawVertexCapacity = 0;
+        guiDrawIndexCapacity = 0;
+        guiDrawRangeCapacity = 0;
+    }
+}
 
-    return result;
+// Clear undo history of text controls editing key text/value (NULL for all)
+// NOTE: Required if text is modified out of the controls, history steps positions would not match
+void GuiClearUndoHistory(const void *key)
+{
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+    for (int i = 0; i < RAYGUI_TEXT_UNDO_MAX_CONTROLS; i++)
+    {
+        if ((key == NULL) || (guiTextUndo[i].key == key))
+        {
+            guiTextUndo[i].key = NULL;
+            guiTextUndo[i].lastUsed = 0;
+            guiTextUndo[i].count = 0;
+            guiTextUndo[i].current = 0;
+            guiTextUndo[i].coalesce = false;
+        }
+    }
+#endif
 }
 
-// Tab Bar control
-// NOTE: Using GuiToggle() for the TABS
-int GuiTabBar(Rectangle bounds, const char **text, int count, int *active)
+// Format integer as text into buffer (12 bytes min), returns text length
+int GuiFormatInteger(char *buffer, int value)
 {
-    #define RAYGUI_TABBAR_ITEM_WIDTH    160
+    int length = 0;
 
-    int result = -1;
-    //GuiState state = guiState;
+    if (value < 0) buffer[length++] = '-';
+    length += GuiFormatUnsigned(buffer + length, (value < 0)? 0ull - (unsigned long long)value : (unsigned long long)value, 1);
 
-    Rectangle tabBounds = { bounds.x, bounds.y, RAYGUI_TABBAR_ITEM_WIDTH, bounds.height };
+    return length;
+}
 
-    if (*active < 0) *active = 0;
-    else if (*active > count - 1) *active = count - 1;
+// Format float with precision decimals into buffer (32 bytes min), returns text length
+// NOTE: Precision -1 gets the shortest text that reads back as the same float (scientific notation
+// for very big or small values), fixed precision is limited to 9 decimals and rounds half up
+int GuiFormatFloat(char *buffer, float value, int precision)
+{
+    static const double powers[23] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
 
-    int offsetX = 0;    // Required in case tabs go out of screen
-    offsetX = (*active + 2)*RAYGUI_TABBAR_ITEM_WIDTH - GetScreenWidth();
-    if (offsetX < 0) offsetX = 0;
+    int length = 0;
+    double v = (value < 0)? -(double)value : (double)value;
 
-    bool toggle = false;    // Required for individual toggles
+    if (value != value) { memcpy(buffer, "nan", 4); return 3; }
+    if (value < 0) buffer[length++] = '-';
+    if (v > 3.402823466e+38) { memcpy(buffer + length, "inf", 4); return length + 3; }
+    if (precision > 9) precision = 9;
 
-    // Draw control
-    //--------------------------------------------------------------------
-    for (int i = 0; i < count; i++)
+    if ((precision >= 0) && ((v*powers[precision]) < 1e18))
     {
-        tabBounds.x = bounds.x + (RAYGUI_TABBAR_ITEM_WIDTH + 4)*i - offsetX;
-
-        if (tabBounds.x < GetScreenWidth())
-        {
-            // Draw tabs as toggle controls
-            int textAlignment = GuiGetStyle(TOGGLE, TEXT_ALIGNMENT);
-            int textPadding = GuiGetStyle(TOGGLE, TEXT_PADDING);
-            GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
-            GuiSetStyle(TOGGLE, TEXT_PADDING, 8);
-
-            if (i == (*active))
-            {
-                toggle = true;
-                GuiToggle(tabBounds, GuiIconText(12, text[i]), &toggle);
-            }
-            else
-            {
-                toggle = false;
-                GuiToggle(tabBounds, GuiIconText(12, text[i]), &toggle);
-                if (toggle) *active = i;
-            }
-
-            // Close tab with middle mouse button pressed
-            if (CheckCollisionPointRec(GetMousePosition(), tabBounds) && IsMouseButtonPressed(MOUSE_MIDDLE_BUTTON)) result = i;
+        // Fixed precision: value scaled to an integer with all required decimals
+        unsigned long long scaled = (unsigned long long)(v*powers[precision] + 0.5);
+        unsigned long long scale = (unsigned long long)powers[precision];
 
-            GuiSetStyle(TOGGLE, TEXT_PADDING, textPadding);
-            GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, textAlignment);
+        length += GuiFormatUnsigned(buffer + length, scaled/scale, 1);
 
-            // Draw tab close button
-            // NOTE: Only draw close button for current tab: if (CheckCollisionPointRec(mousePosition, tabBounds))
-            int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-            int tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-            GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-            GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-#if defined(RAYGUI_NO_ICONS)
-            if (GuiButton(RAYGUI_CLITERAL(Rectangle){ tabBounds.x + tabBounds.width - 14 - 5, tabBounds.y + 5, 14, 14 }, "x")) result = i;
-#else
-            if (GuiButton(RAYGUI_CLITERAL(Rectangle){ tabBounds.x + tabBounds.width - 14 - 5, tabBounds.y + 5, 14, 14 }, GuiIconText(ICON_CROSS_SMALL, NULL))) result = i;
-#endif
-            GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
-            GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
+        if (precision > 0)
+        {
+            buffer[length++] = '.';
+            length += GuiFormatUnsigned(buffer + length, scaled%scale, precision);
         }
     }
+    else if (v == 0.0) buffer[length++] = '0';
+    else
+    {
+        // Shortest round-trip: fewest significant digits reading back as same float
+        // NOTE: Float has 9 significant digits at most, checks are done in double precision
+        int exponent = (int)floor(log10(v));
+        unsigned long long mantissa = 0;
+        int scale = 0;
 
-    // Draw tab-bar bottom line
-    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, 1 }, 0, BLANK, GetColor(GuiGetStyle(TOGGLE, BORDER_COLOR_NORMAL)));
-    //--------------------------------------------------------------------
-
-    return result;     // Return as result the current TAB closing requested
-}
-
-// Scroll Panel control
-int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector2 *scroll, Rectangle *view)
-{
-    #define RAYGUI_MIN_SCROLLBAR_WIDTH     40
-    #define RAYGUI_MIN_SCROLLBAR_HEIGHT    40
-    #define RAYGUI_MIN_MOUSE_WHEEL_SPEED   20
+        for (int digits = 1; digits <= 9; digits++)
+        {
+            scale = exponent - digits + 1;
 
-    int result = 0;
-    GuiState state = guiState;
+            int power = (scale >= 0)? scale : -scale;
+            double factor = (power <= 22)? powers[power] : pow(10.0, power);
+            double rounded = floor(((scale >= 0)? v/factor : v*factor) + 0.5);
 
-    Rectangle temp = { 0 };
-    if (view == NULL) view = &temp;
+            mantissa = (unsigned long long)rounded;
+            if ((float)((scale >= 0)? rounded*factor : rounded/factor) == (float)v) break;
+        }
 
-    Vector2 scrollPos = { 0.0f, 0.0f };
-    if (scroll != NULL) scrollPos = *scroll;
+        while ((mantissa > 0) && ((mantissa%10) == 0)) { mantissa /= 10; scale++; }
 
-    // Text will be drawn as a header bar (if provided)
-    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT };
-    if (bounds.height < RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f) bounds.height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f;
+        char digits[24] = { 0 };
+        int count = GuiFormatUnsigned(digits, mantissa, 1);
+        int point = count + scale;      // Digits before decimal point
 
-    if (text != NULL)
-    {
-        // Move panel bounds after the header bar
-        bounds.y += (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 1;
-        bounds.height -= (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT + 1;
+        if ((point > 0) && (point <= 9))
+        {
+            for (int i = 0; i < point; i++) buffer[length++] = (i < count)? digits[i] : '0';
+            if (count > point) buffer[length++] = '.';
+            for (int i = point; i < count; i++) buffer[length++] = digits[i];
+        }
+        else if ((point <= 0) && (point > -5))
+        {
+            buffer[length++] = '0';
+            buffer[length++] = '.';
+            for (int i = point; i < 0; i++) buffer[length++] = '0';
+            for (int i = 0; i < count; i++) buffer[length++] = digits[i];
+        }
+        else
+        {
+            buffer[length++] = digits[0];
+            if (count > 1) buffer[length++] = '.';
+            for (int i = 1; i < count; i++) buffer[length++] = digits[i];
+            buffer[length++] = 'e';
+            buffer[length++] = (point - 1 < 0)? '-' : '+';
+            length += GuiFormatUnsigned(buffer + length, (point - 1 < 0)? 1 - point : point - 1, 2);
+        }
     }
 
-    bool hasHorizontalScrollBar = (content.width > bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH))? true : false;
-    bool hasVerticalScrollBar = (content.height > bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH))? true : false;
-
-    // Recheck to account for the other scrollbar being visible
-    if (!hasHorizontalScrollBar) hasHorizontalScrollBar = (hasVerticalScrollBar && (content.width > (bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH))))? true : false;
-    if (!hasVerticalScrollBar) hasVerticalScrollBar = (hasHorizontalScrollBar && (content.height > (bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH))))? true : false;
+    buffer[length] = '\0';
 
-    int horizontalScrollBarWidth = hasHorizontalScrollBar? GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) : 0;
-    int verticalScrollBarWidth =  hasVerticalScrollBar? GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) : 0;
-    Rectangle horizontalScrollBar = {
-        (float)((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)bounds.x + verticalScrollBarWidth : (float)bounds.x) + GuiGetStyle(DEFAULT, BORDER_WIDTH),
-        (float)bounds.y + bounds.height - horizontalScrollBarWidth - GuiGetStyle(DEFAULT, BORDER_WIDTH),
-        (float)bounds.width - verticalScrollBarWidth - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH),
-        (float)horizontalScrollBarWidth
-    };
-    Rectangle verticalScrollBar = {
-        (float)((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH) : (float)bounds.x + bounds.width - verticalScrollBarWidth - GuiGetStyle(DEFAULT, BORDER_WIDTH)),
-        (float)bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH),
-        (float)verticalScrollBarWidth,
-        (float)bounds.height - horizontalScrollBarWidth - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH)
-    };
+    return length;
+}
 
-    // Make sure scroll bars have a minimum width/height
-    if (horizontalScrollBar.width < RAYGUI_MIN_SCROLLBAR_WIDTH) horizontalScrollBar.width = RAYGUI_MIN_SCROLLBAR_WIDTH;
-    if (verticalScrollBar.height < RAYGUI_MIN_SCROLLBAR_HEIGHT) verticalScrollBar.height = RAYGUI_MIN_SCROLLBAR_HEIGHT;
+// Convert colors array from HSV to RGB
+// NOTE: Color data should be passed normalized, hue in degrees [0..360]
+// NOTE: Hue sector is selected without branches, every channel is: v - v*s*clamp(min(k, 4 - k), 0, 1),
+// with k = (n + h/60) mod 6 and n = 5, 3, 1 for red, green and blue, 4 colors processed at once with SIMD
+void GuiConvertHSVtoRGB(const Vector3 *hsv, Vector3 *rgb, int count)
+{
+    int i = 0;
 
-    // Calculate view area (area without the scrollbars)
-    *view = (GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)?
-                RAYGUI_CLITERAL(Rectangle){ bounds.x + verticalScrollBarWidth + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth, bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth } :
-                RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth, bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth };
+#if defined(RAYGUI_SIMD_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 four = _mm_set1_ps(4.0f);
+    const __m128 six = _mm_set1_ps(6.0f);
 
-    // Clip view area to the actual content size
-    if (view->width > content.width) view->width = content.width;
-    if (view->height > content.height) view->height = content.height;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float *src = (const float *)(hsv + i);
+        __m128 h = _mm_mul_ps(_mm_setr_ps(src[0], src[3], src[6], src[9]), _mm_set1_ps(1.0f/60.0f));
+        __m128 s = _mm_setr_ps(src[1], src[4], src[7], src[10]);
+        __m128 v = _mm_setr_ps(src[2], src[5], src[8], src[11]);
+        __m128 vs = _mm_mul_ps(v, s);
+        float channels[3][4] = { 0 };
+
+        for (int c = 0; c < 3; c++)
+        {
+            __m128 k = _mm_add_ps(h, _mm_set1_ps(5.0f - 2.0f*c));
+            k = _mm_sub_ps(k, _mm_and_ps(_mm_cmpge_ps(k, six), six));
+            __m128 t = _mm_min_ps(_mm_max_ps(_mm_min_ps(k, _mm_sub_ps(four, k)), zero), one);
+            _mm_storeu_ps(channels[c], _mm_sub_ps(v, _mm_mul_ps(vs, t)));
+        }
 
-    float horizontalMin = hasHorizontalScrollBar? ((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)-verticalScrollBarWidth : 0) - (float)GuiGetStyle(DEFAULT, BORDER_WIDTH) : (((float)GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)-verticalScrollBarWidth : 0) - (float)GuiGetStyle(DEFAULT, BORDER_WIDTH);
-    float horizontalMax = hasHorizontalScrollBar? content.width - bounds.width + (float)verticalScrollBarWidth + GuiGetStyle(DEFAULT, BORDER_WIDTH) - (((float)GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)verticalScrollBarWidth : 0) : (float)-GuiGetStyle(DEFAULT, BORDER_WIDTH);
-    float verticalMin = hasVerticalScrollBar? 0.0f : -1.0f;
-    float verticalMax = hasVerticalScrollBar? content.height - bounds.height + (float)horizontalScrollBarWidth + (float)GuiGetStyle(DEFAULT, BORDER_WIDTH) : (float)-GuiGetStyle(DEFAULT, BORDER_WIDTH);
+        for (int k = 0; k < 4; k++) rgb[i + k] = RAYGUI_CLITERAL(Vector3){ channels[0][k], channels[1][k], channels[2][k] };
+    }
+#elif defined(RAYGUI_SIMD_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t four = vdupq_n_f32(4.0f);
+    const float32x4_t six = vdupq_n_f32(6.0f);
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked)
+    for (; i + 4 <= count; i += 4)
     {
-        Vector2 mousePoint = GetMousePosition();
+        float32x4x3_t src = vld3q_f32((const float *)(hsv + i));   // Deinterleaved: h, s, v
+        float32x4_t h = vmulq_n_f32(src.val[0], 1.0f/60.0f);
+        float32x4_t vs = vmulq_f32(src.val[2], src.val[1]);
+        float32x4x3_t dst = { 0 };
 
-        // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        for (int c = 0; c < 3; c++)
         {
-            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
-
-#if defined(SUPPORT_SCROLLBAR_KEY_INPUT)
-            if (hasHorizontalScrollBar)
-            {
-                if (IsKeyDown(KEY_RIGHT)) scrollPos.x -= GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-                if (IsKeyDown(KEY_LEFT)) scrollPos.x += GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-            }
+            float32x4_t k = vaddq_f32(h, vdupq_n_f32(5.0f - 2.0f*c));
+            k = vbslq_f32(vcgeq_f32(k, six), vsubq_f32(k, six), k);
+            float32x4_t t = vminq_f32(vmaxq_f32(vminq_f32(k, vsubq_f32(four, k)), zero), one);
+            dst.val[c] = vmlsq_f32(src.val[2], vs, t);
+        }
 
-            if (hasVerticalScrollBar)
-            {
-                if (IsKeyDown(KEY_DOWN)) scrollPos.y -= GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-                if (IsKeyDown(KEY_UP)) scrollPos.y += GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-            }
+        vst3q_f32((float *)(rgb + i), dst);
+    }
 #endif
-            float wheelMove = GetMouseWheelMove();
 
-            // Set scrolling speed with mouse wheel based on ratio between bounds and content
-            Vector2 mouseWheelSpeed = { content.width/bounds.width, content.height/bounds.height };
-            if (mouseWheelSpeed.x < RAYGUI_MIN_MOUSE_WHEEL_SPEED) mouseWheelSpeed.x = RAYGUI_MIN_MOUSE_WHEEL_SPEED;
-            if (mouseWheelSpeed.y < RAYGUI_MIN_MOUSE_WHEEL_SPEED) mouseWheelSpeed.y = RAYGUI_MIN_MOUSE_WHEEL_SPEED;
+    for (; i < count; i++)
+    {
+        float h = hsv[i].x*(1.0f/60.0f);
+        float vs = hsv[i].z*hsv[i].y;
+        float v = hsv[i].z;
+        float channels[3] = { 0 };
 
-            // Horizontal and vertical scrolling with mouse wheel
-            if (hasHorizontalScrollBar && (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_LEFT_SHIFT))) scrollPos.x += wheelMove*mouseWheelSpeed.x;
-            else scrollPos.y += wheelMove*mouseWheelSpeed.y; // Vertical scroll
+        for (int c = 0; c < 3; c++)
+        {
+            float k = h + (5.0f - 2.0f*c);
+            k -= (k >= 6.0f)? 6.0f : 0.0f;
+            float t = (k < 4.0f - k)? k : 4.0f - k;
+            t = (t > 0.0f)? t : 0.0f;
+            t = (t < 1.0f)? t : 1.0f;
+            channels[c] = v - vs*t;
         }
-    }
-
-    // Normalize scroll values
-    if (scrollPos.x > -horizontalMin) scrollPos.x = -horizontalMin;
-    if (scrollPos.x < -horizontalMax) scrollPos.x = -horizontalMax;
-    if (scrollPos.y > -verticalMin) scrollPos.y = -verticalMin;
-    if (scrollPos.y < -verticalMax) scrollPos.y = -verticalMax;
-    //--------------------------------------------------------------------
 
-    // Draw control
-    //--------------------------------------------------------------------
-    if (text != NULL) GuiStatusBar(statusBar, text);  // Draw panel header as status bar
+        rgb[i] = RAYGUI_CLITERAL(Vector3){ channels[0], channels[1], channels[2] };
+    }
+}
 
-    GuiDrawRectangle(bounds, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));        // Draw background
+// Convert colors array from RGB to HSV
+// NOTE: Color data should be passed normalized, hue returned in degrees [0..360)
+// NOTE: Hue sector (max channel) is selected without branches, 4 colors processed at once with SIMD
+void GuiConvertRGBtoHSV(const Vector3 *rgb, Vector3 *hsv, int count)
+{
+    int i = 0;
 
-    // Save size of the scrollbar slider
-    const int slider = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
+#if defined(RAYGUI_SIMD_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
 
-    // Draw horizontal scrollbar if visible
-    if (hasHorizontalScrollBar)
+    for (; i + 4 <= count; i += 4)
     {
-        // Change scrollbar slider size to show the diff in size between the content width and the widget width
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)/(int)content.width)*((int)bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)));
-        scrollPos.x = (float)-GuiScrollBar(horizontalScrollBar, (int)-scrollPos.x, (int)horizontalMin, (int)horizontalMax);
+        const float *src = (const float *)(rgb + i);
+        __m128 r = _mm_setr_ps(src[0], src[3], src[6], src[9]);
+        __m128 g = _mm_setr_ps(src[1], src[4], src[7], src[10]);
+        __m128 b = _mm_setr_ps(src[2], src[5], src[8], src[11]);
+
+        __m128 max = _mm_max_ps(_mm_max_ps(r, g), b);
+        __m128 delta = _mm_sub_ps(max, _mm_min_ps(_mm_min_ps(r, g), b));
+        __m128 valid = _mm_cmpge_ps(delta, _mm_set1_ps(0.00001f));
+        __m128 divisor = _mm_or_ps(_mm_and_ps(valid, delta), _mm_andnot_ps(valid, one));
+
+        // Hue candidates for every max channel, selected by masks
+        __m128 hueR = _mm_div_ps(_mm_sub_ps(g, b), divisor);
+        __m128 hueG = _mm_add_ps(_mm_set1_ps(2.0f), _mm_div_ps(_mm_sub_ps(b, r), divisor));
+        __m128 hueB = _mm_add_ps(_mm_set1_ps(4.0f), _mm_div_ps(_mm_sub_ps(r, g), divisor));
+        __m128 isR = _mm_cmpge_ps(r, max);
+        __m128 isG = _mm_cmpge_ps(g, max);
+
+        __m128 h = _mm_or_ps(_mm_and_ps(isG, hueG), _mm_andnot_ps(isG, hueB));
+        h = _mm_mul_ps(_mm_or_ps(_mm_and_ps(isR, hueR), _mm_andnot_ps(isR, h)), _mm_set1_ps(60.0f));
+        h = _mm_add_ps(h, _mm_and_ps(_mm_cmplt_ps(h, zero), _mm_set1_ps(360.0f)));
+        h = _mm_and_ps(valid, h);
+
+        __m128 s = _mm_and_ps(valid, _mm_div_ps(delta, _mm_or_ps(_mm_and_ps(valid, max), _mm_andnot_ps(valid, one))));
+
+        float channels[3][4] = { 0 };
+        _mm_storeu_ps(channels[0], h);
+        _mm_storeu_ps(channels[1], s);
+        _mm_storeu_ps(channels[2], max);
+
+        for (int k = 0; k < 4; k++) hsv[i + k] = RAYGUI_CLITERAL(Vector3){ channels[0][k], channels[1][k], channels[2][k] };
     }
-    else scrollPos.x = 0.0f;
+#elif defined(RAYGUI_SIMD_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
 
-    // Draw vertical scrollbar if visible
-    if (hasVerticalScrollBar)
+    for (; i + 4 <= count; i += 4)
     {
-        // Change scrollbar slider size to show the diff in size between the content height and the widget height
-        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)/(int)content.height)*((int)bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)));
-        scrollPos.y = (float)-GuiScrollBar(verticalScrollBar, (int)-scrollPos.y, (int)verticalMin, (int)verticalMax);
+        float32x4x3_t src = vld3q_f32((const float *)(rgb + i));   // Deinterleaved: r, g, b
+        float32x4_t r = src.val[0];
+        float32x4_t g = src.val[1];
+        float32x4_t b = src.val[2];
+
+        float32x4_t max = vmaxq_f32(vmaxq_f32(r, g), b);
+        float32x4_t delta = vsubq_f32(max, vminq_f32(vminq_f32(r, g), b));
+        uint32x4_t valid = vcgeq_f32(delta, vdupq_n_f32(0.00001f));
+        float32x4_t divisor = vbslq_f32(valid, delta, one);
+
+        // Hue candidates for every max channel, selected by masks
+        float32x4_t hueR = vdivq_f32(vsubq_f32(g, b), divisor);
+        float32x4_t hueG = vaddq_f32(vdupq_n_f32(2.0f), vdivq_f32(vsubq_f32(b, r), divisor));
+        float32x4_t hueB = vaddq_f32(vdupq_n_f32(4.0f), vdivq_f32(vsubq_f32(r, g), divisor));
+
+        float32x4_t h = vbslq_f32(vcgeq_f32(r, max), hueR, vbslq_f32(vcgeq_f32(g, max), hueG, hueB));
+        h = vmulq_n_f32(h, 60.0f);
+        h = vbslq_f32(vcltq_f32(h, zero), vaddq_f32(h, vdupq_n_f32(360.0f)), h);
+
+        float32x4x3_t dst = { 0 };
+        dst.val[0] = vbslq_f32(valid, h, zero);
+        dst.val[1] = vbslq_f32(valid, vdivq_f32(delta, vbslq_f32(valid, max, one)), zero);
+        dst.val[2] = max;
+
+        vst3q_f32((float *)(hsv + i), dst);
     }
-    else scrollPos.y = 0.0f;
+#endif
 
-    // Draw detail corner rectangle if both scroll bars are visible
-    if (hasHorizontalScrollBar && hasVerticalScrollBar)
+    for (; i < count; i++)
     {
-        Rectangle corner = { (GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH) + 2) : (horizontalScrollBar.x + horizontalScrollBar.width + 2), verticalScrollBar.y + verticalScrollBar.height + 2, (float)horizontalScrollBarWidth - 4, (float)verticalScrollBarWidth - 4 };
-        GuiDrawRectangle(corner, 0, BLANK, GetColor(GuiGetStyle(LISTVIEW, TEXT + (state*3))));
+        float r = rgb[i].x, g = rgb[i].y, b = rgb[i].z;
+
+        float max = (r > g)? r : g;
+        max = (max > b)? max : b;
+        float min = (r < g)? r : g;
+        min = (min < b)? min : b;
+        float delta = max - min;
+        bool valid = (delta >= 0.00001f);
+        float divisor = valid? delta : 1.0f;
+
+        // NOTE: If delta is 0, then r = g = b, s = 0, h is undefined (set to 0)
+        float h = (r >= max)? (g - b)/divisor : ((g >= max)? 2.0f + (b - r)/divisor : 4.0f + (r - g)/divisor);
+        h *= 60.0f;
+        h += (h < 0.0f)? 360.0f : 0.0f;
+
+        hsv[i] = RAYGUI_CLITERAL(Vector3){ valid? h : 0.0f, valid? delta/max : 0.0f, max };
     }
+}
 
-    // Draw scrollbar lines depending on current state
-    GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + (state*3))), BLANK);
-
-    // Set scrollbar slider size back to the way it was before
-    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, slider);
-    //--------------------------------------------------------------------
+// Set custom gui font
+// NOTE: Font loading/unloading is external to raygui
+void GuiSetFont(Font font)
+{
+    if (font.texture.id > 0)
+    {
+        // NOTE: If we try to setup a font but default style has not been
+        // lazily loaded before, it will be overwritten, so we need to force
+        // default style loading first
+        if (!guiStyleLoaded) GuiLoadStyleDefault();
 
-    if (scroll != NULL) *scroll = scrollPos;
+        guiFont = font;
+    }
+}
 
-    return result;
+// Get custom gui font
+Font GuiGetFont(void)
+{
+    return guiFont;
 }
 
-// Label control
-int GuiLabel(Rectangle bounds, const char *text)
+// Set control style property value
+void GuiSetStyle(int control, int property, int value)
+{
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+    guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+
+    // Default properties are propagated to all controls
+    if ((control == 0) && (property < RAYGUI_MAX_PROPS_BASE))
+    {
+        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++) guiStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+    }
+}
+
+// Get control style property value
+int GuiGetStyle(int control, int property)
+{
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+    return guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
+}
+
+//----------------------------------------------------------------------------------
+// Gui Controls Functions Definition
+//----------------------------------------------------------------------------------
+
+// Window Box control
+int GuiWindowBox(Rectangle bounds, const char *title)
 {
+    // Window title bar height (including borders)
+    // NOTE: This define is also used by GuiMessageBox() and GuiTextInputBox()
+    #if !defined(RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT)
+        #define RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT        24
+    #endif
+
     int result = 0;
-    GuiState state = guiState;
+    //GuiState state = guiState;
+
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
+
+    int statusBarHeight = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT;
+
+    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)statusBarHeight };
+    if (bounds.height < statusBarHeight*2.0f) bounds.height = statusBarHeight*2.0f;
+
+    Rectangle windowPanel = { bounds.x, bounds.y + (float)statusBarHeight - 1, bounds.width, bounds.height - (float)statusBarHeight + 1 };
+    Rectangle closeButtonRec = { statusBar.x + statusBar.width - GuiGetStyle(STATUSBAR, BORDER_WIDTH) - 20,
+                                 statusBar.y + statusBarHeight/2.0f - 18.0f/2.0f, 18, 18 };
 
     // Update control
     //--------------------------------------------------------------------
-    //...
+    // NOTE: Logic is directly managed by button
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    GuiStatusBar(statusBar, title); // Draw window header as status bar
+    GuiPanel(windowPanel, NULL);    // Draw window base
+
+    // Draw window close button
+    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
+    int tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
+    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+#if defined(RAYGUI_NO_ICONS)
+    result = GuiButton(closeButtonRec, "x");
+#else
+    result = GuiButton(closeButtonRec, GuiIconText(ICON_CROSS_SMALL, NULL));
+#endif
+    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
+    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
     //--------------------------------------------------------------------
 
-    return result;
+    return result;      // Window close button clicked: result = 1
 }
 
-// Button control, returns true when clicked
-int GuiButton(Rectangle bounds, const char *text)
+// Group Box control with text name
+int GuiGroupBox(Rectangle bounds, const char *text)
 {
+    #if !defined(RAYGUI_GROUPBOX_LINE_THICK)
+        #define RAYGUI_GROUPBOX_LINE_THICK     1
+    #endif
+
     int result = 0;
     GuiState state = guiState;
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
-    {
-        Vector2 mousePoint = GetMousePosition();
-
-        // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
-
-            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) result = 1;
-        }
-    }
-    //--------------------------------------------------------------------
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(BUTTON, BORDER_WIDTH), GetColor(GuiGetStyle(BUTTON, BORDER + (state*3))), GetColor(GuiGetStyle(BUTTON, BASE + (state*3))));
-    GuiDrawText(text, GetTextBounds(BUTTON, bounds), GuiGetStyle(BUTTON, TEXT_ALIGNMENT), GetColor(GuiGetStyle(BUTTON, TEXT + (state*3))));
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)));
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, RAYGUI_GROUPBOX_LINE_THICK }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)));
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + bounds.width - 1, bounds.y, RAYGUI_GROUPBOX_LINE_THICK, bounds.height }, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR)));
 
-    if (state == STATE_FOCUSED) GuiTooltip(bounds);
-    //------------------------------------------------------------------
+    GuiLine(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y - GuiGetStyle(DEFAULT, TEXT_SIZE)/2, bounds.width, (float)GuiGetStyle(DEFAULT, TEXT_SIZE) }, text);
+    //--------------------------------------------------------------------
 
-    return result;      // Button pressed: result = 1
+    return result;
 }
 
-// Label button control
-int GuiLabelButton(Rectangle bounds, const char *text)
+// Line control
+int GuiLine(Rectangle bounds, const char *text)
 {
+    #if !defined(RAYGUI_LINE_ORIGIN_SIZE)
+        #define RAYGUI_LINE_MARGIN_TEXT  12
+    #endif
+    #if !defined(RAYGUI_LINE_TEXT_PADDING)
+        #define RAYGUI_LINE_TEXT_PADDING  4
+    #endif
+
+    int result = 0;
     GuiState state = guiState;
-    bool pressed = false;
 
-    // NOTE: We force bounds.width to be all text
-    float textWidth = (float)GetTextWidth(text);
-    if ((bounds.width - 2*GuiGetStyle(LABEL, BORDER_WIDTH) - 2*GuiGetStyle(LABEL, TEXT_PADDING)) < textWidth) bounds.width = textWidth + 2*GuiGetStyle(LABEL, BORDER_WIDTH) + 2*GuiGetStyle(LABEL, TEXT_PADDING) + 2;
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
 
-    // Update control
+    Color color = GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : LINE_COLOR));
+
+    // Draw control
     //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    if (text == NULL) GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height/2, bounds.width, 1 }, 0, BLANK, color);
+    else
     {
-        Vector2 mousePoint = GetMousePosition();
-
-        // Check checkbox state
-        if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
-            else state = STATE_FOCUSED;
+        Rectangle textBounds = { 0 };
+        textBounds.width = (float)GetTextWidth(text) + 2;
+        textBounds.height = bounds.height;
+        textBounds.x = bounds.x + RAYGUI_LINE_MARGIN_TEXT;
+        textBounds.y = bounds.y;
 
-            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) pressed = true;
-        }
+        // Draw line with embedded text label: "--- text --------------"
+        GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height/2, RAYGUI_LINE_MARGIN_TEXT - RAYGUI_LINE_TEXT_PADDING, 1 }, 0, BLANK, color);
+        GuiDrawText(text, textBounds, TEXT_ALIGN_LEFT, color);
+        GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x + 12 + textBounds.width + 4, bounds.y + bounds.height/2, bounds.width - textBounds.width - RAYGUI_LINE_MARGIN_TEXT - RAYGUI_LINE_TEXT_PADDING, 1 }, 0, BLANK, color);
     }
     //--------------------------------------------------------------------
 
-    // Draw control
-    //--------------------------------------------------------------------
-    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
-    //--------------------------------------------------------------------
-
-    return pressed;
+    return result;
 }
 
-// Toggle Button control
-int GuiToggle(Rectangle bounds, const char *text, bool *active)
+// Panel control
+int GuiPanel(Rectangle bounds, const char *text)
 {
+    #if !defined(RAYGUI_PANEL_BORDER_WIDTH)
+        #define RAYGUI_PANEL_BORDER_WIDTH   1
+    #endif
+
     int result = 0;
     GuiState state = guiState;
 
-    bool temp = false;
-    if (active == NULL) active = &temp;
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
-    {
-        Vector2 mousePoint = GetMousePosition();
+    // Text will be drawn as a header bar (if provided)
+    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT };
+    if ((text != NULL) && (bounds.height < RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f)) bounds.height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f;
 
-        // Check toggle button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
-        {
-            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
-            else if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
-            {
-                state = STATE_NORMAL;
-                *active = !(*active);
-            }
-            else state = STATE_FOCUSED;
-        }
+    if (text != NULL)
+    {
+        // Move panel bounds after the header bar
+        bounds.y += (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 1;
+        bounds.height -= (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 1;
     }
-    //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    if (state == STATE_NORMAL)
-    {
-        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, ((*active)? BORDER_COLOR_PRESSED : (BORDER + state*3)))), GetColor(GuiGetStyle(TOGGLE, ((*active)? BASE_COLOR_PRESSED : (BASE + state*3)))));
-        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, ((*active)? TEXT_COLOR_PRESSED : (TEXT + state*3)))));
-    }
-    else
-    {
-        GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + state*3)), GetColor(GuiGetStyle(TOGGLE, BASE + state*3)));
-        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, TEXT + state*3)));
-    }
+    if (text != NULL) GuiStatusBar(statusBar, text);  // Draw panel header as status bar
 
-    if (state == STATE_FOCUSED) GuiTooltip(bounds);
+    GuiDrawRectangle(bounds, RAYGUI_PANEL_BORDER_WIDTH, GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED: LINE_COLOR)),
+                     GetColor(GuiGetStyle(DEFAULT, (state == STATE_DISABLED)? BASE_COLOR_DISABLED : BACKGROUND_COLOR)));
     //--------------------------------------------------------------------
 
     return result;
 }
 
-// Toggle Group control
-int GuiToggleGroup(Rectangle bounds, const char *text, int *active)
+#if !defined(RAYGUI_NO_TABBAR)
+// Tab Bar control
+// NOTE: Using GuiToggle() for the TABS
+int GuiTabBar(Rectangle bounds, const char **text, int count, int *active)
 {
-    #if !defined(RAYGUI_TOGGLEGROUP_MAX_ITEMS)
-        #define RAYGUI_TOGGLEGROUP_MAX_ITEMS    32
-    #endif
+    #define RAYGUI_TABBAR_ITEM_WIDTH    160
 
-    int result = 0;
-    float initBoundsX = bounds.x;
+    int result = -1;
+    //GuiState state = guiState;
 
-    int temp = 0;
-    if (active == NULL) active = &temp;
+    Rectangle tabBounds = { bounds.x, bounds.y, RAYGUI_TABBAR_ITEM_WIDTH, bounds.height };
 
-    bool toggle = false;    // Required for individual toggles
+    if (*active < 0) *active = 0;
+    else if (*active > count - 1) *active = count - 1;
 
-    // Get substrings items from text (items pointers)
-    int rows[RAYGUI_TOGGLEGROUP_MAX_ITEMS] = { 0 };
-    int itemCount = 0;
-    const char **items = GuiTextSplit(text, ';', &itemCount, rows);
+    int offsetX = 0;    // Required in case tabs go out of screen
+    offsetX = (*active + 2)*RAYGUI_TABBAR_ITEM_WIDTH - GetScreenWidth();
+    if (offsetX < 0) offsetX = 0;
 
-    int prevRow = rows[0];
+    bool toggle = false;    // Required for individual toggles
 
-    for (int i = 0; i < itemCount; i++)
+    // Draw control
+    //--------------------------------------------------------------------
+    for (int i = 0; i < count; i++)
     {
-        if (prevRow != rows[i])
-        {
-            bounds.x = initBoundsX;
-            bounds.y += (bounds.height + GuiGetStyle(TOGGLE, GROUP_PADDING));
-            prevRow = rows[i];
-        }
+        tabBounds.x = bounds.x + (RAYGUI_TABBAR_ITEM_WIDTH + 4)*i - offsetX;
 
-        if (i == (*active))
+        if (tabBounds.x < GetScreenWidth())
         {
-            toggle = true;
-            GuiToggle(bounds, items[i], &toggle);
-        }
-        else
-        {
-            toggle = false;
-            GuiToggle(bounds, items[i], &toggle);
-            if (toggle) *active = i;
-        }
+            // Draw tabs as toggle controls
+            int textAlignment = GuiGetStyle(TOGGLE, TEXT_ALIGNMENT);
+            int textPadding = GuiGetStyle(TOGGLE, TEXT_PADDING);
+            GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+            GuiSetStyle(TOGGLE, TEXT_PADDING, 8);
 
-        bounds.x += (bounds.width + GuiGetStyle(TOGGLE, GROUP_PADDING));
+            if (i == (*active))
+            {
+                toggle = true;
+                GuiToggle(tabBounds, GuiIconText(12, text[i]), &toggle);
+            }
+            else
+            {
+                toggle = false;
+                GuiToggle(tabBounds, GuiIconText(12, text[i]), &toggle);
+                if (toggle) *active = i;
+            }
+
+            // Close tab with middle mouse button pressed
+            if (CheckCollisionPointRec(GetTransformedMousePosition(), tabBounds) && IsMouseButtonPressed(MOUSE_MIDDLE_BUTTON)) result = i;
+
+            GuiSetStyle(TOGGLE, TEXT_PADDING, textPadding);
+            GuiSetStyle(TOGGLE, TEXT_ALIGNMENT, textAlignment);
+
+            // Draw tab close button
+            // NOTE: Only draw close button for current tab: if (CheckCollisionPointRec(mousePosition, tabBounds))
+            int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
+            int tempTextAlignment = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+            GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
+            GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+#if defined(RAYGUI_NO_ICONS)
+            if (GuiButton(RAYGUI_CLITERAL(Rectangle){ tabBounds.x + tabBounds.width - 14 - 5, tabBounds.y + 5, 14, 14 }, "x")) result = i;
+#else
+            if (GuiButton(RAYGUI_CLITERAL(Rectangle){ tabBounds.x + tabBounds.width - 14 - 5, tabBounds.y + 5, 14, 14 }, GuiIconText(ICON_CROSS_SMALL, NULL))) result = i;
+#endif
+            GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
+            GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlignment);
+        }
     }
 
-    return result;
+    // Draw tab-bar bottom line
+    GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ bounds.x, bounds.y + bounds.height - 1, bounds.width, 1 }, 0, BLANK, GetColor(GuiGetStyle(TOGGLE, BORDER_COLOR_NORMAL)));
+    //--------------------------------------------------------------------
+
+    return result;     // Return as result the current TAB closing requested
 }
+#endif      // !RAYGUI_NO_TABBAR
 
-// Toggle Slider control extended
-int GuiToggleSlider(Rectangle bounds, const char *text, int *active)
+// Scroll Panel control
+int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector2 *scroll, Rectangle *view)
 {
+    #define RAYGUI_MIN_SCROLLBAR_WIDTH     40
+    #define RAYGUI_MIN_SCROLLBAR_HEIGHT    40
+    #define RAYGUI_MIN_MOUSE_WHEEL_SPEED   20
+
     int result = 0;
     GuiState state = guiState;
 
-    int temp = 0;
-    if (active == NULL) active = &temp;
+    Rectangle temp = { 0 };
+    if (view == NULL) view = &temp;
 
-    //bool toggle = false;    // Required for individual toggles
+    Vector2 scrollPos = { 0.0f, 0.0f };
+    if (scroll != NULL) scrollPos = *scroll;
 
-    // Get substrings items from text (items pointers)
-    int itemCount = 0;
-    const char **items = GuiTextSplit(text, ';', &itemCount, NULL);
+    // Text will be drawn as a header bar (if provided)
+    Rectangle statusBar = { bounds.x, bounds.y, bounds.width, (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT };
+    if (bounds.height < RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f) bounds.height = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT*2.0f;
 
-    Rectangle slider = {
-        0,      // Calculated later depending on the active toggle
-        bounds.y + GuiGetStyle(SLIDER, BORDER_WIDTH) + GuiGetStyle(SLIDER, SLIDER_PADDING),
-        (bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - (itemCount + 1)*GuiGetStyle(SLIDER, SLIDER_PADDING))/itemCount,
-        bounds.height - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - 2*GuiGetStyle(SLIDER, SLIDER_PADDING) };
+    if (text != NULL)
+    {
+        // Move panel bounds after the header bar
+        bounds.y += (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT - 1;
+        bounds.height -= (float)RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT + 1;
+    }
+
+    bool hasHorizontalScrollBar = (content.width > bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH))? true : false;
+    bool hasVerticalScrollBar = (content.height > bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH))? true : false;
+
+    // Recheck to account for the other scrollbar being visible
+    if (!hasHorizontalScrollBar) hasHorizontalScrollBar = (hasVerticalScrollBar && (content.width > (bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH))))? true : false;
+    if (!hasVerticalScrollBar) hasVerticalScrollBar = (hasHorizontalScrollBar && (content.height > (bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH))))? true : false;
+
+    int horizontalScrollBarWidth = hasHorizontalScrollBar? GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) : 0;
+    int verticalScrollBarWidth =  hasVerticalScrollBar? GuiGetStyle(LISTVIEW, SCROLLBAR_WIDTH) : 0;
+    Rectangle horizontalScrollBar = {
+        (float)((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)bounds.x + verticalScrollBarWidth : (float)bounds.x) + GuiGetStyle(DEFAULT, BORDER_WIDTH),
+        (float)bounds.y + bounds.height - horizontalScrollBarWidth - GuiGetStyle(DEFAULT, BORDER_WIDTH),
+        (float)bounds.width - verticalScrollBarWidth - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH),
+        (float)horizontalScrollBarWidth
+    };
+    Rectangle verticalScrollBar = {
+        (float)((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH) : (float)bounds.x + bounds.width - verticalScrollBarWidth - GuiGetStyle(DEFAULT, BORDER_WIDTH)),
+        (float)bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH),
+        (float)verticalScrollBarWidth,
+        (float)bounds.height - horizontalScrollBarWidth - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH)
+    };
+
+    // Make sure scroll bars have a minimum width/height
+    if (horizontalScrollBar.width < RAYGUI_MIN_SCROLLBAR_WIDTH) horizontalScrollBar.width = RAYGUI_MIN_SCROLLBAR_WIDTH;
+    if (verticalScrollBar.height < RAYGUI_MIN_SCROLLBAR_HEIGHT) verticalScrollBar.height = RAYGUI_MIN_SCROLLBAR_HEIGHT;
+
+    // Calculate view area (area without the scrollbars)
+    *view = (GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)?
+                RAYGUI_CLITERAL(Rectangle){ bounds.x + verticalScrollBarWidth + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth, bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth } :
+                RAYGUI_CLITERAL(Rectangle){ bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.y + GuiGetStyle(DEFAULT, BORDER_WIDTH), bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth, bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth };
+
+    // Clip view area to the actual content size
+    if (view->width > content.width) view->width = content.width;
+    if (view->height > content.height) view->height = content.height;
+
+    float horizontalMin = hasHorizontalScrollBar? ((GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)-verticalScrollBarWidth : 0) - (float)GuiGetStyle(DEFAULT, BORDER_WIDTH) : (((float)GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)-verticalScrollBarWidth : 0) - (float)GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    float horizontalMax = hasHorizontalScrollBar? content.width - bounds.width + (float)verticalScrollBarWidth + GuiGetStyle(DEFAULT, BORDER_WIDTH) - (((float)GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (float)verticalScrollBarWidth : 0) : (float)-GuiGetStyle(DEFAULT, BORDER_WIDTH);
+    float verticalMin = hasVerticalScrollBar? 0.0f : -1.0f;
+    float verticalMax = hasVerticalScrollBar? content.height - bounds.height + (float)horizontalScrollBarWidth + (float)GuiGetStyle(DEFAULT, BORDER_WIDTH) : (float)-GuiGetStyle(DEFAULT, BORDER_WIDTH);
 
     // Update control
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
+        // Check button state
         if (CheckCollisionPointRec(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
-            else if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            else state = STATE_FOCUSED;
+
+#if defined(SUPPORT_SCROLLBAR_KEY_INPUT)
+            if (hasHorizontalScrollBar)
             {
-                state = STATE_PRESSED;
-                (*active)++;
-                result = 1;
+                if (IsKeyDown(KEY_RIGHT)) scrollPos.x -= GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+                if (IsKeyDown(KEY_LEFT)) scrollPos.x += GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
             }
-            else state = STATE_FOCUSED;
-        }
 
-        if ((*active) && (state != STATE_FOCUSED)) state = STATE_PRESSED;
+            if (hasVerticalScrollBar)
+            {
+                if (IsKeyDown(KEY_DOWN)) scrollPos.y -= GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+                if (IsKeyDown(KEY_UP)) scrollPos.y += GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+            }
+#endif
+            float wheelMove = GetMouseWheelMove();
+
+            // Set scrolling speed with mouse wheel based on ratio between bounds and content
+            Vector2 mouseWheelSpeed = { content.width/bounds.width, content.height/bounds.height };
+            if (mouseWheelSpeed.x < RAYGUI_MIN_MOUSE_WHEEL_SPEED) mouseWheelSpeed.x = RAYGUI_MIN_MOUSE_WHEEL_SPEED;
+            if (mouseWheelSpeed.y < RAYGUI_MIN_MOUSE_WHEEL_SPEED) mouseWheelSpeed.y = RAYGUI_MIN_MOUSE_WHEEL_SPEED;
+
+            // Horizontal and vertical scrolling with mouse wheel
+            if (hasHorizontalScrollBar && (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_LEFT_SHIFT))) scrollPos.x += wheelMove*mouseWheelSpeed.x;
+            else scrollPos.y += wheelMove*mouseWheelSpeed.y; // Vertical scroll
+        }
     }
 
-    if (*active >= itemCount) *active = 0;
-    slider.x = bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH) + (*active + 1)*GuiGetStyle(SLIDER, SLIDER_PADDING) + (*active)*slider.width;
+    // Normalize scroll values
+    if (scrollPos.x > -horizontalMin) scrollPos.x = -horizontalMin;
+    if (scrollPos.x < -horizontalMax) scrollPos.x = -horizontalMax;
+    if (scrollPos.y > -verticalMin) scrollPos.y = -verticalMin;
+    if (scrollPos.y < -verticalMax) scrollPos.y = -verticalMax;
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + (state*3))),
-        GetColor(GuiGetStyle(TOGGLE, BASE_COLOR_NORMAL)));
+    if (text != NULL) GuiStatusBar(statusBar, text);  // Draw panel header as status bar
 
-    // Draw internal slider
-    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
-    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_FOCUSED)));
-    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
+    GuiDrawRectangle(bounds, 0, BLANK, GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));        // Draw background
 
-    // Draw text in slider
-    if (text != NULL)
+    // Save size of the scrollbar slider
+    const int slider = GuiGetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE);
+
+    // Draw horizontal scrollbar if visible
+    if (hasHorizontalScrollBar)
     {
-        Rectangle textBounds = { 0 };
-        textBounds.width = (float)GetTextWidth(text);
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = slider.x + slider.width/2 - textBounds.width/2;
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        // Change scrollbar slider size to show the diff in size between the content width and the widget width
+        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)/(int)content.width)*((int)bounds.width - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - verticalScrollBarWidth)));
+        scrollPos.x = (float)-GuiScrollBar(horizontalScrollBar, (int)-scrollPos.x, (int)horizontalMin, (int)horizontalMax);
+    }
+    else scrollPos.x = 0.0f;
 
-        GuiDrawText(items[*active], textBounds, GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(TOGGLE, TEXT + (state*3))), guiAlpha));
+    // Draw vertical scrollbar if visible
+    if (hasVerticalScrollBar)
+    {
+        // Change scrollbar slider size to show the diff in size between the content height and the widget height
+        GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, (int)(((bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)/(int)content.height)*((int)bounds.height - 2*GuiGetStyle(DEFAULT, BORDER_WIDTH) - horizontalScrollBarWidth)));
+        scrollPos.y = (float)-GuiScrollBar(verticalScrollBar, (int)-scrollPos.y, (int)verticalMin, (int)verticalMax);
     }
+    else scrollPos.y = 0.0f;
+
+    // Draw detail corner rectangle if both scroll bars are visible
+    if (hasHorizontalScrollBar && hasVerticalScrollBar)
+    {
+        Rectangle corner = { (GuiGetStyle(LISTVIEW, SCROLLBAR_SIDE) == SCROLLBAR_LEFT_SIDE)? (bounds.x + GuiGetStyle(DEFAULT, BORDER_WIDTH) + 2) : (horizontalScrollBar.x + horizontalScrollBar.width + 2), verticalScrollBar.y + verticalScrollBar.height + 2, (float)horizontalScrollBarWidth - 4, (float)verticalScrollBarWidth - 4 };
+        GuiDrawRectangle(corner, 0, BLANK, GetColor(GuiGetStyle(LISTVIEW, TEXT + (state*3))));
+    }
+
+    // Draw scrollbar lines depending on current state
+    GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + (state*3))), BLANK);
+
+    // Set scrollbar slider size back to the way it was before
+    GuiSetStyle(SCROLLBAR, SCROLL_SLIDER_SIZE, slider);
     //--------------------------------------------------------------------
 
+    if (scroll != NULL) *scroll = scrollPos;
+
     return result;
 }
 
-// Check Box control, returns 1 when state changed
-int GuiCheckBox(Rectangle bounds, const char *text, bool *checked)
+// Label control
+int GuiLabel(Rectangle bounds, const char *text)
 {
     int result = 0;
     GuiState state = guiState;
 
-    bool temp = false;
-    if (checked == NULL) checked = &temp;
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
 
-    Rectangle textBounds = { 0 };
+    // Update control
+    //--------------------------------------------------------------------
+    //...
+    //--------------------------------------------------------------------
 
-    if (text != NULL)
-    {
-        textBounds.width = (float)GetTextWidth(text) + 2;
-        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
-        textBounds.x = bounds.x + bounds.width + GuiGetStyle(CHECKBOX, TEXT_PADDING);
-        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
-        if (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(CHECKBOX, TEXT_PADDING);
-    }
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    //--------------------------------------------------------------------
+
+    return result;
+}
+
+// Button control, returns true when clicked
+int GuiButton(Rectangle bounds, const char *text)
+{
+    int result = 0;
+    GuiState state = guiState;
+
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
 
     // Update control
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        Vector2 mousePoint = GetMousePosition();
-
-        Rectangle totalBounds = {
-            (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT)? textBounds.x : bounds.x,
-            bounds.y,
-            bounds.width + textBounds.width + GuiGetStyle(CHECKBOX, TEXT_PADDING),
-            bounds.height,
-        };
+        Vector2 mousePoint = GetTransformedMousePosition();
 
-        // Check checkbox state
-        if (CheckCollisionPointRec(mousePoint, totalBounds))
+        // Check button state
+        if (CheckCollisionPointRec(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
 
-            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
-            {
-                *checked = !(*checked);
-                result = 1;
-            }
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) result = 1;
         }
     }
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(CHECKBOX, BORDER_WIDTH), GetColor(GuiGetStyle(CHECKBOX, BORDER + (state*3))), BLANK);
+    if (!GuiDrawSkin(BUTTON, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(BUTTON, BORDER_WIDTH), GetColor(GuiGetStyle(BUTTON, BORDER + (state*3))), GetColor(GuiGetStyle(BUTTON, BASE + (state*3))));
+    GuiDrawText(text, GetTextBounds(BUTTON, bounds), GuiGetStyle(BUTTON, TEXT_ALIGNMENT), GetColor(GuiGetStyle(BUTTON, TEXT + (state*3))));
 
-    if (*checked)
+    if (state == STATE_FOCUSED) GuiTooltip(bounds);
+    //------------------------------------------------------------------
+
+    return result;      // Button pressed: result = 1
+}
+
+// Label button control
+int GuiLabelButton(Rectangle bounds, const char *text)
+{
+    GuiState state = guiState;
+    bool pressed = false;
+
+    // NOTE: We force bounds.width to be all text
+    float textWidth = (float)GetTextWidth(text);
+    if ((bounds.width - 2*GuiGetStyle(LABEL, BORDER_WIDTH) - 2*GuiGetStyle(LABEL, TEXT_PADDING)) < textWidth) bounds.width = textWidth + 2*GuiGetStyle(LABEL, BORDER_WIDTH) + 2*GuiGetStyle(LABEL, TEXT_PADDING) + 2;
+
+    if (GuiIsCulled(bounds)) return pressed;        // Out of transformed viewport
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        Rectangle check = { bounds.x + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
-                            bounds.y + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
-                            bounds.width - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)),
-                            bounds.height - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)) };
-        GuiDrawRectangle(check, 0, BLANK, GetColor(GuiGetStyle(CHECKBOX, TEXT + state*3)));
+        Vector2 mousePoint = GetTransformedMousePosition();
+
+        // Check checkbox state
+        if (CheckCollisionPointRec(mousePoint, bounds))
+        {
+            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
+            else state = STATE_FOCUSED;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) pressed = true;
+        }
     }
+    //--------------------------------------------------------------------
 
-    GuiDrawText(text, textBounds, (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    // Draw control
+    //--------------------------------------------------------------------
+    GuiDrawText(text, GetTextBounds(LABEL, bounds), GuiGetStyle(LABEL, TEXT_ALIGNMENT), GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
     //--------------------------------------------------------------------
 
-    return result;
+    return pressed;
 }
 
-// Combo Box control
-int GuiComboBox(Rectangle bounds, const char *text, int *active)
+// Toggle Button control
+int GuiToggle(Rectangle bounds, const char *text, bool *active)
 {
     int result = 0;
     GuiState state = guiState;
 
-    int temp = 0;
-    if (active == NULL) active = &temp;
-
-    bounds.width -= (GuiGetStyle(COMBOBOX, COMBO_BUTTON_WIDTH) + GuiGetStyle(COMBOBOX, COMBO_BUTTON_SPACING));
-
-    Rectangle selector = { (float)bounds.x + bounds.width + GuiGetStyle(COMBOBOX, COMBO_BUTTON_SPACING),
-                           (float)bounds.y, (float)GuiGetStyle(COMBOBOX, COMBO_BUTTON_WIDTH), (float)bounds.height };
-
-    // Get substrings items from text (items pointers, lengths and count)
-    int itemCount = 0;
-    const char **items = GuiTextSplit(text, ';', &itemCount, NULL);
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
 
-    if (*active < 0) *active = 0;
-    else if (*active > (itemCount - 1)) *active = itemCount - 1;
+    bool temp = false;
+    if (active == NULL) active = &temp;
 
     // Update control
     //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && !guiLocked && (itemCount > 1) && !guiControlExclusiveMode)
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds) ||
-            CheckCollisionPointRec(mousePoint, selector))
+        // Check toggle button state
+        if (CheckCollisionPointRec(mousePoint, bounds))
         {
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
+            else if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
             {
-                *active += 1;
-                if (*active >= itemCount) *active = 0;      // Cyclic combobox
+                state = STATE_NORMAL;
+                *active = !(*active);
             }
-
-            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
         }
     }
@@ -2318,133 +3203,396 @@ int GuiComboBox(Rectangle bounds, const char *text, int *active)
 
     // Draw control
     //--------------------------------------------------------------------
-    // Draw combo box main
-    GuiDrawRectangle(bounds, GuiGetStyle(COMBOBOX, BORDER_WIDTH), GetColor(GuiGetStyle(COMBOBOX, BORDER + (state*3))), GetColor(GuiGetStyle(COMBOBOX, BASE + (state*3))));
-    GuiDrawText(items[*active], GetTextBounds(COMBOBOX, bounds), GuiGetStyle(COMBOBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(COMBOBOX, TEXT + (state*3))));
-
-    // Draw selector using a custom button
-    // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
-    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
-    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-
-    GuiButton(selector, TextFormat("%i/%i", *active + 1, itemCount));
+    if (state == STATE_NORMAL)
+    {
+        if (!GuiDrawSkin(TOGGLE, (*active)? STATE_PRESSED : state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, ((*active)? BORDER_COLOR_PRESSED : (BORDER + state*3)))), GetColor(GuiGetStyle(TOGGLE, ((*active)? BASE_COLOR_PRESSED : (BASE + state*3)))));
+        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, ((*active)? TEXT_COLOR_PRESSED : (TEXT + state*3)))));
+    }
+    else
+    {
+        if (!GuiDrawSkin(TOGGLE, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(TOGGLE, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + state*3)), GetColor(GuiGetStyle(TOGGLE, BASE + state*3)));
+        GuiDrawText(text, GetTextBounds(TOGGLE, bounds), GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), GetColor(GuiGetStyle(TOGGLE, TEXT + state*3)));
+    }
 
-    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
-    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
+    if (state == STATE_FOCUSED) GuiTooltip(bounds);
     //--------------------------------------------------------------------
 
     return result;
 }
 
-// Dropdown Box control
-// NOTE: Returns mouse click
-int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMode)
+// Toggle Group control
+int GuiToggleGroup(Rectangle bounds, const char *text, int *active)
 {
+    #if !defined(RAYGUI_TOGGLEGROUP_MAX_ITEMS)
+        #define RAYGUI_TOGGLEGROUP_MAX_ITEMS    32
+    #endif
+
     int result = 0;
-    GuiState state = guiState;
+    float initBoundsX = bounds.x;
 
     int temp = 0;
     if (active == NULL) active = &temp;
 
-    int itemSelected = *active;
-    int itemFocused = -1;
-
-    int direction = 0; // Dropdown box open direction: down (default)
-    if (GuiGetStyle(DROPDOWNBOX, DROPDOWN_ROLL_UP) == 1) direction = 1; // Up
+    bool toggle = false;    // Required for individual toggles
 
-    // Get substrings items from text (items pointers, lengths and count)
+    // Get substrings items from text (items pointers)
+    int rows[RAYGUI_TOGGLEGROUP_MAX_ITEMS] = { 0 };
     int itemCount = 0;
-    const char **items = GuiTextSplit(text, ';', &itemCount, NULL);
-
-    Rectangle boundsOpen = bounds;
-    boundsOpen.height = (itemCount + 1)*(bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
-    if (direction == 1) boundsOpen.y -= itemCount*(bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING)) + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING);
+    const char **items = GuiTextSplit(text, ';', &itemCount, rows);
 
-    Rectangle itemBounds = bounds;
+    int prevRow = rows[0];
 
-    // Update control
-    //--------------------------------------------------------------------
-    if ((state != STATE_DISABLED) && (editMode || !guiLocked) && (itemCount > 1) && !guiControlExclusiveMode)
+    for (int i = 0; i < itemCount; i++)
     {
-        Vector2 mousePoint = GetMousePosition();
+        if (prevRow != rows[i])
+        {
+            bounds.x = initBoundsX;
+            bounds.y += (bounds.height + GuiGetStyle(TOGGLE, GROUP_PADDING));
+            prevRow = rows[i];
+        }
 
-        if (editMode)
+        if (i == (*active))
         {
-            state = STATE_PRESSED;
+            toggle = true;
+            GuiToggle(bounds, items[i], &toggle);
+        }
+        else
+        {
+            toggle = false;
+            GuiToggle(bounds, items[i], &toggle);
+            if (toggle) *active = i;
+        }
 
-            // Check if mouse has been pressed or released outside limits
-            if (!CheckCollisionPointRec(mousePoint, boundsOpen))
-            {
-                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) || IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) result = 1;
-            }
+        bounds.x += (bounds.width + GuiGetStyle(TOGGLE, GROUP_PADDING));
+    }
 
-            // Check if already selected item has been pressed again
-            if (CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) result = 1;
+    return result;
+}
 
-            // Check focused and selected item
-            for (int i = 0; i < itemCount; i++)
-            {
-                // Update item rectangle y position for next item
-                if (direction == 0) itemBounds.y += (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
-                else itemBounds.y -= (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
+// Toggle Slider control extended
+int GuiToggleSlider(Rectangle bounds, const char *text, int *active)
+{
+    int result = 0;
+    GuiState state = guiState;
 
-                if (CheckCollisionPointRec(mousePoint, itemBounds))
-                {
-                    itemFocused = i;
-                    if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
-                    {
-                        itemSelected = i;
-                        result = 1;         // Item selected
-                    }
-                    break;
-                }
-            }
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
 
-            itemBounds = bounds;
-        }
-        else
+    int temp = 0;
+    if (active == NULL) active = &temp;
+
+    //bool toggle = false;    // Required for individual toggles
+
+    // Get substrings items from text (items pointers)
+    int itemCount = 0;
+    const char **items = GuiTextSplit(text, ';', &itemCount, NULL);
+
+    Rectangle slider = {
+        0,      // Calculated later depending on the active toggle
+        bounds.y + GuiGetStyle(SLIDER, BORDER_WIDTH) + GuiGetStyle(SLIDER, SLIDER_PADDING),
+        (bounds.width - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - (itemCount + 1)*GuiGetStyle(SLIDER, SLIDER_PADDING))/itemCount,
+        bounds.height - 2*GuiGetStyle(SLIDER, BORDER_WIDTH) - 2*GuiGetStyle(SLIDER, SLIDER_PADDING) };
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked)
+    {
+        Vector2 mousePoint = GetTransformedMousePosition();
+
+        if (CheckCollisionPointRec(mousePoint, bounds))
         {
-            if (CheckCollisionPointRec(mousePoint, bounds))
+            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
+            else if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
             {
-                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
-                {
-                    result = 1;
-                    state = STATE_PRESSED;
-                }
-                else state = STATE_FOCUSED;
+                state = STATE_PRESSED;
+                (*active)++;
+                result = 1;
             }
+            else state = STATE_FOCUSED;
         }
+
+        if ((*active) && (state != STATE_FOCUSED)) state = STATE_PRESSED;
     }
+
+    if (*active >= itemCount) *active = 0;
+    slider.x = bounds.x + GuiGetStyle(SLIDER, BORDER_WIDTH) + (*active + 1)*GuiGetStyle(SLIDER, SLIDER_PADDING) + (*active)*slider.width;
     //--------------------------------------------------------------------
 
     // Draw control
     //--------------------------------------------------------------------
-    if (editMode) GuiPanel(boundsOpen, NULL);
+    if (!GuiDrawSkin(TOGGLE, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(TOGGLE, BORDER + (state*3))),
+        GetColor(GuiGetStyle(TOGGLE, BASE_COLOR_NORMAL)));
 
-    GuiDrawRectangle(bounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER + state*3)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE + state*3)));
-    GuiDrawText(items[itemSelected], GetTextBounds(DROPDOWNBOX, bounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + state*3)));
+    // Draw internal slider
+    if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
+    else if (state == STATE_FOCUSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_FOCUSED)));
+    else if (state == STATE_PRESSED) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
 
-    if (editMode)
+    // Draw text in slider
+    if (text != NULL)
     {
-        // Draw visible items
-        for (int i = 0; i < itemCount; i++)
-        {
-            // Update item rectangle y position for next item
-            if (direction == 0) itemBounds.y += (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
-            else itemBounds.y -= (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
+        Rectangle textBounds = { 0 };
+        textBounds.width = (float)GetTextWidth(text);
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = slider.x + slider.width/2 - textBounds.width/2;
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
 
-            if (i == itemSelected)
-            {
-                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_PRESSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_PRESSED)));
-                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_PRESSED)));
-            }
-            else if (i == itemFocused)
-            {
-                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_FOCUSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_FOCUSED)));
-                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_FOCUSED)));
-            }
+        GuiDrawText(items[*active], textBounds, GuiGetStyle(TOGGLE, TEXT_ALIGNMENT), Fade(GetColor(GuiGetStyle(TOGGLE, TEXT + (state*3))), guiAlpha));
+    }
+    //--------------------------------------------------------------------
+
+    return result;
+}
+
+// Check Box control, returns 1 when state changed
+int GuiCheckBox(Rectangle bounds, const char *text, bool *checked)
+{
+    int result = 0;
+    GuiState state = guiState;
+
+    bool temp = false;
+    if (checked == NULL) checked = &temp;
+
+    Rectangle textBounds = { 0 };
+
+    if (text != NULL)
+    {
+        textBounds.width = (float)GetTextWidth(text) + 2;
+        textBounds.height = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBounds.x = bounds.x + bounds.width + GuiGetStyle(CHECKBOX, TEXT_PADDING);
+        textBounds.y = bounds.y + bounds.height/2 - GuiGetStyle(DEFAULT, TEXT_SIZE)/2;
+        if (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT) textBounds.x = bounds.x - textBounds.width - GuiGetStyle(CHECKBOX, TEXT_PADDING);
+    }
+
+    // NOTE: Culling considers text out of check box bounds
+    if (GuiIsCulled(bounds) && ((text == NULL) || GuiIsCulled(textBounds))) return result;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    {
+        Vector2 mousePoint = GetTransformedMousePosition();
+
+        Rectangle totalBounds = {
+            (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_LEFT)? textBounds.x : bounds.x,
+            bounds.y,
+            bounds.width + textBounds.width + GuiGetStyle(CHECKBOX, TEXT_PADDING),
+            bounds.height,
+        };
+
+        // Check checkbox state
+        if (CheckCollisionPointRec(mousePoint, totalBounds))
+        {
+            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
+            else state = STATE_FOCUSED;
+
+            if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+            {
+                *checked = !(*checked);
+                result = 1;
+            }
+        }
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (!GuiDrawSkin(CHECKBOX, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(CHECKBOX, BORDER_WIDTH), GetColor(GuiGetStyle(CHECKBOX, BORDER + (state*3))), BLANK);
+
+    if (*checked)
+    {
+        Rectangle check = { bounds.x + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
+                            bounds.y + GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING),
+                            bounds.width - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)),
+                            bounds.height - 2*(GuiGetStyle(CHECKBOX, BORDER_WIDTH) + GuiGetStyle(CHECKBOX, CHECK_PADDING)) };
+        GuiDrawRectangle(check, 0, BLANK, GetColor(GuiGetStyle(CHECKBOX, TEXT + state*3)));
+    }
+
+    GuiDrawText(text, textBounds, (GuiGetStyle(CHECKBOX, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT)? TEXT_ALIGN_LEFT : TEXT_ALIGN_RIGHT, GetColor(GuiGetStyle(LABEL, TEXT + (state*3))));
+    //--------------------------------------------------------------------
+
+    return result;
+}
+
+// Combo Box control
+int GuiComboBox(Rectangle bounds, const char *text, int *active)
+{
+    int result = 0;
+    GuiState state = guiState;
+
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
+
+    int temp = 0;
+    if (active == NULL) active = &temp;
+
+    bounds.width -= (GuiGetStyle(COMBOBOX, COMBO_BUTTON_WIDTH) + GuiGetStyle(COMBOBOX, COMBO_BUTTON_SPACING));
+
+    Rectangle selector = { (float)bounds.x + bounds.width + GuiGetStyle(COMBOBOX, COMBO_BUTTON_SPACING),
+                           (float)bounds.y, (float)GuiGetStyle(COMBOBOX, COMBO_BUTTON_WIDTH), (float)bounds.height };
+
+    // Get substrings items from text (items pointers, lengths and count)
+    int itemCount = 0;
+    const char **items = GuiTextSplit(text, ';', &itemCount, NULL);
+
+    if (*active < 0) *active = 0;
+    else if (*active > (itemCount - 1)) *active = itemCount - 1;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && (itemCount > 1) && !guiControlExclusiveMode)
+    {
+        Vector2 mousePoint = GetTransformedMousePosition();
+
+        if (CheckCollisionPointRec(mousePoint, bounds) ||
+            CheckCollisionPointRec(mousePoint, selector))
+        {
+            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+            {
+                *active += 1;
+                if (*active >= itemCount) *active = 0;      // Cyclic combobox
+            }
+
+            if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
+            else state = STATE_FOCUSED;
+        }
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    // Draw combo box main
+    if (!GuiDrawSkin(COMBOBOX, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(COMBOBOX, BORDER_WIDTH), GetColor(GuiGetStyle(COMBOBOX, BORDER + (state*3))), GetColor(GuiGetStyle(COMBOBOX, BASE + (state*3))));
+    GuiDrawText(items[*active], GetTextBounds(COMBOBOX, bounds), GuiGetStyle(COMBOBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(COMBOBOX, TEXT + (state*3))));
+
+    // Draw selector using a custom button
+    // NOTE: BORDER_WIDTH and TEXT_ALIGNMENT forced values
+    int tempBorderWidth = GuiGetStyle(BUTTON, BORDER_WIDTH);
+    int tempTextAlign = GuiGetStyle(BUTTON, TEXT_ALIGNMENT);
+    GuiSetStyle(BUTTON, BORDER_WIDTH, 1);
+    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+
+    char selectorText[32] = { 0 };
+    int selectorLength = GuiFormatInteger(selectorText, *active + 1);
+    selectorText[selectorLength++] = '/';
+    GuiFormatInteger(selectorText + selectorLength, itemCount);
+
+    GuiButton(selector, selectorText);
+
+    GuiSetStyle(BUTTON, TEXT_ALIGNMENT, tempTextAlign);
+    GuiSetStyle(BUTTON, BORDER_WIDTH, tempBorderWidth);
+    //--------------------------------------------------------------------
+
+    return result;
+}
+
+// Dropdown Box control
+// NOTE: Returns mouse click
+int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMode)
+{
+    int result = 0;
+    GuiState state = guiState;
+
+    GuiCachedRegionEdit(editMode);
+
+    int temp = 0;
+    if (active == NULL) active = &temp;
+
+    int itemSelected = *active;
+    int itemFocused = -1;
+
+    int direction = 0; // Dropdown box open direction: down (default)
+    if (GuiGetStyle(DROPDOWNBOX, DROPDOWN_ROLL_UP) == 1) direction = 1; // Up
+
+    // Get substrings items from text (items pointers, lengths and count)
+    int itemCount = 0;
+    const char **items = GuiTextSplit(text, ';', &itemCount, NULL);
+
+    Rectangle boundsOpen = bounds;
+    boundsOpen.height = (itemCount + 1)*(bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
+    if (direction == 1) boundsOpen.y -= itemCount*(bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING)) + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING);
+
+    Rectangle itemBounds = bounds;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && (editMode || !guiLocked) && (itemCount > 1) && !guiControlExclusiveMode)
+    {
+        Vector2 mousePoint = GetTransformedMousePosition();
+
+        if (editMode)
+        {
+            state = STATE_PRESSED;
+
+            // Check if mouse has been pressed or released outside limits
+            if (!CheckCollisionPointRec(mousePoint, boundsOpen))
+            {
+                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) || IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) result = 1;
+            }
+
+            // Check if already selected item has been pressed again
+            if (CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) result = 1;
+
+            // Check focused and selected item
+            for (int i = 0; i < itemCount; i++)
+            {
+                // Update item rectangle y position for next item
+                if (direction == 0) itemBounds.y += (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
+                else itemBounds.y -= (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
+
+                if (CheckCollisionPointRec(mousePoint, itemBounds))
+                {
+                    itemFocused = i;
+                    if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
+                    {
+                        itemSelected = i;
+                        result = 1;         // Item selected
+                    }
+                    break;
+                }
+            }
+
+            itemBounds = bounds;
+        }
+        else
+        {
+            if (CheckCollisionPointRec(mousePoint, bounds))
+            {
+                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+                {
+                    result = 1;
+                    state = STATE_PRESSED;
+                }
+                else state = STATE_FOCUSED;
+            }
+        }
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    if (editMode) GuiPanel(boundsOpen, NULL);
+
+    if (!GuiDrawSkin(DROPDOWNBOX, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER + state*3)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE + state*3)));
+    GuiDrawText(items[itemSelected], GetTextBounds(DROPDOWNBOX, bounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT + state*3)));
+
+    if (editMode)
+    {
+        // Draw visible items
+        for (int i = 0; i < itemCount; i++)
+        {
+            // Update item rectangle y position for next item
+            if (direction == 0) itemBounds.y += (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
+            else itemBounds.y -= (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
+
+            if (i == itemSelected)
+            {
+                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_PRESSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_PRESSED)));
+                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_PRESSED)));
+            }
+            else if (i == itemFocused)
+            {
+                GuiDrawRectangle(itemBounds, GuiGetStyle(DROPDOWNBOX, BORDER_WIDTH), GetColor(GuiGetStyle(DROPDOWNBOX, BORDER_COLOR_FOCUSED)), GetColor(GuiGetStyle(DROPDOWNBOX, BASE_COLOR_FOCUSED)));
+                GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_FOCUSED)));
+            }
             else GuiDrawText(items[i], GetTextBounds(DROPDOWNBOX, itemBounds), GuiGetStyle(DROPDOWNBOX, TEXT_ALIGNMENT), GetColor(GuiGetStyle(DROPDOWNBOX, TEXT_COLOR_NORMAL)));
         }
     }
@@ -2468,6 +3616,7 @@ int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMod
     return result;   // Mouse click: result = 1
 }
 
+#if !defined(RAYGUI_NO_TEXTBOX)
 // Text Box control
 // NOTE: Returns true on ENTER pressed (useful for data validation)
 int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
@@ -2482,6 +3631,10 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
     int result = 0;
     GuiState state = guiState;
 
+    GuiCachedRegionEdit(editMode);
+
+    if (!editMode && GuiIsCulled(bounds)) return result;    // Out of transformed viewport, edited text box is never culled
+
     bool multiline = false;     // TODO: Consider multiline text input
     int wrapMode = GuiGetStyle(DEFAULT, TEXT_WRAP_MODE);
 
@@ -2532,7 +3685,7 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
         !guiControlExclusiveMode &&                       // No gui slider on dragging
         (wrapMode == TEXT_WRAP_NONE))               // No wrap mode
     {
-        Vector2 mousePosition = GetMousePosition();
+        Vector2 mousePosition = GetTransformedMousePosition();
 
         if (editMode)
         {
@@ -2540,43 +3693,79 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
 
             if (textBoxCursorIndex > textLength) textBoxCursorIndex = textLength;
 
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+            // Undo/redo text edits
+            if (GuiTextUndoUpdate(text, text, textSize, &textBoxCursorIndex)) textLength = (int)strlen(text);
+#endif
+
             // If text does not fit in the textbox and current cursor position is out of bounds,
             // we add an index offset to text for drawing only what requires depending on cursor
-            while (textWidth >= textBounds.width)
+            // NOTE: Offset is found walking back from cursor, cost depends on visible text only
+            if (textWidth >= textBounds.width)
             {
-                int nextCodepointSize = 0;
-                GetCodepointNext(text + textIndexOffset, &nextCodepointSize);
+                float widthToCursor = 0.0f;
+                textIndexOffset = textBoxCursorIndex;
+
+                while (textIndexOffset > 0)
+                {
+                    int prevCodepointSize = 0;
+                    int prevCodepoint = GetCodepointPrevious(text + textIndexOffset, &prevCodepointSize);
+                    float glyphWidth = GetGlyphWidth(prevCodepoint) + (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
 
-                textIndexOffset += nextCodepointSize;
+                    if ((widthToCursor + glyphWidth) >= textBounds.width) break;
 
-                textWidth = GetTextWidth(text + textIndexOffset) - GetTextWidth(text + textBoxCursorIndex);
-            }
+                    widthToCursor += glyphWidth;
+                    textIndexOffset -= prevCodepointSize;
+                }
 
-            int codepoint = GetCharPressed();       // Get Unicode codepoint
-            if (multiline && IsKeyPressed(KEY_ENTER)) codepoint = (int)'\n';
+                textWidth = (int)widthToCursor;
+            }
 
-            // Encode codepoint as UTF-8
-            int codepointSize = 0;
-            const char *charEncoded = CodepointToUTF8(codepoint, &codepointSize);
+            // Get all codepoints queued this frame (i.e. fast typing or IME commit), encoded as UTF-8
+            char input[256] = { 0 };
+            int inputLength = 0;
 
-            // Add codepoint to text, at current cursor position
-            // NOTE: Make sure we do not overflow buffer size
-            if (((multiline && (codepoint == (int)'\n')) || (codepoint >= 32)) && ((textLength + codepointSize) < textSize))
+            for (int codepoint = GetCharPressed(); codepoint > 0; codepoint = GetCharPressed())
             {
-                // Move forward data from cursor position
-                for (int i = (textLength + codepointSize); i > textBoxCursorIndex; i--) text[i] = text[i - codepointSize];
+                int codepointSize = 0;
+                const char *charEncoded = CodepointToUTF8(codepoint, &codepointSize);
 
-                // Add new codepoint in current cursor position
-                for (int i = 0; i < codepointSize; i++) text[textBoxCursorIndex + i] = charEncoded[i];
+                if ((inputLength + codepointSize) <= (int)sizeof(input)) { memcpy(input + inputLength, charEncoded, codepointSize); inputLength += codepointSize; }
+            }
 
-                textBoxCursorIndex += codepointSize;
-                textLength += codepointSize;
+            if (multiline && IsKeyPressed(KEY_ENTER) && (inputLength < (int)sizeof(input))) input[inputLength++] = '\n';
 
-                // Make sure text last character is EOL
-                text[textLength] = '\0';
+            // Add input text at current cursor position, in a single insertion
+            // NOTE: Text is validated and truncated to buffer size
+            if (inputLength > 0)
+            {
+                int insertedLength = GuiTextInsert(text, textSize, textLength, textBoxCursorIndex, input, inputLength, multiline);
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                if (insertedLength > 0) GuiTextUndoRecord(text, textBoxCursorIndex, NULL, 0, text + textBoxCursorIndex, insertedLength);
+#endif
+                textBoxCursorIndex += insertedLength;
+                textLength += insertedLength;
             }
 
-            // Move cursor to start
+            // Paste clipboard text (CTRL+V) at current cursor position, as a single undo step
+            if ((IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL)) && IsKeyPressed(KEY_V))
+            {
+                const char *clipboard = GetClipboardText();
+
+                if (clipboard != NULL)
+                {
+                    int insertedLength = GuiTextInsert(text, textSize, textLength, textBoxCursorIndex, clipboard, (int)strlen(clipboard), multiline);
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                    GuiTextUndoBreak(text);
+                    if (insertedLength > 0) GuiTextUndoRecord(text, textBoxCursorIndex, NULL, 0, text + textBoxCursorIndex, insertedLength);
+                    GuiTextUndoBreak(text);
+#endif
+                    textBoxCursorIndex += insertedLength;
+                    textLength += insertedLength;
+                }
+            }
+
+            // Move cursor to start
             if ((textLength > 0) && IsKeyPressed(KEY_HOME)) textBoxCursorIndex = 0;
 
             // Move cursor to end
@@ -2592,10 +3781,13 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
                     int nextCodepointSize = 0;
                     GetCodepointNext(text + textBoxCursorIndex, &nextCodepointSize);
 
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                    GuiTextUndoRecord(text, textBoxCursorIndex, text + textBoxCursorIndex, nextCodepointSize, NULL, 0);
+#endif
                     // Move backward text from cursor position
                     for (int i = textBoxCursorIndex; i < textLength; i++) text[i] = text[i + nextCodepointSize];
 
-                    textLength -= codepointSize;
+                    textLength -= nextCodepointSize;
                     if (textBoxCursorIndex > textLength) textBoxCursorIndex = textLength;
 
                     // Make sure text last character is EOL
@@ -2604,7 +3796,7 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
             }
 
             // Delete codepoint from text, before current cursor position
-            if ((textLength > 0) && (IsKeyPressed(KEY_BACKSPACE) || (IsKeyDown(KEY_BACKSPACE) && (autoCursorCooldownCounter >= RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN))))
+            if ((textLength > 0) && (textBoxCursorIndex > 0) && (IsKeyPressed(KEY_BACKSPACE) || (IsKeyDown(KEY_BACKSPACE) && (autoCursorCooldownCounter >= RAYGUI_TEXTBOX_AUTO_CURSOR_COOLDOWN))))
             {
                 autoCursorDelayCounter++;
 
@@ -2613,17 +3805,15 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
                     int prevCodepointSize = 0;
                     GetCodepointPrevious(text + textBoxCursorIndex, &prevCodepointSize);
 
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                    GuiTextUndoRecord(text, textBoxCursorIndex - prevCodepointSize, text + textBoxCursorIndex - prevCodepointSize, prevCodepointSize, NULL, 0);
+#endif
                     // Move backward text from cursor position
                     for (int i = (textBoxCursorIndex - prevCodepointSize); i < textLength; i++) text[i] = text[i + prevCodepointSize];
 
-                    // TODO Check: >= cursor+codepointsize and <= length-codepointsize
-
-                    // Prevent cursor index from decrementing past 0
-                    if (textBoxCursorIndex > 0)
-                    {
-                        textBoxCursorIndex -= codepointSize;
-                        textLength -= codepointSize;
-                    }
+                    // NOTE: Cursor index is checked to be greater than 0 above
+                    textBoxCursorIndex -= prevCodepointSize;
+                    textLength -= prevCodepointSize;
 
                     // Make sure text last character is EOL
                     text[textLength] = '\0';
@@ -2659,19 +3849,15 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
             // Move cursor position with mouse
             if (CheckCollisionPointRec(mousePosition, textBounds))     // Mouse hover text
             {
-                float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/(float)guiFont.baseSize;
-                int codepointIndex = 0;
                 float glyphWidth = 0.0f;
                 float widthToMouseX = 0;
                 int mouseCursorIndex = 0;
 
                 for (int i = textIndexOffset; i < textLength; i++)
                 {
-                    codepoint = GetCodepointNext(&text[i], &codepointSize);
-                    codepointIndex = GetGlyphIndex(guiFont, codepoint);
-
-                    if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                    else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+                    int codepointSize = 0;
+                    int codepoint = GetCodepointNext(&text[i], &codepointSize);
+                    glyphWidth = GetGlyphWidth(codepoint);
 
                     if (mousePosition.x <= (textBounds.x + (widthToMouseX + glyphWidth/2)))
                     {
@@ -2685,7 +3871,7 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
 
                 // Check if mouse cursor is at the last position
                 int textEndWidth = GetTextWidth(text + textIndexOffset);
-                if (GetMousePosition().x >= (textBounds.x + textEndWidth - glyphWidth/2))
+                if (GetTransformedMousePosition().x >= (textBounds.x + textEndWidth - glyphWidth/2))
                 {
                     mouseCursor.x = textBounds.x + textEndWidth;
                     mouseCursorIndex = textLength;
@@ -2709,6 +3895,9 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
                 (!CheckCollisionPointRec(mousePosition, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)))
             {
                 textBoxCursorIndex = 0;     // GLOBAL: Reset the shared cursor index
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                GuiTextUndoBreak(text);
+#endif
                 result = 1;
             }
         }
@@ -2730,15 +3919,18 @@ int GuiTextBox(Rectangle bounds, char *text, int textSize, bool editMode)
 
     // Draw control
     //--------------------------------------------------------------------
-    if (state == STATE_PRESSED)
-    {
-        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_PRESSED)));
-    }
-    else if (state == STATE_DISABLED)
+    if (!GuiDrawSkin(TEXTBOX, state, bounds))
     {
-        GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_DISABLED)));
+        if (state == STATE_PRESSED)
+        {
+            GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_PRESSED)));
+        }
+        else if (state == STATE_DISABLED)
+        {
+            GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), GetColor(GuiGetStyle(TEXTBOX, BASE_COLOR_DISABLED)));
+        }
+        else GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), BLANK);
     }
-    else GuiDrawRectangle(bounds, GuiGetStyle(TEXTBOX, BORDER_WIDTH), GetColor(GuiGetStyle(TEXTBOX, BORDER + (state*3))), BLANK);
 
     // Draw text considering index offset if required
     // NOTE: Text index offset depends on cursor position
@@ -2808,7 +4000,7 @@ int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         // Check spinner state
         if (CheckCollisionPointRec(mousePoint, bounds))
@@ -2866,8 +4058,14 @@ int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, in
     int result = 0;
     GuiState state = guiState;
 
+    GuiCachedRegionEdit(editMode);
+
+    // Value text is only formatted again when value changes
     char textValue[RAYGUI_VALUEBOX_MAX_CHARS + 1] = "\0";
-    sprintf(textValue, "%i", *value);
+    int textValueLength = 0;
+    const char *valueText = GetValueText(value, &textValueLength);
+    if (textValueLength > RAYGUI_VALUEBOX_MAX_CHARS) textValueLength = RAYGUI_VALUEBOX_MAX_CHARS;
+    memcpy(textValue, valueText, textValueLength);
 
     Rectangle textBounds = { 0 };
     if (text != NULL)
@@ -2883,7 +4081,7 @@ int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, in
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         bool valueHasChanged = false;
 
@@ -2893,6 +4091,19 @@ int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, in
 
             int keyCount = (int)strlen(textValue);
 
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+            // Undo/redo value edits, recorded as full text replacements
+            // NOTE: Text is formatted from value every frame
+            if (GuiTextUndoUpdate(value, textValue, RAYGUI_VALUEBOX_MAX_CHARS + 1, NULL))
+            {
+                *value = TextToInteger(textValue);
+                keyCount = (int)strlen(textValue);
+            }
+
+            char prevTextValue[RAYGUI_VALUEBOX_MAX_CHARS + 1] = { 0 };
+            strcpy(prevTextValue, textValue);
+#endif
+
             // Only allow keys in range [48..57]
             if (keyCount < RAYGUI_VALUEBOX_MAX_CHARS)
             {
@@ -2919,7 +4130,16 @@ int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, in
                 }
             }
 
-            if (valueHasChanged) *value = TextToInteger(textValue);
+            if (valueHasChanged)
+            {
+                *value = TextToInteger(textValue);
+
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                char newTextValue[RAYGUI_VALUEBOX_MAX_CHARS + 1] = { 0 };
+                GuiFormatInteger(newTextValue, *value);
+                if (strcmp(prevTextValue, newTextValue) != 0) GuiTextUndoRecord(value, 0, prevTextValue, (int)strlen(prevTextValue), newTextValue, (int)strlen(newTextValue));
+#endif
+            }
 
             // NOTE: We are not clamp values until user input finishes
             //if (*value > maxValue) *value = maxValue;
@@ -2930,6 +4150,9 @@ int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, in
                 if (*value > maxValue) *value = maxValue;
                 else if (*value < minValue) *value = minValue;
 
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                GuiTextUndoBreak(value);
+#endif
                 result = 1;
             }
         }
@@ -2953,7 +4176,7 @@ int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, in
     if (state == STATE_PRESSED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_PRESSED));
     else if (state == STATE_DISABLED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_DISABLED));
 
-    GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), baseColor);
+    if (!GuiDrawSkin(VALUEBOX, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), baseColor);
     GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(VALUEBOX, TEXT + (state*3))));
 
     // Draw cursor
@@ -2982,6 +4205,8 @@ int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float
     int result = 0;
     GuiState state = guiState;
 
+    GuiCachedRegionEdit(editMode);
+
     //char textValue[RAYGUI_VALUEBOX_MAX_CHARS + 1] = "\0";
     //sprintf(textValue, "%2.2f", *value);
 
@@ -2999,7 +4224,7 @@ int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         bool valueHasChanged = false;
 
@@ -3009,6 +4234,15 @@ int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float
 
             int keyCount = (int)strlen(textValue);
 
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+            // Undo/redo text edits
+            if (GuiTextUndoUpdate(textValue, textValue, RAYGUI_VALUEBOX_MAX_CHARS + 1, NULL))
+            {
+                keyCount = (int)strlen(textValue);
+                valueHasChanged = true;
+            }
+#endif
+
             // Only allow keys in range [48..57]
             if (keyCount < RAYGUI_VALUEBOX_MAX_CHARS)
             {
@@ -3020,6 +4254,10 @@ int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float
                         ((keyCount == 0) && (key == '+')) ||  // NOTE: Sign can only be in first position
                         ((keyCount == 0) && (key == '-')))
                     {
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                        char keyText = (char)key;
+                        GuiTextUndoRecord(textValue, keyCount, NULL, 0, &keyText, 1);
+#endif
                         textValue[keyCount] = (char)key;
                         keyCount++;
 
@@ -3033,6 +4271,9 @@ int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float
             {
                 if (keyCount > 0)
                 {
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                    GuiTextUndoRecord(textValue, keyCount - 1, textValue + keyCount - 1, 1, NULL, 0);
+#endif
                     keyCount--;
                     textValue[keyCount] = '\0';
                     valueHasChanged = true;
@@ -3041,7 +4282,13 @@ int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float
 
             if (valueHasChanged) *value = TextToFloat(textValue);
 
-            if ((IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_KP_ENTER)) || (!CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))) result = 1;
+            if ((IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_KP_ENTER)) || (!CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)))
+            {
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+                GuiTextUndoBreak(textValue);
+#endif
+                result = 1;
+            }
         }
         else
         {
@@ -3060,7 +4307,7 @@ int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float
     if (state == STATE_PRESSED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_PRESSED));
     else if (state == STATE_DISABLED) baseColor = GetColor(GuiGetStyle(VALUEBOX, BASE_COLOR_DISABLED));
 
-    GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), baseColor);
+    if (!GuiDrawSkin(VALUEBOX, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(VALUEBOX, BORDER_WIDTH), GetColor(GuiGetStyle(VALUEBOX, BORDER + (state*3))), baseColor);
     GuiDrawText(textValue, GetTextBounds(VALUEBOX, bounds), TEXT_ALIGN_CENTER, GetColor(GuiGetStyle(VALUEBOX, TEXT + (state*3))));
 
     // Draw cursor
@@ -3081,6 +4328,7 @@ int GuiValueBoxFloat(Rectangle bounds, const char *text, char *textValue, float
 
     return result;
 }
+#endif      // !RAYGUI_NO_TEXTBOX
 
 // Slider control with pro parameters
 // NOTE: Other GuiSlider*() controls use this one
@@ -3100,7 +4348,7 @@ int GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight,
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
         {
@@ -3163,7 +4411,7 @@ int GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight,
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(SLIDER, BORDER + (state*3))), GetColor(GuiGetStyle(SLIDER, (state != STATE_DISABLED)?  BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)));
+    if (!GuiDrawSkin(SLIDER, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(SLIDER, BORDER_WIDTH), GetColor(GuiGetStyle(SLIDER, BORDER + (state*3))), GetColor(GuiGetStyle(SLIDER, (state != STATE_DISABLED)?  BASE_COLOR_NORMAL : BASE_COLOR_DISABLED)));
 
     // Draw slider internal bar (depends on state)
     if (state == STATE_NORMAL) GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BASE_COLOR_PRESSED)));
@@ -3233,7 +4481,12 @@ int GuiProgressBar(Rectangle bounds, const char *textLeft, const char *textRight
 
     // Draw control
     //--------------------------------------------------------------------
-    if (state == STATE_DISABLED)
+    if (GuiDrawSkin(PROGRESSBAR, state, bounds))
+    {
+        // Skin draws progress bar frame, only progress is drawn
+        if (state != STATE_DISABLED) GuiDrawRectangle(progress, 0, BLANK, GetColor(GuiGetStyle(PROGRESSBAR, BASE_COLOR_PRESSED)));
+    }
+    else if (state == STATE_DISABLED)
     {
         GuiDrawRectangle(bounds, GuiGetStyle(PROGRESSBAR, BORDER_WIDTH), GetColor(GuiGetStyle(PROGRESSBAR, BORDER + (state*3))), BLANK);
     }
@@ -3294,9 +4547,11 @@ int GuiStatusBar(Rectangle bounds, const char *text)
     int result = 0;
     GuiState state = guiState;
 
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
+
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(STATUSBAR, BORDER_WIDTH), GetColor(GuiGetStyle(STATUSBAR, BORDER + (state*3))), GetColor(GuiGetStyle(STATUSBAR, BASE + (state*3))));
+    if (!GuiDrawSkin(STATUSBAR, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(STATUSBAR, BORDER_WIDTH), GetColor(GuiGetStyle(STATUSBAR, BORDER + (state*3))), GetColor(GuiGetStyle(STATUSBAR, BASE + (state*3))));
     GuiDrawText(text, GetTextBounds(STATUSBAR, bounds), GuiGetStyle(STATUSBAR, TEXT_ALIGNMENT), GetColor(GuiGetStyle(STATUSBAR, TEXT + (state*3))));
     //--------------------------------------------------------------------
 
@@ -3309,11 +4564,13 @@ int GuiDummyRec(Rectangle bounds, const char *text)
     int result = 0;
     GuiState state = guiState;
 
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
+
     // Update control
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         // Check button state
         if (CheckCollisionPointRec(mousePoint, bounds))
@@ -3333,6 +4590,7 @@ int GuiDummyRec(Rectangle bounds, const char *text)
     return result;
 }
 
+#if !defined(RAYGUI_NO_LISTVIEW)
 // List View control
 int GuiListView(Rectangle bounds, const char *text, int *scrollIndex, int *active)
 {
@@ -3353,6 +4611,8 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *scrollInd
     int result = 0;
     GuiState state = guiState;
 
+    if (GuiIsCulled(bounds)) return result;         // Out of transformed viewport
+
     int itemFocused = (focus == NULL)? -1 : *focus;
     int itemSelected = (active == NULL)? -1 : *active;
 
@@ -3380,7 +4640,7 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *scrollInd
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         // Check mouse inside list view
         if (CheckCollisionPointRec(mousePoint, bounds))
@@ -3426,7 +4686,7 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *scrollInd
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));     // Draw background
+    if (!GuiDrawSkin(LISTVIEW, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(LISTVIEW, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));     // Draw background
 
     // Draw visible items
     for (int i = 0; ((i < visibleItems) && (text != NULL)); i++)
@@ -3494,7 +4754,9 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *scrollInd
 
     return result;
 }
+#endif      // !RAYGUI_NO_LISTVIEW
 
+#if !defined(RAYGUI_NO_COLORPICKER)
 // Color Panel control - Color (RGBA) variant.
 int GuiColorPanel(Rectangle bounds, const char *text, Color *color)
 {
@@ -3540,7 +4802,7 @@ int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
         {
@@ -3597,9 +4859,9 @@ int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
             }
         }
 
-        DrawRectangleGradientEx(bounds, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha));
+        GuiDrawGradient(bounds, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha));
     }
-    else DrawRectangleGradientEx(bounds, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
+    else GuiDrawGradient(bounds, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
 
     GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
 
@@ -3626,7 +4888,7 @@ int GuiColorBarHue(Rectangle bounds, const char *text, float *hue)
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
         {
@@ -3680,16 +4942,22 @@ int GuiColorBarHue(Rectangle bounds, const char *text, float *hue)
     //--------------------------------------------------------------------
     if (state != STATE_DISABLED)
     {
-        // Draw hue bar:color bars
-        // TODO: Use directly DrawRectangleGradientEx(bounds, color1, color2, color2, color1);
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + bounds.height/6), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 2*(bounds.height/6)), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 3*(bounds.height/6)), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 4*(bounds.height/6)), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha));
-        DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 5*(bounds.height/6)), (int)bounds.width, (int)(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha));
+#if !defined(RAYGUI_NO_COLOR_TEXTURES)
+        // Draw hue bar: exact colors texture, one pixel wide (hue only changes vertically)
+        Texture2D texture = GetColorTexture(-1.0f, 1, (int)bounds.height);
+        if (texture.id > 0) GuiDrawTexture(texture, RAYGUI_CLITERAL(Rectangle){ 0, 0, 1, (float)texture.height }, bounds, Fade(RAYGUI_CLITERAL(Color){ 255, 255, 255, 255 }, guiAlpha));
+#else
+        // Draw hue bar: color bars, vertical gradients between hue key colors
+        Color hueColors[7] = { { 255, 0, 0, 255 }, { 255, 255, 0, 255 }, { 0, 255, 0, 255 }, { 0, 255, 255, 255 }, { 0, 0, 255, 255 }, { 255, 0, 255, 255 }, { 255, 0, 0, 255 } };
+
+        for (int i = 0; i < 6; i++)
+        {
+            Rectangle bar = { (float)((int)bounds.x), (float)((int)(bounds.y + i*(bounds.height/6))), (float)((int)bounds.width), (i < 5)? ceilf(bounds.height/6) : (float)((int)(bounds.height/6)) };
+            GuiDrawGradient(bar, Fade(hueColors[i], guiAlpha), Fade(hueColors[i + 1], guiAlpha), Fade(hueColors[i + 1], guiAlpha), Fade(hueColors[i], guiAlpha));
+        }
+#endif
     }
-    else DrawRectangleGradientV((int)bounds.x, (int)bounds.y, (int)bounds.width, (int)bounds.height, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
+    else GuiDrawGradient(RAYGUI_CLITERAL(Rectangle){ (float)((int)bounds.x), (float)((int)bounds.y), (float)((int)bounds.width), (float)((int)bounds.height) }, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha));
 
     GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
 
@@ -3774,17 +5042,11 @@ int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
     pickerSelector.x = bounds.x + (float)colorHsv->y*bounds.width;            // HSV: Saturation
     pickerSelector.y = bounds.y + (1.0f - (float)colorHsv->z)*bounds.height;  // HSV: Value
 
-    Vector3 maxHue = { colorHsv->x, 1.0f, 1.0f };
-    Vector3 rgbHue = ConvertHSVtoRGB(maxHue);
-    Color maxHueCol = { (unsigned char)(255.0f*rgbHue.x),
-                      (unsigned char)(255.0f*rgbHue.y),
-                      (unsigned char)(255.0f*rgbHue.z), 255 };
-
     // Update control
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
         {
@@ -3843,8 +5105,20 @@ int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
     //--------------------------------------------------------------------
     if (state != STATE_DISABLED)
     {
-        DrawRectangleGradientEx(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
-        DrawRectangleGradientEx(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
+#if !defined(RAYGUI_NO_COLOR_TEXTURES)
+        // Draw color picker: exact colors texture for current hue, single quad
+        Texture2D texture = GetColorTexture((colorHsv->x > 0.0f)? colorHsv->x : 0.0f, (int)bounds.width, (int)bounds.height);
+        if (texture.id > 0) GuiDrawTexture(texture, RAYGUI_CLITERAL(Rectangle){ 0, 0, (float)texture.width, (float)texture.height }, bounds, Fade(colWhite, guiAlpha));
+#else
+        Vector3 maxHue = { colorHsv->x, 1.0f, 1.0f };
+        Vector3 rgbHue = ConvertHSVtoRGB(maxHue);
+        Color maxHueCol = { (unsigned char)(255.0f*rgbHue.x),
+                          (unsigned char)(255.0f*rgbHue.y),
+                          (unsigned char)(255.0f*rgbHue.z), 255 };
+
+        GuiDrawGradient(bounds, Fade(colWhite, guiAlpha), Fade(colWhite, guiAlpha), Fade(maxHueCol, guiAlpha), Fade(maxHueCol, guiAlpha));
+        GuiDrawGradient(bounds, Fade(colBlack, 0), Fade(colBlack, guiAlpha), Fade(colBlack, guiAlpha), Fade(colBlack, 0));
+#endif
 
         // Draw color picker: selector
         Rectangle selector = { pickerSelector.x - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, pickerSelector.y - GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE)/2, (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE), (float)GuiGetStyle(COLORPICKER, COLOR_SELECTOR_SIZE) };
@@ -3852,15 +5126,124 @@ int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
     }
     else
     {
-        DrawRectangleGradientEx(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
+        GuiDrawGradient(bounds, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(colBlack, 0.6f), guiAlpha), Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), 0.6f), guiAlpha));
+    }
+
+    GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
+    //--------------------------------------------------------------------
+
+    return result;
+}
+
+// Color Palette control, swatches grid
+// NOTE: Swatch size is defined by bounds and columns, swatch under mouse is computed from its
+// position (no per-swatch collision checks), disabled state desaturates swatches in batches
+int GuiColorPalette(Rectangle bounds, const char *text, const Color *colors, int count, int columns, int *active)
+{
+    #if !defined(RAYGUI_COLORPALETTE_BATCH_SIZE)
+        #define RAYGUI_COLORPALETTE_BATCH_SIZE   64
+    #endif
+
+    int result = 0;
+    GuiState state = guiState;
+
+    int activeTemp = -1;
+    if (active == NULL) active = &activeTemp;
+
+    if ((colors == NULL) || (count <= 0)) return result;
+    if (columns <= 0) columns = 1;
+
+    int rows = (count + columns - 1)/columns;
+    float swatchWidth = bounds.width/columns;
+    float swatchHeight = bounds.height/rows;
+    int spacing = ((swatchWidth >= 6) && (swatchHeight >= 6))? 1 : 0;   // Swatches separation, only for big enough swatches
+    int focused = -1;
+
+    // Update control
+    //--------------------------------------------------------------------
+    if ((state != STATE_DISABLED) && !guiLocked && !guiControlExclusiveMode)
+    {
+        Vector2 mousePoint = GetTransformedMousePosition();
+
+        if (CheckCollisionPointRec(mousePoint, bounds))
+        {
+            int column = (int)((mousePoint.x - bounds.x)/swatchWidth);
+            int row = (int)((mousePoint.y - bounds.y)/swatchHeight);
+
+            if ((column < columns) && (row < rows) && (row*columns + column < count))
+            {
+                focused = row*columns + column;
+                state = STATE_FOCUSED;
+
+                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+                {
+                    *active = focused;
+                    result = 1;
+                }
+            }
+        }
+    }
+    //--------------------------------------------------------------------
+
+    // Draw control
+    //--------------------------------------------------------------------
+    Color disabled[RAYGUI_COLORPALETTE_BATCH_SIZE] = { 0 };
+    Vector3 values[RAYGUI_COLORPALETTE_BATCH_SIZE] = { 0 };
+    Rectangle activeRec = { 0 };
+    Rectangle focusedRec = { 0 };
+    int column = 0;
+    int row = 0;
+
+    for (int i = 0; i < count; i += RAYGUI_COLORPALETTE_BATCH_SIZE)
+    {
+        int batchCount = ((count - i) < RAYGUI_COLORPALETTE_BATCH_SIZE)? (count - i) : RAYGUI_COLORPALETTE_BATCH_SIZE;
+        const Color *batch = colors + i;
+
+        if (state == STATE_DISABLED)
+        {
+            for (int k = 0; k < batchCount; k++) values[k] = RAYGUI_CLITERAL(Vector3){ batch[k].r/255.0f, batch[k].g/255.0f, batch[k].b/255.0f };
+
+            GuiConvertRGBtoHSV(values, values, batchCount);
+            for (int k = 0; k < batchCount; k++) values[k].y *= 0.2f;
+            GuiConvertHSVtoRGB(values, values, batchCount);
+
+            for (int k = 0; k < batchCount; k++) disabled[k] = RAYGUI_CLITERAL(Color){ (unsigned char)(values[k].x*255.0f + 0.5f), (unsigned char)(values[k].y*255.0f + 0.5f), (unsigned char)(values[k].z*255.0f + 0.5f), batch[k].a };
+            batch = disabled;
+        }
+
+        for (int k = 0; k < batchCount; k++)
+        {
+            // NOTE: Swatch edges are rounded to pixels, so swatches do not overlap or leave gaps
+            float x = (float)((int)(bounds.x + column*swatchWidth));
+            float y = (float)((int)(bounds.y + row*swatchHeight));
+            Rectangle swatch = { x + spacing, y + spacing, (float)((int)(bounds.x + (column + 1)*swatchWidth)) - x - spacing, (float)((int)(bounds.y + (row + 1)*swatchHeight)) - y - spacing };
+
+            GuiDrawRectangle(swatch, 0, BLANK, batch[k]);
+
+            if ((i + k) == *active) activeRec = swatch;
+            if ((i + k) == focused) focusedRec = swatch;
+
+            column++;
+            if (column == columns)
+            {
+                column = 0;
+                row++;
+            }
+        }
     }
 
+    // Draw selection borders over swatches
+    if (activeRec.width > 0) GuiDrawRectangle(activeRec, 1, GetColor(GuiGetStyle(COLORPICKER, (state == STATE_DISABLED)? BORDER_COLOR_DISABLED : BORDER_COLOR_PRESSED)), BLANK);
+    if (focusedRec.width > 0) GuiDrawRectangle(focusedRec, 1, GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_FOCUSED)), BLANK);
+
     GuiDrawRectangle(bounds, GuiGetStyle(COLORPICKER, BORDER_WIDTH), GetColor(GuiGetStyle(COLORPICKER, BORDER + state*3)), BLANK);
     //--------------------------------------------------------------------
 
     return result;
 }
+#endif      // !RAYGUI_NO_COLORPICKER
 
+#if !defined(RAYGUI_NO_MESSAGEBOX)
 // Message Box control
 int GuiMessageBox(Rectangle bounds, const char *title, const char *message, const char *buttons)
 {
@@ -3912,7 +5295,9 @@ int GuiMessageBox(Rectangle bounds, const char *title, const char *message, cons
 
     return result;
 }
+#endif      // !RAYGUI_NO_MESSAGEBOX
 
+#if !defined(RAYGUI_NO_MESSAGEBOX) && !defined(RAYGUI_NO_TEXTBOX)
 // Text Input Box control, ask for text
 int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, const char *buttons, char *text, int textMaxSize, bool *secretViewActive)
 {
@@ -4003,7 +5388,9 @@ int GuiTextInputBox(Rectangle bounds, const char *title, const char *message, co
 
     return result;      // Result is the pressed button index
 }
+#endif      // !RAYGUI_NO_MESSAGEBOX && !RAYGUI_NO_TEXTBOX
 
+#if !defined(RAYGUI_NO_GRID)
 // Grid control
 // NOTE: Returns grid mouse-hover selected cell
 // About drawing lines at subpixel spacing, simple put, not easy solution:
@@ -4018,7 +5405,7 @@ int GuiGrid(Rectangle bounds, const char *text, float spacing, int subdivs, Vect
     int result = 0;
     GuiState state = guiState;
 
-    Vector2 mousePoint = GetMousePosition();
+    Vector2 mousePoint = GetTransformedMousePosition();
     Vector2 currentMouseCell = { -1, -1 };
 
     float spaceWidth = spacing/(float)subdivs;
@@ -4064,6 +5451,7 @@ int GuiGrid(Rectangle bounds, const char *text, float spacing, int subdivs, Vect
     if (mouseCell != NULL) *mouseCell = currentMouseCell;
     return result;
 }
+#endif      // !RAYGUI_NO_GRID
 
 //----------------------------------------------------------------------------------
 // Tooltip management functions
@@ -4161,6 +5549,23 @@ void GuiLoadStyle(const char *fileName)
 
                         if ((font.texture.id > 0) && (font.glyphCount > 0)) GuiSetFont(font);
 
+                    } break;
+                    case 's':
+                    {
+                        // Style skin slice: s <slice_id> <x> <y> <width> <height> <left> <top> <right> <bottom>
+                        // NOTE: Slices refer to skin texture set with GuiSetSkin() or gui font atlas
+
+                        int sliceId = 0;
+                        GuiSkinSlice slice = { 0 };
+                        sscanf(buffer, "s %d %f %f %f %f %d %d %d %d", &sliceId, &slice.source.x, &slice.source.y, &slice.source.width, &slice.source.height,
+                            &slice.left, &slice.top, &slice.right, &slice.bottom);
+
+                        if ((sliceId >= 0) && (sliceId < RAYGUI_MAX_SKIN_SLICES))
+                        {
+                            guiSkinSlices[sliceId] = slice;
+                            if (sliceId >= guiSkinSliceCount) guiSkinSliceCount = sliceId + 1;
+                        }
+
                     } break;
                     default: break;
                 }
@@ -4223,6 +5628,8 @@ void GuiLoadStyleDefault(void)
     GuiSetStyle(DEFAULT, BORDER_WIDTH, 1);
     GuiSetStyle(DEFAULT, TEXT_PADDING, 0);
     GuiSetStyle(DEFAULT, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+    GuiSetStyle(DEFAULT, SKIN_SLICE, 0);
+    guiSkinSliceCount = 0;
 
     // Initialize default extended property values
     // NOTE: By default, extended property values are initialized to 0
@@ -4232,6 +5639,7 @@ void GuiLoadStyleDefault(void)
     GuiSetStyle(DEFAULT, BACKGROUND_COLOR, 0xf5f5f5ff); // DEFAULT specific property
     GuiSetStyle(DEFAULT, TEXT_LINE_SPACING, 15);        // DEFAULT, 15 pixels between lines
     GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_MIDDLE);   // DEFAULT, text aligned vertically to middle of text-bounds
+    GuiSetStyle(DEFAULT, BORDER_RADIUS, 0);             // DEFAULT, square corners
 
     // Initialize control-specific property values
     // NOTE: Those properties are in default list but require specific values by control type
@@ -4282,9 +5690,12 @@ void GuiLoadStyleDefault(void)
     GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT, 8);
     GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW, 2);
 
+    GuiUnloadCornerAtlas();
+
     if (guiFont.texture.id != GetFontDefault().texture.id)
     {
-        // Unload previous font texture
+        // Unload previous font texture (including packed corner atlas)
+        guiCornerFontId = 0;
         UnloadTexture(guiFont.texture);
         RL_FREE(guiFont.recs);
         RL_FREE(guiFont.glyphs);
@@ -4298,10 +5709,25 @@ void GuiLoadStyleDefault(void)
         Rectangle whiteChar = guiFont.recs[95];
 
         // NOTE: We set up a 1px padding on char rectangle to avoid pixel bleeding on MSAA filtering
-        SetShapesTexture(guiFont.texture, RAYGUI_CLITERAL(Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 });
+        guiShapesTexture = guiFont.texture;
+        guiShapesRec = RAYGUI_CLITERAL(Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 };
+        SetShapesTexture(guiShapesTexture, guiShapesRec);
     }
 }
 
+// Set skin texture and slices
+// NOTE: Texture id 0 uses gui font atlas texture (style embedded skin), slices are copied
+void GuiSetSkin(Texture2D texture, const GuiSkinSlice *slices, int count)
+{
+    if ((slices == NULL) || (count < 0)) count = 0;
+    if (count > RAYGUI_MAX_SKIN_SLICES) count = RAYGUI_MAX_SKIN_SLICES;
+
+    guiSkinTexture = texture;
+    guiSkinSliceCount = count;
+
+    for (int i = 0; i < count; i++) guiSkinSlices[i] = slices[i];
+}
+
 // Get text with icon id prepended
 // NOTE: Useful to add icons by name id (enum) instead of
 // a number that can change between ricon versions
@@ -4313,26 +5739,53 @@ const char *GuiIconText(int iconId, const char *text)
     static char buffer[1024] = { 0 };
     static char iconBuffer[16] = { 0 };
 
+    // Icon id text, zero padded to 3 digits: #000#
+    int iconLength = 0;
+    iconBuffer[iconLength++] = '#';
+    if ((iconId >= 0) && (iconId < 100)) iconBuffer[iconLength++] = '0';
+    if ((iconId >= 0) && (iconId < 10)) iconBuffer[iconLength++] = '0';
+    iconLength += GuiFormatInteger(iconBuffer + iconLength, iconId);
+    iconBuffer[iconLength++] = '#';
+    iconBuffer[iconLength] = '\0';
+
     if (text != NULL)
     {
         memset(buffer, 0, 1024);
-        sprintf(buffer, "#%03i#", iconId);
+        memcpy(buffer, iconBuffer, iconLength);
 
-        for (int i = 5; i < 1024; i++)
+        for (int i = iconLength; i < 1024; i++)
         {
-            buffer[i] = text[i - 5];
-            if (text[i - 5] == '\0') break;
+            buffer[i] = text[i - iconLength];
+            if (text[i - iconLength] == '\0') break;
         }
 
         return buffer;
     }
-    else
-    {
-        sprintf(iconBuffer, "#%03i#", iconId);
+    else return iconBuffer;
+#endif
+}
+
+// Get text icon prefix size in bytes, 0 if text does not start with an icon prefix
+// NOTE: Prefix is #iconId# with 1 to 5 digits, iconId can be NULL; this is the only
+// prefix parser, used for text measure and drawing (and available to gui modules)
+int GuiGetTextIconPrefix(const char *text, int *iconId)
+{
+    if ((text == NULL) || (text[0] != '#')) return 0;
+
+    int value = 0;
+    int pos = 1;
 
-        return iconBuffer;
+    while ((pos < 6) && (text[pos] >= '0') && (text[pos] <= '9'))
+    {
+        value = value*10 + (text[pos] - '0');
+        pos++;
     }
-#endif
+
+    if ((pos == 1) || (text[pos] != '#')) return 0;
+
+    if (iconId != NULL) *iconId = value;
+
+    return pos + 1;
 }
 
 #if !defined(RAYGUI_NO_ICONS)
@@ -4403,8 +5856,17 @@ char **GuiLoadIcons(const char *fileName, bool loadIconsName)
             }
             else fseek(rgiFile, iconCount*RAYGUI_ICON_MAX_NAME_LENGTH, SEEK_CUR);
 
-            // Read icons data directly over internal icons array
-            fread(guiIconsPtr, sizeof(unsigned int), iconCount*(iconSize*iconSize/32), rgiFile);
+            // Read icons data directly over internal icons array, only icons that fit in it
+            // NOTE: Icons size is set from file, every icon requires a whole number of unsigned int
+            if ((iconSize > 0) && ((iconSize*iconSize)%32 == 0))
+            {
+                int iconElements = iconSize*iconSize/32;
+                int maxIcons = (int)(sizeof(guiIcons)/sizeof(guiIcons[0]))/iconElements;
+                if (iconCount > maxIcons) iconCount = (short)maxIcons;
+
+                iconCount = (short)fread(guiIcons, sizeof(unsigned int)*iconElements, iconCount, rgiFile);
+                GuiSetIcons(guiIcons, iconSize, iconCount);
+            }
         }
 
         fclose(rgiFile);
@@ -4413,27 +5875,107 @@ char **GuiLoadIcons(const char *fileName, bool loadIconsName)
     return guiIconsName;
 }
 
-// Draw selected icon using rectangles pixel-by-pixel
+// Draw selected icon using rectangles, one rectangle per run of set pixels in a row
+// NOTE: Icon is a single draw command when draw stream is exported as commands (DRAW_STREAM_EXPORT_COMMANDS)
 void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
 {
     #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
 
-    for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
+    if ((iconId < 0) || (iconId >= guiIconCount) || (pixelSize <= 0)) return;
+
+    GuiDrawCommand command = { 0 };
+    command.type = DRAW_COMMAND_ICON;
+    command.codepoint = iconId;
+    command.rec = RAYGUI_CLITERAL(Rectangle){ (float)posX, (float)posY, (float)(guiIconSize*pixelSize), (float)(guiIconSize*pixelSize) };
+    command.colors[0] = GuiFade(color, guiAlpha);
+
+    if (command.colors[0].a == 0) return;
+
+    if (guiDrawStreamActive && (guiDrawStreamFlags & DRAW_STREAM_EXPORT_COMMANDS)) GuiPushDrawCommand(command);
+    else
     {
-        for (int k = 0; k < 32; k++)
+        // Rectangles runs are pushed as fill commands (transformed, recorded by cached regions)
+        const unsigned int *icon = guiIconsPtr + (size_t)iconId*(guiIconSize*guiIconSize/32);
+
+        for (int y = 0, bit = 0; y < guiIconSize; y++)
         {
-            if (BIT_CHECK(guiIconsPtr[iconId*RAYGUI_ICON_DATA_ELEMENTS + i], k))
+            for (int x = 0; x < guiIconSize; x++, bit++)
             {
-            #if !defined(RAYGUI_STANDALONE)
-                GuiDrawRectangle(RAYGUI_CLITERAL(Rectangle){ (float)posX + (k%RAYGUI_ICON_SIZE)*pixelSize, (float)posY + y*pixelSize, (float)pixelSize, (float)pixelSize }, 0, BLANK, color);
-            #endif
+                if (!BIT_CHECK(icon[bit/32], bit%32)) continue;
+
+                int runX = x;
+                while ((x + 1 < guiIconSize) && BIT_CHECK(icon[(bit + 1)/32], (bit + 1)%32)) { x++; bit++; }
+
+                GuiDrawFill(posX + runX*pixelSize, posY + y*pixelSize, (x - runX + 1)*pixelSize, pixelSize, command.colors[0]);
             }
+        }
+    }
+}
+
+// Draw icon command as rectangles, one per run of set pixels in a row, drawn or added to draw data (scissor provided)
+// NOTE: Runs edges are snapped to pixels, icon rectangle can be scaled by transforms
+static void GuiDrawIconRuns(const GuiDrawCommand *command, const Rectangle *scissor)
+{
+    if ((command->codepoint < 0) || (command->codepoint >= guiIconCount)) return;
+
+    const unsigned int *icon = guiIconsPtr + (size_t)command->codepoint*(guiIconSize*guiIconSize/32);
+    float pixelSize = command->rec.width/guiIconSize;
+    Color colors[4] = { command->colors[0], command->colors[0], command->colors[0], command->colors[0] };
+    Rectangle uv = { 0 };
+
+    if ((scissor != NULL) && (guiShapesTexture.width > 0) && (guiShapesTexture.height > 0))
+    {
+        uv = RAYGUI_CLITERAL(Rectangle){ guiShapesRec.x/guiShapesTexture.width, guiShapesRec.y/guiShapesTexture.height,
+            (guiShapesRec.x + guiShapesRec.width)/guiShapesTexture.width, (guiShapesRec.y + guiShapesRec.height)/guiShapesTexture.height };
+    }
 
-            if ((k == 15) || (k == 31)) y++;
+    for (int y = 0, bit = 0; y < guiIconSize; y++)
+    {
+        float top = floorf(command->rec.y + y*pixelSize + 0.5f);
+        float bottom = floorf(command->rec.y + (y + 1)*pixelSize + 0.5f);
+
+        for (int x = 0; x < guiIconSize; x++, bit++)
+        {
+            if (!BIT_CHECK(icon[bit/32], bit%32)) continue;
+
+            int runX = x;
+            while ((x + 1 < guiIconSize) && BIT_CHECK(icon[(bit + 1)/32], (bit + 1)%32)) { x++; bit++; }
+
+            float left = floorf(command->rec.x + runX*pixelSize + 0.5f);
+            float right = floorf(command->rec.x + (x + 1)*pixelSize + 0.5f);
+            if ((right <= left) || (bottom <= top)) continue;
+
+            if (scissor == NULL) DrawRectangle((int)left, (int)top, (int)(right - left), (int)(bottom - top), colors[0]);
+            else GuiPushDrawQuad(guiShapesTexture.id, *scissor, false, RAYGUI_CLITERAL(Rectangle){ left, top, right - left, bottom - top }, uv, colors);
         }
     }
 }
 
+// Set icons data in use, icons data is not copied and must be kept by the user
+// NOTE: Every icon requires iconSize*iconSize/32 unsigned int (bit per pixel, rows first),
+// NULL icons restores internal icons data (guiIcons)
+void GuiSetIcons(unsigned int *icons, int iconSize, int iconCount)
+{
+    if (icons == NULL)
+    {
+        guiIconsPtr = guiIcons;
+        guiIconSize = RAYGUI_ICON_SIZE;
+        guiIconCount = RAYGUI_ICON_MAX_ICONS;
+    }
+    else if ((iconSize > 0) && ((iconSize*iconSize)%32 == 0) && (iconCount >= 0))
+    {
+        guiIconsPtr = icons;
+        guiIconSize = iconSize;
+        guiIconCount = iconCount;
+    }
+}
+
+// Get icons size in pixels of icons data in use
+int GuiGetIconSize(void) { return guiIconSize; }
+
+// Get icons count of icons data in use
+int GuiGetIconCount(void) { return guiIconCount; }
+
 // Set icon drawing size
 void GuiSetIconScale(int scale)
 {
@@ -4550,11 +6092,18 @@ static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
                 fileDataPtr += fontImageUncompSize;
             }
 
+            // Corner atlas packed under font atlas, rounded rectangles drawn with font texture
+            int cornerOffsetY = GuiPackCornerAtlas(&imFont);
+
             if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
             font.texture = LoadTextureFromImage(imFont);
 
             RAYGUI_FREE(imFont.data);
 
+            guiCornerFontId = (cornerOffsetY > 0)? font.texture.id : 0;
+            guiCornerOffsetY = cornerOffsetY;
+            GuiUnloadCornerAtlas();
+
             // Validate font atlas texture was loaded correctly
             if (font.texture.id != 0)
             {
@@ -4601,502 +6150,1876 @@ static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
                 int glyphsDataSize = font.glyphCount*16;    // 16 bytes data per glyph
                 int glyphsDataCompressedSize = 0;
 
-                // WARNING: Version 400 adds the compression size parameter
-                if (version >= 400)
-                {
-                    // RGS files version 400 support compressed glyphs data
-                    memcpy(&glyphsDataCompressedSize, fileDataPtr, sizeof(int));
-                    fileDataPtr += sizeof(int);
-                }
+                // WARNING: Version 400 adds the compression size parameter
+                if (version >= 400)
+                {
+                    // RGS files version 400 support compressed glyphs data
+                    memcpy(&glyphsDataCompressedSize, fileDataPtr, sizeof(int));
+                    fileDataPtr += sizeof(int);
+                }
+
+                // Allocate required glyphs space to fill with data
+                font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+
+                if ((glyphsDataCompressedSize > 0) && (glyphsDataCompressedSize != glyphsDataSize))
+                {
+                    // Glyphs data is compressed, uncompress it
+                    unsigned char *glypsDataCompressed = (unsigned char *)RAYGUI_MALLOC(glyphsDataCompressedSize);
+
+                    memcpy(glypsDataCompressed, fileDataPtr, glyphsDataCompressedSize);
+                    fileDataPtr += glyphsDataCompressedSize;
+
+                    int glyphsDataUncompSize = 0;
+                    unsigned char *glyphsDataUncomp = DecompressData(glypsDataCompressed, glyphsDataCompressedSize, &glyphsDataUncompSize);
+
+                    // Security check, data uncompressed size must match the expected original data size
+                    if (glyphsDataUncompSize != glyphsDataSize) RAYGUI_LOG("WARNING: Uncompressed font glyphs data could be corrupted");
+
+                    unsigned char *glyphsDataUncompPtr = glyphsDataUncomp;
+
+                    for (int i = 0; i < font.glyphCount; i++)
+                    {
+                        memcpy(&font.glyphs[i].value, glyphsDataUncompPtr, sizeof(int));
+                        memcpy(&font.glyphs[i].offsetX, glyphsDataUncompPtr + 4, sizeof(int));
+                        memcpy(&font.glyphs[i].offsetY, glyphsDataUncompPtr + 8, sizeof(int));
+                        memcpy(&font.glyphs[i].advanceX, glyphsDataUncompPtr + 12, sizeof(int));
+                        glyphsDataUncompPtr += 16;
+                    }
+
+                    RAYGUI_FREE(glypsDataCompressed);
+                    RAYGUI_FREE(glyphsDataUncomp);
+                }
+                else
+                {
+                    // Glyphs data is uncompressed
+                    for (int i = 0; i < font.glyphCount; i++)
+                    {
+                        memcpy(&font.glyphs[i].value, fileDataPtr, sizeof(int));
+                        memcpy(&font.glyphs[i].offsetX, fileDataPtr + 4, sizeof(int));
+                        memcpy(&font.glyphs[i].offsetY, fileDataPtr + 8, sizeof(int));
+                        memcpy(&font.glyphs[i].advanceX, fileDataPtr + 12, sizeof(int));
+                        fileDataPtr += 16;
+                    }
+                }
+            }
+            else font = GetFontDefault();   // Fallback in case of errors loading font atlas texture
+
+            GuiSetFont(font);
+
+            // Set font texture source rectangle to be used as white texture to draw shapes
+            // NOTE: It makes possible to draw shapes and text (full UI) in a single draw call
+            if ((fontWhiteRec.x > 0) &&
+                (fontWhiteRec.y > 0) &&
+                (fontWhiteRec.width > 0) &&
+                (fontWhiteRec.height > 0))
+            {
+                guiShapesTexture = font.texture;
+                guiShapesRec = fontWhiteRec;
+                SetShapesTexture(guiShapesTexture, guiShapesRec);
+            }
+
+            // Skin slices refer to previous font atlas, they are replaced by style skin (if provided)
+            guiSkinTexture = RAYGUI_CLITERAL(Texture2D){ 0 };
+            guiSkinSliceCount = 0;
+        }
+
+        // Load skin slices if available (optional section, after font data)
+        // NOTE: Skin slices are located in font atlas image, skin and text are drawn with same texture
+        int skinSliceCount = 0;
+        if ((fileDataPtr - fileData + 4) <= dataSize)
+        {
+            memcpy(&skinSliceCount, fileDataPtr, sizeof(int));
+            fileDataPtr += 4;
+        }
+
+        if ((skinSliceCount > 0) && (skinSliceCount <= (dataSize - (int)(fileDataPtr - fileData))/32))
+        {
+            GuiSkinSlice slices[RAYGUI_MAX_SKIN_SLICES] = { 0 };
+            if (skinSliceCount > RAYGUI_MAX_SKIN_SLICES) skinSliceCount = RAYGUI_MAX_SKIN_SLICES;
+
+            for (int i = 0; i < skinSliceCount; i++)
+            {
+                memcpy(&slices[i].source, fileDataPtr, sizeof(Rectangle));
+                memcpy(&slices[i].left, fileDataPtr + 16, sizeof(int));
+                memcpy(&slices[i].top, fileDataPtr + 20, sizeof(int));
+                memcpy(&slices[i].right, fileDataPtr + 24, sizeof(int));
+                memcpy(&slices[i].bottom, fileDataPtr + 28, sizeof(int));
+                fileDataPtr += 32;
+            }
+
+            GuiSetSkin(RAYGUI_CLITERAL(Texture2D){ 0 }, slices, skinSliceCount);
+        }
+#endif
+    }
+}
+
+// Gui get text width considering icon
+static int GetTextWidth(const char *text)
+{
+    #if !defined(ICON_TEXT_PADDING)
+        #define ICON_TEXT_PADDING   4
+    #endif
+
+    Vector2 textSize = { 0 };
+    int textIconOffset = 0;
+
+    if ((text != NULL) && (text[0] != '\0'))
+    {
+        // NOTE: Measure starts at icon prefix closing '#'
+        textIconOffset = GuiGetTextIconPrefix(text, NULL);
+        if (textIconOffset > 0) text += (textIconOffset - 1);
+
+        // Make sure guiFont is set, GuiGetStyle() initializes it lazynessly
+        float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+
+        // Custom MeasureText() implementation
+        if ((guiFont.texture.id > 0) && (text != NULL))
+        {
+            // Get size in bytes of text, considering end of line and line break
+            int size = GetTextLineSize(text);
+
+            float scaleFactor = fontSize/(float)guiFont.baseSize;
+            textSize.y = (float)guiFont.baseSize*scaleFactor;
+            float spacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+
+#if !defined(RAYGUI_NO_TEXT_CACHE)
+            GuiUpdateFrame();       // Entries aged by time if frames are not provided by GuiBeginFrame()
+            unsigned int check = 0;
+            unsigned int hash = GetTextHash(text, size, &check);
+            unsigned int fontKey = GetFontKey(fontSize, spacing);
+
+            if (!GuiTextCacheGet(hash, check, size, fontKey, &textSize.x))
+#endif
+            {
+                const float *asciiAdvance = GetTextAsciiAdvances();
+
+                for (int i = 0, codepointSize = 0; i < size; i += codepointSize)
+                {
+                    // ASCII runs are measured directly from glyphs width table,
+                    // UTF-8 decoding is only required for multibyte sequences
+                    int asciiCount = GetTextAsciiRun(text + i, size - i);
+                    for (int k = 0; k < asciiCount; k++) textSize.x += (asciiAdvance[(unsigned char)text[i + k]] + spacing);
+                    i += asciiCount;
+
+                    codepointSize = 0;
+                    if (i < size)
+                    {
+                        int codepoint = GetCodepointNext(&text[i], &codepointSize);
+                        textSize.x += (GetGlyphWidth(codepoint) + spacing);
+                    }
+                }
+
+#if !defined(RAYGUI_NO_TEXT_CACHE)
+                GuiTextCacheSet(hash, check, size, fontKey, textSize.x);
+#endif
+            }
+        }
+
+        if (textIconOffset > 0) textSize.x += (guiIconSize + ICON_TEXT_PADDING);
+    }
+
+    return (int)textSize.x;
+}
+
+// Get key identifying current font and style
+// NOTE: Font is identified by texture id, base size and glyphs data pointer
+static unsigned int GetFontKey(float fontSize, float spacing)
+{
+    unsigned int key = 2166136261u;
+    unsigned int values[5] = { guiFont.texture.id, (unsigned int)guiFont.baseSize, (unsigned int)((size_t)guiFont.glyphs), 0, 0 };
+    memcpy(&values[3], &fontSize, sizeof(float));
+    memcpy(&values[4], &spacing, sizeof(float));
+
+    for (int i = 0; i < 5; i++) key = (key ^ values[i])*16777619u;
+
+    return key;
+}
+
+#if defined(RAYGUI_SIMD_SSE2)
+// Get index of lowest bit set in a non-zero mask
+static int GuiBitScanForward(unsigned int mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward(&index, mask);
+    return (int)index;
+#else
+    int index = 0;
+    while ((mask & 1) == 0) { mask >>= 1; index++; }
+    return index;
+#endif
+}
+#endif
+
+// Get text size in bytes until end of text or line break
+// NOTE: SIMD version uses aligned loads, they never cross a page boundary so
+// reading some bytes after the end of the text is safe
+RAYGUI_NO_SANITIZE_ADDRESS static int GetTextLineSize(const char *text)
+{
+    int size = 0;
+
+#if defined(RAYGUI_SIMD_SSE2)
+    while ((((size_t)(text + size)) & 15) != 0)
+    {
+        if ((text[size] == '\0') || (text[size] == '\n')) return size;
+        size++;
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lineBreak = _mm_set1_epi8('\n');
+
+    while (true)
+    {
+        __m128i chunk = _mm_load_si128((const __m128i *)(text + size));
+        int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, zero), _mm_cmpeq_epi8(chunk, lineBreak)));
+
+        if (mask != 0) return size + GuiBitScanForward((unsigned int)mask);
+        size += 16;
+    }
+#elif defined(RAYGUI_SIMD_NEON)
+    while ((((size_t)(text + size)) & 15) != 0)
+    {
+        if ((text[size] == '\0') || (text[size] == '\n')) return size;
+        size++;
+    }
+
+    const uint8x16_t lineBreak = vdupq_n_u8('\n');
+
+    while (true)
+    {
+        uint8x16_t chunk = vld1q_u8((const uint8_t *)(text + size));
+        uint8x16_t found = vorrq_u8(vceqq_u8(chunk, vdupq_n_u8(0)), vceqq_u8(chunk, lineBreak));
+
+        if (vmaxvq_u8(found) != 0) break;
+        size += 16;
+    }
+#endif
+
+    while ((text[size] != '\0') && (text[size] != '\n')) size++;
+
+    return size;
+}
+
+// Get number of ASCII bytes at the start of text, checking up to length bytes
+// NOTE: Text is checked 32/16 bytes at a time when SIMD is available, 8 bytes at a time otherwise
+static int GetTextAsciiRun(const char *text, int length)
+{
+    int count = 0;
+
+#if defined(RAYGUI_SIMD_AVX2)
+    for (; (count + 32) <= length; count += 32)
+    {
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *)(text + count)));
+        if (mask != 0) return count + GuiBitScanForward(mask);
+    }
+#endif
+#if defined(RAYGUI_SIMD_SSE2)
+    for (; (count + 16) <= length; count += 16)
+    {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(text + count)));
+        if (mask != 0) return count + GuiBitScanForward((unsigned int)mask);
+    }
+#elif defined(RAYGUI_SIMD_NEON)
+    for (; (count + 16) <= length; count += 16)
+    {
+        if (vmaxvq_u8(vld1q_u8((const uint8_t *)(text + count))) >= 0x80) break;
+    }
+#else
+    for (; (count + 8) <= length; count += 8)
+    {
+        unsigned long long chunk = 0;
+        memcpy(&chunk, text + count, 8);
+        if ((chunk & 0x8080808080808080ULL) != 0) break;
+    }
+#endif
+
+    while ((count < length) && ((unsigned char)text[count] < 0x80)) count++;
+
+    return count;
+}
+
+#if !defined(RAYGUI_NO_TEXT_CACHE)
+// Get text bytes hash (FNV-1a), 4 bytes processed at a time
+// NOTE: Second hash (rotate, xor, golden ratio multiply) is computed in the same pass, different seed,
+// mixing and multiplier, so texts colliding on one hash do not collide on the other one
+static unsigned int GetTextHash(const char *text, int length, unsigned int *check)
+{
+    unsigned int hash = 2166136261u;
+    unsigned int second = 0x27d4eb2fu;
+    int i = 0;
+
+    for (; (i + 4) <= length; i += 4)
+    {
+        unsigned int chunk = 0;
+        memcpy(&chunk, text + i, 4);
+        hash = (hash ^ chunk)*16777619u;
+        second = (((second << 5) | (second >> 27)) ^ chunk)*0x9e3779b1u;
+    }
+
+    for (; i < length; i++)
+    {
+        hash = (hash ^ (unsigned char)text[i])*16777619u;
+        second = (((second << 5) | (second >> 27)) ^ (unsigned char)text[i])*0x9e3779b1u;
+    }
+
+    *check = second;
+
+    return hash;
+}
+#endif
+
+// Get ASCII glyphs width table for current font and text size
+// NOTE: Table is recomputed only when font or text size change, spacing is not included
+static const float *GetTextAsciiAdvances(void)
+{
+    float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    unsigned int key = GetFontKey(fontSize, 0.0f);
+
+    if (!guiAsciiAdvanceReady || (key != guiAsciiAdvanceKey))
+    {
+        float scaleFactor = fontSize/(float)guiFont.baseSize;
+
+        for (int i = 0; i < 128; i++)
+        {
+            int index = GetGlyphIndex(guiFont, i);
+
+            if (guiFont.glyphs[index].advanceX == 0) guiAsciiAdvance[i] = (float)guiFont.recs[index].width*scaleFactor;
+            else guiAsciiAdvance[i] = (float)guiFont.glyphs[index].advanceX*scaleFactor;
+        }
+
+        guiAsciiAdvanceKey = key;
+        guiAsciiAdvanceReady = true;
+    }
+
+    return guiAsciiAdvance;
+}
+
+// Get glyph width for codepoint, using current font and text size
+static float GetGlyphWidth(int codepoint)
+{
+    if ((codepoint >= 0) && (codepoint < 128)) return GetTextAsciiAdvances()[codepoint];
+
+    float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/(float)guiFont.baseSize;
+    int index = GetGlyphIndex(guiFont, codepoint);
+
+    if (guiFont.glyphs[index].advanceX == 0) return (float)guiFont.recs[index].width*scaleFactor;
+    else return (float)guiFont.glyphs[index].advanceX*scaleFactor;
+}
+
+#if !defined(RAYGUI_NO_TEXT_CACHE)
+// Get text width from cache
+// NOTE: Entries not used for RAYGUI_TEXT_CACHE_MAX_AGE frames are considered expired
+static bool GuiTextCacheGet(unsigned int hash, unsigned int check, int length, unsigned int fontKey, float *width)
+{
+    GuiTextCacheEntry *set = &guiTextCache[(hash & (RAYGUI_TEXT_CACHE_SIZE/RAYGUI_TEXT_CACHE_WAYS - 1))*RAYGUI_TEXT_CACHE_WAYS];
+
+    for (int i = 0; i < RAYGUI_TEXT_CACHE_WAYS; i++)
+    {
+        if ((set[i].frame != 0) && (set[i].hash == hash) && (set[i].check == check) && (set[i].length == length) && (set[i].fontKey == fontKey) &&
+            ((guiFrameCounter - set[i].frame) <= RAYGUI_TEXT_CACHE_MAX_AGE))
+        {
+            set[i].frame = guiFrameCounter;
+            *width = set[i].width;
+            guiStats.textCacheHits++;
+
+            return true;
+        }
+    }
+
+    guiStats.textCacheMisses++;
+
+    return false;
+}
+
+// Store text width into cache
+// NOTE: Replaces an empty or expired entry if available, the least recently used one otherwise
+static void GuiTextCacheSet(unsigned int hash, unsigned int check, int length, unsigned int fontKey, float width)
+{
+    GuiTextCacheEntry *set = &guiTextCache[(hash & (RAYGUI_TEXT_CACHE_SIZE/RAYGUI_TEXT_CACHE_WAYS - 1))*RAYGUI_TEXT_CACHE_WAYS];
+    int oldest = 0;
+
+    for (int i = 0; i < RAYGUI_TEXT_CACHE_WAYS; i++)
+    {
+        if ((set[i].frame == 0) || ((guiFrameCounter - set[i].frame) > RAYGUI_TEXT_CACHE_MAX_AGE))
+        {
+            oldest = i;
+            break;
+        }
+        else if ((guiFrameCounter - set[i].frame) > (guiFrameCounter - set[oldest].frame)) oldest = i;
+    }
+
+    if ((set[oldest].frame != 0) && ((guiFrameCounter - set[oldest].frame) <= RAYGUI_TEXT_CACHE_MAX_AGE)) guiStats.textCacheEvictions++;
+
+    set[oldest].hash = hash;
+    set[oldest].check = check;
+    set[oldest].fontKey = fontKey;
+    set[oldest].length = length;
+    set[oldest].frame = guiFrameCounter;
+    set[oldest].width = width;
+}
+#endif
+
+#if !defined(RAYGUI_NO_TEXT_UNDO)
+// Get text undo history for key text/value
+// NOTE: If not found and required, least recently used history is replaced
+static GuiTextUndoHistory *GetTextUndoHistory(const void *key, bool create)
+{
+    GuiTextUndoHistory *history = NULL;
+    int oldest = 0;
+
+    for (int i = 0; i < RAYGUI_TEXT_UNDO_MAX_CONTROLS; i++)
+    {
+        if (guiTextUndo[i].key == key) { history = &guiTextUndo[i]; break; }
+        if (guiTextUndo[i].lastUsed < guiTextUndo[oldest].lastUsed) oldest = i;
+    }
+
+    if ((history == NULL) && create)
+    {
+        history = &guiTextUndo[oldest];
+        history->key = key;
+        history->first = 0;
+        history->count = 0;
+        history->current = 0;
+        history->dataHead = 0;
+        history->coalesce = false;
+    }
+
+    if (history != NULL) history->lastUsed = ++guiTextUndoCounter;
+
+    return history;
+}
+
+// Record text edit: deleted bytes replaced by inserted bytes at position
+// NOTE: Consecutive typing, deletions and value replacements are coalesced into one step,
+// oldest steps are dropped when steps or data ring buffers are full
+static void GuiTextUndoRecord(const void *key, int position, const char *deleted, int deletedLength, const char *inserted, int insertedLength)
+{
+    GuiTextUndoHistory *history = GetTextUndoHistory(key, true);
+
+    // New edit discards steps that could be redone
+    if (history->current < history->count)
+    {
+        history->count = history->current;
+        history->coalesce = false;
+
+        if (history->count > 0)
+        {
+            GuiTextUndoStep *kept = &history->steps[(history->first + history->count - 1)%RAYGUI_TEXT_UNDO_MAX_STEPS];
+            history->dataHead = kept->data + kept->deleted + kept->inserted;
+        }
+    }
+
+    // Check if edit continues last step
+    char merged[RAYGUI_TEXT_UNDO_DATA_SIZE] = { 0 };
+    GuiTextUndoStep *last = (history->coalesce && (history->count > 0))? &history->steps[(history->first + history->count - 1)%RAYGUI_TEXT_UNDO_MAX_STEPS] : NULL;
+
+    if ((last != NULL) && ((last->deleted + last->inserted + deletedLength + insertedLength) <= RAYGUI_TEXT_UNDO_DATA_SIZE))
+    {
+        int mergedPosition = -1;
+        int mergedDeleted = 0;
+        int mergedInserted = 0;
+
+        if ((deletedLength == 0) && (last->inserted > 0) && (position == last->position + last->inserted) &&
+            !((inserted[0] == ' ') && (history->data[(last->data + last->deleted + last->inserted - 1)%RAYGUI_TEXT_UNDO_DATA_SIZE] != ' ')))
+        {
+            // Typing continues, a space after a word starts a new step
+            for (int i = 0; i < last->deleted + last->inserted; i++) merged[i] = history->data[(last->data + i)%RAYGUI_TEXT_UNDO_DATA_SIZE];
+            for (int i = 0; i < insertedLength; i++) merged[last->deleted + last->inserted + i] = inserted[i];
+            mergedPosition = last->position;
+            mergedDeleted = last->deleted;
+            mergedInserted = last->inserted + insertedLength;
+        }
+        else if ((insertedLength == 0) && (last->inserted == 0) && ((position == last->position) || (position + deletedLength == last->position)))
+        {
+            // Forward deletion appends deleted bytes, backward deletion prepends them
+            bool forward = (position == last->position);
+            for (int i = 0; i < last->deleted; i++) merged[(forward? 0 : deletedLength) + i] = history->data[(last->data + i)%RAYGUI_TEXT_UNDO_DATA_SIZE];
+            for (int i = 0; i < deletedLength; i++) merged[(forward? last->deleted : 0) + i] = deleted[i];
+            mergedPosition = position;
+            mergedDeleted = last->deleted + deletedLength;
+        }
+        else if ((position == last->position) && (deletedLength > 0) && (deletedLength == last->inserted))
+        {
+            // Replacement of last inserted bytes (value boxes)
+            bool replaced = true;
+            for (int i = 0; (i < deletedLength) && replaced; i++) replaced = (deleted[i] == history->data[(last->data + last->deleted + i)%RAYGUI_TEXT_UNDO_DATA_SIZE]);
+
+            if (replaced)
+            {
+                for (int i = 0; i < last->deleted; i++) merged[i] = history->data[(last->data + i)%RAYGUI_TEXT_UNDO_DATA_SIZE];
+                for (int i = 0; i < insertedLength; i++) merged[last->deleted + i] = inserted[i];
+                mergedPosition = position;
+                mergedDeleted = last->deleted;
+                mergedInserted = insertedLength;
+            }
+        }
+
+        if (mergedPosition >= 0)
+        {
+            // Replace last step by merged one
+            history->dataHead = last->data;
+            history->count--;
+            history->current--;
+
+            position = mergedPosition;
+            deleted = merged;
+            deletedLength = mergedDeleted;
+            inserted = merged + mergedDeleted;
+            insertedLength = mergedInserted;
+        }
+    }
+
+    int size = deletedLength + insertedLength;
+
+    if (size == 0) return;
+    if (size > RAYGUI_TEXT_UNDO_DATA_SIZE)
+    {
+        // Edit does not fit in history, previous steps can not be undone anymore
+        history->count = 0;
+        history->current = 0;
+        history->coalesce = false;
+        return;
+    }
+
+    // Drop oldest steps to make room for new one
+    while ((history->count > 0) && ((history->count == RAYGUI_TEXT_UNDO_MAX_STEPS) ||
+           ((history->dataHead + size - history->steps[history->first%RAYGUI_TEXT_UNDO_MAX_STEPS].data) > RAYGUI_TEXT_UNDO_DATA_SIZE)))
+    {
+        history->first++;
+        history->count--;
+        history->current--;
+    }
+
+    GuiTextUndoStep *step = &history->steps[(history->first + history->count)%RAYGUI_TEXT_UNDO_MAX_STEPS];
+    step->position = position;
+    step->deleted = deletedLength;
+    step->inserted = insertedLength;
+    step->data = history->dataHead;
+
+    for (int i = 0; i < deletedLength; i++) history->data[(history->dataHead + i)%RAYGUI_TEXT_UNDO_DATA_SIZE] = deleted[i];
+    for (int i = 0; i < insertedLength; i++) history->data[(history->dataHead + deletedLength + i)%RAYGUI_TEXT_UNDO_DATA_SIZE] = inserted[i];
+
+    history->dataHead += size;
+    history->count++;
+    history->current++;
+    history->coalesce = true;
+}
+
+// Check undo/redo keys (CTRL+Z, CTRL+Y or CTRL+SHIFT+Z) and apply step to text
+// NOTE: Cost is proportional to the step size, cursor is placed after the restored bytes
+static bool GuiTextUndoUpdate(const void *key, char *text, int textSize, int *cursor)
+{
+    if (!IsKeyDown(KEY_LEFT_CONTROL) && !IsKeyDown(KEY_RIGHT_CONTROL)) return false;
+
+    bool redo = IsKeyPressed(KEY_Y) || (IsKeyPressed(KEY_Z) && (IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT)));
+    if (!redo && !IsKeyPressed(KEY_Z)) return false;
+
+    GuiTextUndoHistory *history = GetTextUndoHistory(key, false);
+    if ((history == NULL) || (redo && (history->current >= history->count)) || (!redo && (history->current == 0))) return false;
+
+    GuiTextUndoStep *step = &history->steps[(history->first + history->current - (redo? 0 : 1))%RAYGUI_TEXT_UNDO_MAX_STEPS];
+    int textLength = (int)strlen(text);
+    int removeLength = redo? step->deleted : step->inserted;
+    int insertLength = redo? step->inserted : step->deleted;
+    unsigned int insertData = step->data + (redo? step->deleted : 0);
+
+    // Text modified out of the control, history does not match it anymore
+    if (((step->position + removeLength) > textLength) || ((textLength - removeLength + insertLength) >= textSize))
+    {
+        GuiClearUndoHistory(key);
+        return false;
+    }
+
+    memmove(text + step->position + insertLength, text + step->position + removeLength, textLength - step->position - removeLength + 1);
+    for (int i = 0; i < insertLength; i++) text[step->position + i] = history->data[(insertData + i)%RAYGUI_TEXT_UNDO_DATA_SIZE];
+
+    if (cursor != NULL) *cursor = step->position + insertLength;
+
+    if (redo) history->current++;
+    else history->current--;
+    history->coalesce = false;
+
+    return true;
+}
+
+// Finish current typing burst, next edit starts a new step
+static void GuiTextUndoBreak(const void *key)
+{
+    GuiTextUndoHistory *history = GetTextUndoHistory(key, false);
+
+    if (history != NULL) history->coalesce = false;
+}
+#endif
+
+// Format unsigned integer as text, zero padded to minDigits, returns text length
+static int GuiFormatUnsigned(char *buffer, unsigned long long value, int minDigits)
+{
+    char digits[24] = { 0 };
+    int count = 0;
+
+    do
+    {
+        digits[count++] = (char)('0' + value%10);
+        value /= 10;
+    } while ((value > 0) || (count < minDigits));
+
+    for (int i = 0; i < count; i++) buffer[i] = digits[count - 1 - i];
+    buffer[count] = '\0';
+
+    return count;
+}
+
+#if !defined(RAYGUI_NO_TEXTBOX)
+// Get value text from value boxes cache, formatted again only if value changed
+static const char *GetValueText(const int *value, int *length)
+{
+    GuiValueTextEntry *entry = &guiValueTextCache[(((size_t)value >> 2)*2654435761u) & (RAYGUI_VALUE_TEXT_CACHE_SIZE - 1)];
+
+    if ((entry->key != value) || (entry->value != *value))
+    {
+        entry->key = value;
+        entry->value = *value;
+        entry->length = GuiFormatInteger(entry->text, *value);
+        GuiUpdateFrame();
+        guiStats.valueTextFormats++;
+    }
+
+    *length = entry->length;
+
+    return entry->text;
+}
+
+// Get size of valid UTF-8 sequence at start of text, negative size of bytes to skip if not valid
+// NOTE: Control codepoints, overlong encodings, surrogates and truncated sequences are not valid
+static int GetTextValidSequence(const char *text, int length, bool multiline)
+{
+    unsigned char c = (unsigned char)text[0];
+
+    if (c < 0x80) return ((c >= 32) || (multiline && (c == '\n')))? 1 : -1;
+
+    int size = 0;
+    int codepoint = 0;
+    int min = 0;
+
+    if ((c & 0xe0) == 0xc0) { size = 2; codepoint = c & 0x1f; min = 0x80; }
+    else if ((c & 0xf0) == 0xe0) { size = 3; codepoint = c & 0x0f; min = 0x800; }
+    else if ((c & 0xf8) == 0xf0) { size = 4; codepoint = c & 0x07; min = 0x10000; }
+    else return -1;
+
+    for (int i = 1; i < size; i++)
+    {
+        if ((i >= length) || ((text[i] & 0xc0) != 0x80)) return -i;
+        codepoint = (codepoint << 6) | (text[i] & 0x3f);
+    }
+
+    if ((codepoint < min) || (codepoint > 0x10ffff) || ((codepoint >= 0xd800) && (codepoint <= 0xdfff))) return -size;
+
+    return size;
+}
+
+// Insert UTF-8 text span at position, returns number of bytes inserted
+// NOTE: Span is validated and truncated to fit textSize (at a codepoint boundary) in a first pass,
+// then text tail is moved once: cost is O(textLength + insertLength) for any span size
+static int GuiTextInsert(char *text, int textSize, int textLength, int position, const char *insert, int insertLength, bool multiline)
+{
+    int available = textSize - 1 - textLength;
+    int size = 0;           // Valid bytes to insert
+    int end = 0;            // Span bytes consumed
+    bool valid = true;      // All consumed bytes are valid, span can be copied directly
+
+    while (end < insertLength)
+    {
+        int sequenceSize = GetTextValidSequence(insert + end, insertLength - end, multiline);
+
+        if (sequenceSize < 0) { valid = false; end -= sequenceSize; continue; }
+        if ((size + sequenceSize) > available) break;
+
+        size += sequenceSize;
+        end += sequenceSize;
+    }
+
+    if (size == 0) return 0;
+
+    // Move text tail (including EOL) once, then copy valid bytes
+    memmove(text + position + size, text + position, textLength - position + 1);
+
+    if (valid) memcpy(text + position, insert, size);
+    else
+    {
+        for (int i = 0, copied = 0; i < end;)
+        {
+            int sequenceSize = GetTextValidSequence(insert + i, end - i, multiline);
+
+            if (sequenceSize > 0) { memcpy(text + position + copied, insert + i, sequenceSize); copied += sequenceSize; i += sequenceSize; }
+            else i -= sequenceSize;
+        }
+    }
+
+    return size;
+}
+#endif      // !RAYGUI_NO_TEXTBOX
+
+// Get text bounds considering control bounds
+static Rectangle GetTextBounds(int control, Rectangle bounds)
+{
+    Rectangle textBounds = bounds;
+
+    textBounds.x = bounds.x + GuiGetStyle(control, BORDER_WIDTH);
+    textBounds.y = bounds.y + GuiGetStyle(control, BORDER_WIDTH) + GuiGetStyle(control, TEXT_PADDING);
+    textBounds.width = bounds.width - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);
+    textBounds.height = bounds.height - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);    // NOTE: Text is processed line per line!
+
+    // Depending on control, TEXT_PADDING and TEXT_ALIGNMENT properties could affect the text-bounds
+    switch (control)
+    {
+        case COMBOBOX:
+        case DROPDOWNBOX:
+        case LISTVIEW:
+            // TODO: Special cases (no label): COMBOBOX, DROPDOWNBOX, LISTVIEW
+        case SLIDER:
+        case CHECKBOX:
+        case VALUEBOX:
+        case SPINNER:
+            // TODO: More special cases (label on side): SLIDER, CHECKBOX, VALUEBOX, SPINNER
+        default:
+        {
+            // TODO: WARNING: TEXT_ALIGNMENT is already considered in GuiDrawText()
+            if (GuiGetStyle(control, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT) textBounds.x -= GuiGetStyle(control, TEXT_PADDING);
+            else textBounds.x += GuiGetStyle(control, TEXT_PADDING);
+        }
+        break;
+    }
+
+    return textBounds;
+}
+
+// Get text icon if provided and move text cursor
+// NOTE: We support up to 5 digits values for iconId (99999), see GuiGetTextIconPrefix()
+static const char *GetTextIcon(const char *text, int *iconId)
+{
+#if !defined(RAYGUI_NO_ICONS)
+    *iconId = -1;
+
+    // Move text pointer after icon
+    // WARNING: If only icon provided, it could point to EOL character: '\0'
+    text += GuiGetTextIconPrefix(text, iconId);
+#endif
+
+    return text;
+}
+
+// Get text divided into lines (by line-breaks '\n')
+const char **GetTextLines(const char *text, int *count)
+{
+    #define RAYGUI_MAX_TEXT_LINES   128
+
+    static const char *lines[RAYGUI_MAX_TEXT_LINES] = { 0 };
+    for (int i = 0; i < RAYGUI_MAX_TEXT_LINES; i++) lines[i] = NULL;    // Init NULL pointers to substrings
+
+    int textSize = (int)strlen(text);
+
+    lines[0] = text;
+    int len = 0;
+    *count = 1;
+    //int lineSize = 0;   // Stores current line size, not returned
+
+    for (int i = 0, k = 0; (i < textSize) && (*count < RAYGUI_MAX_TEXT_LINES); i++)
+    {
+        if (text[i] == '\n')
+        {
+            //lineSize = len;
+            k++;
+            lines[k] = &text[i + 1];     // WARNING: next value is valid?
+            len = 0;
+            *count += 1;
+        }
+        else len++;
+    }
+
+    //lines[*count - 1].size = len;
+
+    return lines;
+}
+
+// Get text width to next space for provided string
+static float GetNextSpaceWidth(const char *text, int *nextSpaceIndex)
+{
+    float width = 0;
+    int codepointByteCount = 0;
+    int codepoint = 0;
+    const float *asciiAdvance = GetTextAsciiAdvances();
+    float spacing = (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+
+    for (int i = 0; text[i] != '\0'; i++)
+    {
+        if (text[i] != ' ')
+        {
+            if ((unsigned char)text[i] < 0x80) width += (asciiAdvance[(unsigned char)text[i]] + spacing);
+            else
+            {
+                codepoint = GetCodepoint(&text[i], &codepointByteCount);
+                width += (GetGlyphWidth(codepoint) + spacing);
+            }
+        }
+        else
+        {
+            *nextSpaceIndex = i;
+            break;
+        }
+    }
+
+    return width;
+}
+
+// Gui draw text using default font
+static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, Color tint)
+{
+    #define TEXT_VALIGN_PIXEL_OFFSET(h)  ((int)h%2)     // Vertical alignment for pixel perfect
+
+    #if !defined(ICON_TEXT_PADDING)
+        #define ICON_TEXT_PADDING   4
+    #endif
+
+    if ((text == NULL) || (text[0] == '\0')) return;    // Security check
+
+    // PROCEDURE:
+    //   - Text is processed line per line
+    //   - For every line, horizontal alignment is defined
+    //   - For all text, vertical alignment is defined (multiline text only)
+    //   - For every line, wordwrap mode is checked (useful for GuitextBox(), read-only)
+
+    // Get text lines (using '\n' as delimiter) to be processed individually
+    // WARNING: We can't use GuiTextSplit() function because it can be already used
+    // before the GuiDrawText() call and its buffer is static, it would be overriden :(
+    int lineCount = 0;
+    const char **lines = GetTextLines(text, &lineCount);
+
+    // Text style variables
+    //int alignment = GuiGetStyle(DEFAULT, TEXT_ALIGNMENT);
+    int alignmentVertical = GuiGetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL);
+    int wrapMode = GuiGetStyle(DEFAULT, TEXT_WRAP_MODE);    // Wrap-mode only available in read-only mode, no for text editing
+
+    // TODO: WARNING: This totalHeight is not valid for vertical alignment in case of word-wrap
+    float totalHeight = (float)(lineCount*GuiGetStyle(DEFAULT, TEXT_SIZE) + (lineCount - 1)*GuiGetStyle(DEFAULT, TEXT_SIZE)/2);
+    float posOffsetY = 0.0f;
+
+    for (int i = 0; i < lineCount; i++)
+    {
+        int iconId = 0;
+        lines[i] = GetTextIcon(lines[i], &iconId);      // Check text for icon and move cursor
+
+        // Get text position depending on alignment and iconId
+        //---------------------------------------------------------------------------------
+        Vector2 textBoundsPosition = { textBounds.x, textBounds.y };
+        float textBoundsWidthOffset = 0.0f;
+
+        // NOTE: We get text size after icon has been processed
+        // WARNING: GetTextWidth() also processes text icon to get width! -> Really needed?
+        int textSizeX = GetTextWidth(lines[i]);
+
+        // If text requires an icon, add size to measure
+        if (iconId >= 0)
+        {
+            textSizeX += guiIconSize*guiIconScale;
+
+            // WARNING: If only icon provided, text could be pointing to EOF character: '\0'
+#if !defined(RAYGUI_NO_ICONS)
+            if ((lines[i] != NULL) && (lines[i][0] != '\0')) textSizeX += ICON_TEXT_PADDING;
+#endif
+        }
+
+        // Check guiTextAlign global variables
+        switch (alignment)
+        {
+            case TEXT_ALIGN_LEFT: textBoundsPosition.x = textBounds.x; break;
+            case TEXT_ALIGN_CENTER: textBoundsPosition.x = textBounds.x +  textBounds.width/2 - textSizeX/2; break;
+            case TEXT_ALIGN_RIGHT: textBoundsPosition.x = textBounds.x + textBounds.width - textSizeX; break;
+            default: break;
+        }
+
+        if (textSizeX > textBounds.width && (lines[i] != NULL) && (lines[i][0] != '\0')) textBoundsPosition.x = textBounds.x;
+
+        switch (alignmentVertical)
+        {
+            // Only valid in case of wordWrap = 0;
+            case TEXT_ALIGN_TOP: textBoundsPosition.y = textBounds.y + posOffsetY; break;
+            case TEXT_ALIGN_MIDDLE: textBoundsPosition.y = textBounds.y + posOffsetY + textBounds.height/2 - totalHeight/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height); break;
+            case TEXT_ALIGN_BOTTOM: textBoundsPosition.y = textBounds.y + posOffsetY + textBounds.height - totalHeight + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height); break;
+            default: break;
+        }
+
+        // NOTE: Make sure we get pixel-perfect coordinates,
+        // In case of decimals we got weird text positioning
+        textBoundsPosition.x = (float)((int)textBoundsPosition.x);
+        textBoundsPosition.y = (float)((int)textBoundsPosition.y);
+        //---------------------------------------------------------------------------------
+
+        // Draw text (with icon if available)
+        //---------------------------------------------------------------------------------
+#if !defined(RAYGUI_NO_ICONS)
+        if (iconId >= 0)
+        {
+            // NOTE: We consider icon height, probably different than text size
+            GuiDrawIcon(iconId, (int)textBoundsPosition.x, (int)(textBounds.y + textBounds.height/2 - guiIconSize*guiIconScale/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height)), guiIconScale, tint);
+            textBoundsPosition.x += (float)(guiIconSize*guiIconScale + ICON_TEXT_PADDING);
+            textBoundsWidthOffset = (float)(guiIconSize*guiIconScale + ICON_TEXT_PADDING);
+        }
+#endif
+        // Get size in bytes of text,
+        // considering end of line and line break
+        int lineSize = 0;
+        for (int c = 0; (lines[i][c] != '\0') && (lines[i][c] != '\n') && (lines[i][c] != '\r'); c++, lineSize++){ }
+
+        int lastSpaceIndex = 0;
+        bool tempWrapCharMode = false;
+
+        int textOffsetY = 0;
+        float textOffsetX = 0.0f;
+        float glyphWidth = 0;
+        const float *asciiAdvance = GetTextAsciiAdvances();
+
+        int ellipsisWidth = GetTextWidth("...");
+        bool textOverflow = false;
+        for (int c = 0, codepointSize = 0; c < lineSize; c += codepointSize)
+        {
+            int codepoint = 0;
+
+            // Get glyph width to check if it goes out of bounds
+            // NOTE: ASCII codepoints avoid UTF-8 decoding and glyph index search
+            if ((unsigned char)lines[i][c] < 0x80)
+            {
+                codepoint = lines[i][c];
+                codepointSize = 1;
+                glyphWidth = asciiAdvance[codepoint];
+            }
+            else
+            {
+                codepoint = GetCodepointNext(&lines[i][c], &codepointSize);
+
+                // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
+                // but we need to draw all of the bad bytes using the '?' symbol moving one byte
+                if (codepoint == 0x3f) codepointSize = 1; // TODO: Review not recognized codepoints size
+
+                glyphWidth = GetGlyphWidth(codepoint);
+            }
+
+            // Wrap mode text measuring, to validate if
+            // it can be drawn or a new line is required
+            if (wrapMode == TEXT_WRAP_CHAR)
+            {
+                // Jump to next line if current character reach end of the box limits
+                if ((textOffsetX + glyphWidth) > textBounds.width - textBoundsWidthOffset)
+                {
+                    textOffsetX = 0.0f;
+                    textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+
+                    if (tempWrapCharMode)   // Wrap at char level when too long words
+                    {
+                        wrapMode = TEXT_WRAP_WORD;
+                        tempWrapCharMode = false;
+                    }
+                }
+            }
+            else if (wrapMode == TEXT_WRAP_WORD)
+            {
+                if (codepoint == 32) lastSpaceIndex = c;
+
+                // Get width to next space in line
+                int nextSpaceIndex = 0;
+                float nextSpaceWidth = GetNextSpaceWidth(lines[i] + c, &nextSpaceIndex);
+
+                int nextSpaceIndex2 = 0;
+                float nextWordSize = GetNextSpaceWidth(lines[i] + lastSpaceIndex + 1, &nextSpaceIndex2);
+
+                if (nextWordSize > textBounds.width - textBoundsWidthOffset)
+                {
+                    // Considering the case the next word is longer than bounds
+                    tempWrapCharMode = true;
+                    wrapMode = TEXT_WRAP_CHAR;
+                }
+                else if ((textOffsetX + nextSpaceWidth) > textBounds.width - textBoundsWidthOffset)
+                {
+                    textOffsetX = 0.0f;
+                    textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+                }
+            }
+
+            if (codepoint == '\n') break;   // WARNING: Lines are already processed manually, no need to keep drawing after this codepoint
+            else
+            {
+                // TODO: There are multiple types of spaces in Unicode,
+                // maybe it's a good idea to add support for more: http://jkorpela.fi/chars/spaces.html
+                if ((codepoint != ' ') && (codepoint != '\t'))      // Do not draw codepoints with no glyph
+                {
+                    if (wrapMode == TEXT_WRAP_NONE)
+                    {
+                        // Draw only required text glyphs fitting the textBounds.width
+                        if (textSizeX > textBounds.width)
+                        {
+                            if (textOffsetX <= (textBounds.width - glyphWidth - textBoundsWidthOffset - ellipsisWidth))
+                            {
+                                GuiDrawGlyph(codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, GuiFade(tint, guiAlpha));
+                            }
+                            else if (!textOverflow)
+                            {
+                                textOverflow = true;
+
+                                for (int j = 0; j < ellipsisWidth; j += ellipsisWidth/3)
+                                {
+                                    GuiDrawGlyph('.', RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX + j, textBoundsPosition.y + textOffsetY }, GuiFade(tint, guiAlpha));
+                                }
+                            }
+                        }
+                        else
+                        {
+                            GuiDrawGlyph(codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, GuiFade(tint, guiAlpha));
+                        }
+                    }
+                    else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD))
+                    {
+                        // Draw only glyphs inside the bounds
+                        if ((textBoundsPosition.y + textOffsetY) <= (textBounds.y + textBounds.height - GuiGetStyle(DEFAULT, TEXT_SIZE)))
+                        {
+                            GuiDrawGlyph(codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, GuiFade(tint, guiAlpha));
+                        }
+                    }
+                }
+
+                textOffsetX += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+            }
+        }
+
+        if (wrapMode == TEXT_WRAP_NONE) posOffsetY += (float)GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
+        else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD)) posOffsetY += (textOffsetY + (float)GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
+        //---------------------------------------------------------------------------------
+    }
+
+#if defined(RAYGUI_DEBUG_TEXT_BOUNDS)
+    GuiDrawRectangle(textBounds, 0, WHITE, Fade(BLUE, 0.4f));
+#endif
+}
+
+// Gui draw rectangle using default raygui plain style with borders
+// NOTE: Rectangle corners are rounded with BORDER_RADIUS (if rectangle size and border width allow it)
+static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color)
+{
+    int cornerIndex = GetCornerIndex(rec, borderWidth);
+
+    if (cornerIndex >= 0)
+    {
+        // Corner atlas packed in gui font atlas is drawn with font texture, same batch as text and shapes
+        bool packed = (guiCornerFontId > 0) && (guiCornerFontId == guiFont.texture.id);
+        Texture2D texture = packed? guiFont.texture : guiCornerAtlas;
+        int offsetY = packed? guiCornerOffsetY : 0;
+
+        // Draw rounded rectangle filled shape and border shape over it, same texture for both
+        if (color.a > 0) GuiDrawNineSlice(texture, GetCornerSlice(cornerIndex, 0, offsetY), rec, GuiFade(color, guiAlpha), true);
+        if (borderWidth > 0) GuiDrawNineSlice(texture, GetCornerSlice(cornerIndex, borderWidth, offsetY), rec, GuiFade(borderColor, guiAlpha), false);
+    }
+    else
+    {
+        if (color.a > 0)
+        {
+            // Draw rectangle filled with color
+            GuiDrawFill((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, GuiFade(color, guiAlpha));
+        }
+
+        if (borderWidth > 0)
+        {
+            // Draw rectangle border lines with color
+            GuiDrawFill((int)rec.x, (int)rec.y, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
+            GuiDrawFill((int)rec.x, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
+            GuiDrawFill((int)rec.x + (int)rec.width - borderWidth, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
+            GuiDrawFill((int)rec.x, (int)rec.y + (int)rec.height - borderWidth, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
+        }
+    }
+
+#if defined(RAYGUI_DEBUG_RECS_BOUNDS)
+    GuiDrawFill((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, Fade(RED, 0.4f));
+#endif
+}
+
+// Gui draw control skin slice for state (nine quads)
+static bool GuiDrawSkin(int control, int state, Rectangle rec)
+{
+    int slice = GuiGetStyle(control, SKIN_SLICE) - 1 + state;
+    if ((GuiGetStyle(control, SKIN_SLICE) <= 0) || (slice >= guiSkinSliceCount)) return false;
+
+    Texture2D texture = (guiSkinTexture.id > 0)? guiSkinTexture : guiFont.texture;
+    GuiDrawNineSlice(texture, guiSkinSlices[slice], rec, GuiFade(RAYGUI_CLITERAL(Color){ 255, 255, 255, 255 }, guiAlpha), true);
+
+    return true;
+}
 
-                // Allocate required glyphs space to fill with data
-                font.glyphs = (GlyphInfo *)RAYGUI_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+// Gui draw texture nine-slice (nine quads), corners keep size, edges and center are stretched
+// NOTE: Borders are scaled down if rectangle is smaller than slice borders
+static void GuiDrawNineSlice(Texture2D texture, GuiSkinSlice slice, Rectangle rec, Color tint, bool center)
+{
+    rec = RAYGUI_CLITERAL(Rectangle){ (float)((int)rec.x), (float)((int)rec.y), (float)((int)rec.width), (float)((int)rec.height) };
+
+    float left = (float)slice.left;
+    float right = (float)slice.right;
+    float top = (float)slice.top;
+    float bottom = (float)slice.bottom;
+    float scaleX = ((left + right) > rec.width)? rec.width/(left + right) : 1.0f;
+    float scaleY = ((top + bottom) > rec.height)? rec.height/(top + bottom) : 1.0f;
+
+    // Columns and rows edges: source and destination
+    float srcX[4] = { slice.source.x, slice.source.x + left, slice.source.x + slice.source.width - right, slice.source.x + slice.source.width };
+    float srcY[4] = { slice.source.y, slice.source.y + top, slice.source.y + slice.source.height - bottom, slice.source.y + slice.source.height };
+    float dstX[4] = { rec.x, rec.x + left*scaleX, rec.x + rec.width - right*scaleX, rec.x + rec.width };
+    float dstY[4] = { rec.y, rec.y + top*scaleY, rec.y + rec.height - bottom*scaleY, rec.y + rec.height };
+
+    for (int y = 0; y < 3; y++)
+    {
+        for (int x = 0; x < 3; x++)
+        {
+            if (!center && (x == 1) && (y == 1)) continue;
 
-                if ((glyphsDataCompressedSize > 0) && (glyphsDataCompressedSize != glyphsDataSize))
-                {
-                    // Glyphs data is compressed, uncompress it
-                    unsigned char *glypsDataCompressed = (unsigned char *)RAYGUI_MALLOC(glyphsDataCompressedSize);
+            Rectangle source = { srcX[x], srcY[y], srcX[x + 1] - srcX[x], srcY[y + 1] - srcY[y] };
+            Rectangle dest = { dstX[x], dstY[y], dstX[x + 1] - dstX[x], dstY[y + 1] - dstY[y] };
 
-                    memcpy(glypsDataCompressed, fileDataPtr, glyphsDataCompressedSize);
-                    fileDataPtr += glyphsDataCompressedSize;
+            if ((source.width > 0) && (source.height > 0) && (dest.width > 0) && (dest.height > 0)) GuiDrawTexture(texture, source, dest, tint);
+        }
+    }
+}
 
-                    int glyphsDataUncompSize = 0;
-                    unsigned char *glyphsDataUncomp = DecompressData(glypsDataCompressed, glyphsDataCompressedSize, &glyphsDataUncompSize);
+// Get corner atlas radius index for rectangle, -1 for square corners
+// NOTE: BORDER_RADIUS is limited to half rectangle size and snapped down to corner atlas radius values,
+// corner atlas is generated on first use: coverage computed with rounded rectangle signed distance
+static int GetCornerIndex(Rectangle rec, int borderWidth)
+{
+    int radius = GuiGetStyle(DEFAULT, BORDER_RADIUS);
+    if (radius < guiCornerRadius[0]) return -1;
 
-                    // Security check, data uncompressed size must match the expected original data size
-                    if (glyphsDataUncompSize != glyphsDataSize) RAYGUI_LOG("WARNING: Uncompressed font glyphs data could be corrupted");
+    int maxRadius = (((int)rec.width < (int)rec.height)? (int)rec.width : (int)rec.height)/2;
+    if (radius > maxRadius) radius = maxRadius;
 
-                    unsigned char *glyphsDataUncompPtr = glyphsDataUncomp;
+    int cornerIndex = -1;
+    for (int i = 0; i < RAYGUI_CORNER_RADIUS_COUNT; i++) if (guiCornerRadius[i] <= radius) cornerIndex = i;
 
-                    for (int i = 0; i < font.glyphCount; i++)
-                    {
-                        memcpy(&font.glyphs[i].value, glyphsDataUncompPtr, sizeof(int));
-                        memcpy(&font.glyphs[i].offsetX, glyphsDataUncompPtr + 4, sizeof(int));
-                        memcpy(&font.glyphs[i].offsetY, glyphsDataUncompPtr + 8, sizeof(int));
-                        memcpy(&font.glyphs[i].advanceX, glyphsDataUncompPtr + 12, sizeof(int));
-                        glyphsDataUncompPtr += 16;
-                    }
+    if ((cornerIndex < 0) || (borderWidth > RAYGUI_CORNER_MAX_BORDER) || (borderWidth > guiCornerRadius[cornerIndex])) return -1;
 
-                    RAYGUI_FREE(glypsDataCompressed);
-                    RAYGUI_FREE(glyphsDataUncomp);
-                }
-                else
-                {
-                    // Glyphs data is uncompressed
-                    for (int i = 0; i < font.glyphCount; i++)
-                    {
-                        memcpy(&font.glyphs[i].value, fileDataPtr, sizeof(int));
-                        memcpy(&font.glyphs[i].offsetX, fileDataPtr + 4, sizeof(int));
-                        memcpy(&font.glyphs[i].offsetY, fileDataPtr + 8, sizeof(int));
-                        memcpy(&font.glyphs[i].advanceX, fileDataPtr + 12, sizeof(int));
-                        fileDataPtr += 16;
-                    }
-                }
-            }
-            else font = GetFontDefault();   // Fallback in case of errors loading font atlas texture
+    // Separate corner atlas texture only required if gui font atlas does not contain it
+    if (((guiCornerFontId == 0) || (guiCornerFontId != guiFont.texture.id)) && (guiCornerAtlas.id == 0))
+    {
+        Image image = { 0 };
+        image.width = RAYGUI_CORNER_ATLAS_WIDTH;
+        image.height = (int)GetCornerSlice(RAYGUI_CORNER_RADIUS_COUNT - 1, 0, 0).source.y + RAYGUI_CORNER_CELL_SIZE;
+        image.mipmaps = 1;
+        image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        image.data = RAYGUI_CALLOC(image.width*image.height*4, 1);
 
-            GuiSetFont(font);
+        GenCornerAtlas((unsigned char *)image.data, image.width, 4, 0);
 
-            // Set font texture source rectangle to be used as white texture to draw shapes
-            // NOTE: It makes possible to draw shapes and text (full UI) in a single draw call
-            if ((fontWhiteRec.x > 0) &&
-                (fontWhiteRec.y > 0) &&
-                (fontWhiteRec.width > 0) &&
-                (fontWhiteRec.height > 0)) SetShapesTexture(font.texture, fontWhiteRec);
-        }
-#endif
+        guiCornerAtlas = LoadTextureFromImage(image);
+        RAYGUI_FREE(image.data);
+
+        if (guiCornerAtlas.id == 0) return -1;
     }
+
+    return cornerIndex;
 }
 
-// Gui get text width considering icon
-static int GetTextWidth(const char *text)
+// Get corner atlas nine-slice for radius index and border width (0 for filled)
+// NOTE: Shapes for every radius are placed in a row, one cell per border width, 1 pixel padding
+static GuiSkinSlice GetCornerSlice(int cornerIndex, int borderWidth, int offsetY)
 {
-    #if !defined(ICON_TEXT_PADDING)
-        #define ICON_TEXT_PADDING   4
-    #endif
+    int y = offsetY + 1;
+    for (int i = 0; i < cornerIndex; i++) y += 2*guiCornerRadius[i] + 4;
 
-    Vector2 textSize = { 0 };
-    int textIconOffset = 0;
+    int radius = guiCornerRadius[cornerIndex];
+    GuiSkinSlice slice = { { (float)(1 + borderWidth*RAYGUI_CORNER_CELL_SIZE), (float)y, (float)(2*radius + 2), (float)(2*radius + 2) }, radius, radius, radius, radius };
 
-    if ((text != NULL) && (text[0] != '\0'))
+    return slice;
+}
+
+// Generate corner atlas coverage into pixels buffer, white pixels with coverage alpha
+// NOTE: Coverage computed with rounded rectangle signed distance, pixels have 2 (gray, alpha) or 4 (RGBA) channels
+static void GenCornerAtlas(unsigned char *pixels, int width, int channels, int offsetY)
+{
+    for (int r = 0; r < RAYGUI_CORNER_RADIUS_COUNT; r++)
     {
-        if (text[0] == '#')
+        for (int b = 0; b <= RAYGUI_CORNER_MAX_BORDER; b++)
         {
-            for (int i = 1; (i < 5) && (text[i] != '\0'); i++)
+            if (b > guiCornerRadius[r]) continue;
+
+            GuiSkinSlice cell = GetCornerSlice(r, b, offsetY);
+            float outerRadius = (float)guiCornerRadius[r];
+            float innerRadius = (float)(guiCornerRadius[r] - b);
+            float half = cell.source.width/2.0f;
+
+            for (int y = 0; y < (int)cell.source.height; y++)
             {
-                if (text[i] == '#')
+                for (int x = 0; x < (int)cell.source.width; x++)
                 {
-                    textIconOffset = i;
-                    break;
+                    // Rounded rectangle signed distance, outer and inner shapes share straight edges region
+                    float qx = fabsf(x + 0.5f - half) - 1.0f;
+                    float qy = fabsf(y + 0.5f - half) - 1.0f;
+                    float qmax = (qx > qy)? qx : qy;
+                    float distance = sqrtf(((qx > 0.0f)? qx*qx : 0.0f) + ((qy > 0.0f)? qy*qy : 0.0f)) + ((qmax < 0.0f)? qmax : 0.0f);
+
+                    // Coverage for pixel center, border is outer shape minus inner shape
+                    float outer = outerRadius - distance + 0.5f;
+                    float inner = (b > 0)? innerRadius - distance + 0.5f : 0.0f;
+                    outer = (outer < 0.0f)? 0.0f : ((outer > 1.0f)? 1.0f : outer);
+                    inner = (inner < 0.0f)? 0.0f : ((inner > 1.0f)? 1.0f : inner);
+                    float coverage = outer - inner;
+
+                    unsigned char *pixel = pixels + (((int)cell.source.y + y)*width + (int)cell.source.x + x)*channels;
+                    for (int c = 0; c < (channels - 1); c++) pixel[c] = 255;
+                    pixel[channels - 1] = (unsigned char)(coverage*255.0f + 0.5f);
                 }
             }
         }
+    }
+}
 
-        text += textIconOffset;
+#if !defined(RAYGUI_STANDALONE)
+// Pack corner atlas under font atlas image, image data is replaced
+// NOTE: Glyphs keep their position, returns corner atlas position in image or 0 if image format is not supported
+static int GuiPackCornerAtlas(Image *image)
+{
+    int channels = (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)? 2 : ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 0);
+    if ((channels == 0) || (image->data == NULL) || (image->width <= 0) || (image->height <= 0)) return 0;
 
-        // Make sure guiFont is set, GuiGetStyle() initializes it lazynessly
-        float fontSize = (float)GuiGetStyle(DEFAULT, TEXT_SIZE);
+    int width = (image->width > RAYGUI_CORNER_ATLAS_WIDTH)? image->width : RAYGUI_CORNER_ATLAS_WIDTH;
+    int height = image->height + (int)GetCornerSlice(RAYGUI_CORNER_RADIUS_COUNT - 1, 0, 0).source.y + RAYGUI_CORNER_CELL_SIZE;
+    unsigned char *pixels = (unsigned char *)RAYGUI_CALLOC(width*height*channels, 1);
+    if (pixels == NULL) return 0;
 
-        // Custom MeasureText() implementation
-        if ((guiFont.texture.id > 0) && (text != NULL))
-        {
-            // Get size in bytes of text, considering end of line and line break
-            int size = 0;
-            for (int i = 0; i < MAX_LINE_BUFFER_SIZE; i++)
-            {
-                if ((text[i] != '\0') && (text[i] != '\n')) size++;
-                else break;
-            }
+    for (int y = 0; y < image->height; y++) memcpy(pixels + y*width*channels, (unsigned char *)image->data + y*image->width*channels, image->width*channels);
 
-            float scaleFactor = fontSize/(float)guiFont.baseSize;
-            textSize.y = (float)guiFont.baseSize*scaleFactor;
-            float glyphWidth = 0.0f;
+    int offsetY = image->height;
+    GenCornerAtlas(pixels, width, channels, offsetY);
 
-            for (int i = 0, codepointSize = 0; i < size; i += codepointSize)
-            {
-                int codepoint = GetCodepointNext(&text[i], &codepointSize);
-                int codepointIndex = GetGlyphIndex(guiFont, codepoint);
+    RAYGUI_FREE(image->data);
+    image->data = pixels;
+    image->width = width;
+    image->height = height;
 
-                if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+    return offsetY;
+}
+#endif
 
-                textSize.x += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-            }
-        }
+// Unload corner atlas separate texture, it is generated again if required
+static void GuiUnloadCornerAtlas(void)
+{
+    if (guiCornerAtlas.id > 0) UnloadTexture(guiCornerAtlas);
+    guiCornerAtlas = RAYGUI_CLITERAL(Texture2D){ 0 };
+}
 
-        if (textIconOffset > 0) textSize.x += (RAYGUI_ICON_SIZE + ICON_TEXT_PADDING);
-    }
+// Gui draw filled rectangle (draw command)
+static void GuiDrawFill(int x, int y, int width, int height, Color color)
+{
+    if ((width <= 0) || (height <= 0) || (color.a == 0)) return;
 
-    return (int)textSize.x;
+    GuiDrawCommand command = { 0 };
+    command.type = DRAW_COMMAND_RECTANGLE;
+    command.rec = RAYGUI_CLITERAL(Rectangle){ (float)x, (float)y, (float)width, (float)height };
+    command.colors[0] = color;
+
+    GuiPushDrawCommand(command);
 }
 
-// Get text bounds considering control bounds
-static Rectangle GetTextBounds(int control, Rectangle bounds)
+#if !defined(RAYGUI_NO_COLORPICKER)
+// Gui draw gradient rectangle (draw command)
+static void GuiDrawGradient(Rectangle rec, Color topLeft, Color bottomLeft, Color bottomRight, Color topRight)
 {
-    Rectangle textBounds = bounds;
+    if ((rec.width <= 0) || (rec.height <= 0)) return;
 
-    textBounds.x = bounds.x + GuiGetStyle(control, BORDER_WIDTH);
-    textBounds.y = bounds.y + GuiGetStyle(control, BORDER_WIDTH) + GuiGetStyle(control, TEXT_PADDING);
-    textBounds.width = bounds.width - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);
-    textBounds.height = bounds.height - 2*GuiGetStyle(control, BORDER_WIDTH) - 2*GuiGetStyle(control, TEXT_PADDING);    // NOTE: Text is processed line per line!
+    GuiDrawCommand command = { 0 };
+    command.type = DRAW_COMMAND_GRADIENT;
+    command.rec = rec;
+    command.colors[0] = topLeft;
+    command.colors[1] = bottomLeft;
+    command.colors[2] = bottomRight;
+    command.colors[3] = topRight;
 
-    // Depending on control, TEXT_PADDING and TEXT_ALIGNMENT properties could affect the text-bounds
-    switch (control)
-    {
-        case COMBOBOX:
-        case DROPDOWNBOX:
-        case LISTVIEW:
-            // TODO: Special cases (no label): COMBOBOX, DROPDOWNBOX, LISTVIEW
-        case SLIDER:
-        case CHECKBOX:
-        case VALUEBOX:
-        case SPINNER:
-            // TODO: More special cases (label on side): SLIDER, CHECKBOX, VALUEBOX, SPINNER
-        default:
-        {
-            // TODO: WARNING: TEXT_ALIGNMENT is already considered in GuiDrawText()
-            if (GuiGetStyle(control, TEXT_ALIGNMENT) == TEXT_ALIGN_RIGHT) textBounds.x -= GuiGetStyle(control, TEXT_PADDING);
-            else textBounds.x += GuiGetStyle(control, TEXT_PADDING);
-        }
-        break;
-    }
+    GuiPushDrawCommand(command);
+}
+#endif
 
-    return textBounds;
+// Gui draw texture rectangle (draw command)
+static void GuiDrawTexture(Texture2D texture, Rectangle source, Rectangle dest, Color tint)
+{
+    if ((dest.width <= 0) || (dest.height <= 0) || (tint.a == 0)) return;
+
+    GuiDrawCommand command = { 0 };
+    command.type = DRAW_COMMAND_TEXTURE;
+    command.rec = dest;
+    command.source = source;
+    command.texture = texture;
+    command.colors[0] = tint;
+
+    GuiPushDrawCommand(command);
 }
 
-// Get text icon if provided and move text cursor
-// NOTE: We support up to 999 values for iconId
-static const char *GetTextIcon(const char *text, int *iconId)
+// Gui draw gui font glyph using text size (draw command)
+// NOTE: Command rectangle is glyph advance width and text size, used as glyph bounds
+static void GuiDrawGlyph(int codepoint, Vector2 position, Color tint)
 {
-#if !defined(RAYGUI_NO_ICONS)
-    *iconId = -1;
-    if (text[0] == '#')     // Maybe we have an icon!
+    if (tint.a == 0) return;
+
+    GuiDrawCommand command = { 0 };
+    command.type = DRAW_COMMAND_GLYPH;
+    command.codepoint = codepoint;
+    command.rec = RAYGUI_CLITERAL(Rectangle){ position.x, position.y, GetGlyphWidth(codepoint), (float)GuiGetStyle(DEFAULT, TEXT_SIZE) };
+    command.colors[0] = tint;
+
+    GuiPushDrawCommand(command);
+}
+
+// Record draw command in draw stream or draw it
+// NOTE: Command is transformed to screen by current transform and culled if out of viewport
+static void GuiPushDrawCommand(GuiDrawCommand command)
+{
+    if ((guiTransformCount > 0) && (command.type != DRAW_COMMAND_SCISSOR_BEGIN) && (command.type != DRAW_COMMAND_SCISSOR_END))
     {
-        char iconValue[4] = { 0 };  // Maximum length for icon value: 3 digits + '\0'
+        if (GuiIsCulled(command.rec)) return;
+
+        command.rec = GetTransformedRec(command.rec);
 
-        int pos = 1;
-        while ((pos < 4) && (text[pos] >= '0') && (text[pos] <= '9'))
+        // Rectangle edges snapped to pixels, adjacent rectangles keep sharing edges when scaled
+        if (command.type == DRAW_COMMAND_RECTANGLE)
         {
-            iconValue[pos - 1] = text[pos];
-            pos++;
+            float left = floorf(command.rec.x + 0.5f);
+            float top = floorf(command.rec.y + 0.5f);
+            command.rec.width = floorf(command.rec.x + command.rec.width + 0.5f) - left;
+            command.rec.height = floorf(command.rec.y + command.rec.height + 0.5f) - top;
+            command.rec.x = left;
+            command.rec.y = top;
+
+            if ((command.rec.width <= 0) || (command.rec.height <= 0)) return;
         }
+    }
+
+    if (guiCachedRegionRecording != NULL)
+    {
+        GuiCachedRegion *region = guiCachedRegionRecording;
 
-        if (text[pos] == '#')
+        if (region->commandCount >= region->commandCapacity)
         {
-            *iconId = TextToInteger(iconValue);
+            int capacity = (region->commandCapacity > 0)? region->commandCapacity*2 : 256;
+            GuiDrawCommand *commands = (GuiDrawCommand *)RAYGUI_REALLOC(region->commands, capacity*sizeof(GuiDrawCommand));
 
-            // Move text pointer after icon
-            // WARNING: If only icon provided, it could point to EOL character: '\0'
-            if (*iconId >= 0) text += (pos + 1);
+            if (commands != NULL)
+            {
+                region->commands = commands;
+                region->commandCapacity = capacity;
+            }
+            else region->valid = false;     // Region can not be fully recorded, it will be processed again
         }
+
+        if (region->commandCount < region->commandCapacity) region->commands[region->commandCount++] = command;
     }
-#endif
 
-    return text;
+    GuiEmitDrawCommand(command);
 }
 
-// Get text divided into lines (by line-breaks '\n')
-const char **GetTextLines(const char *text, int *count)
+// Begin cached region or surface
+static bool GuiBeginCachedRegionEx(const void *key, Rectangle bounds, unsigned int version, bool surface)
 {
-    #define RAYGUI_MAX_TEXT_LINES   128
+    guiCachedRegionDepth++;
+    if ((guiCachedRegionDepth > 1) || (key == NULL)) return true;   // Nested regions are part of parent region
 
-    static const char *lines[RAYGUI_MAX_TEXT_LINES] = { 0 };
-    for (int i = 0; i < RAYGUI_MAX_TEXT_LINES; i++) lines[i] = NULL;    // Init NULL pointers to substrings
+    GuiUpdateFrame();
 
-    int textSize = (int)strlen(text);
+    GuiCachedRegion *region = NULL;
+    int oldest = 0;
 
-    lines[0] = text;
-    int len = 0;
-    *count = 1;
-    //int lineSize = 0;   // Stores current line size, not returned
+    for (int i = 0; i < RAYGUI_MAX_CACHED_REGIONS; i++)
+    {
+        if (guiCachedRegions[i].key == key) { region = &guiCachedRegions[i]; break; }
+        if (guiCachedRegions[i].lastUsed < guiCachedRegions[oldest].lastUsed) oldest = i;
+    }
 
-    for (int i = 0, k = 0; (i < textSize) && (*count < RAYGUI_MAX_TEXT_LINES); i++)
+    if (region == NULL)
     {
-        if (text[i] == '\n')
+        region = &guiCachedRegions[oldest];
+#if !defined(RAYGUI_STANDALONE)
+        GuiUnloadCachedSurface(region);
+#endif
+        region->key = key;
+        region->valid = false;
+    }
+
+    region->lastUsed = ++guiCachedRegionCounter;
+
+    bool hovered = CheckCollisionPointRec(GetTransformedMousePosition(), bounds);
+
+    if (region->valid && (region->surface == surface) && !hovered && !guiControlExclusiveMode && (region->version == version) &&
+        (region->bounds.x == bounds.x) && (region->bounds.y == bounds.y) && (region->bounds.width == bounds.width) && (region->bounds.height == bounds.height) &&
+        (region->transform.offset.x == guiTransform.offset.x) && (region->transform.offset.y == guiTransform.offset.y) && (region->transform.scale == guiTransform.scale) &&
+        (region->state == guiState) && (region->locked == guiLocked) && (region->alpha == guiAlpha))
+    {
+#if !defined(RAYGUI_STANDALONE)
+        if (region->surface && region->targetValid)
         {
-            //lineSize = len;
-            k++;
-            lines[k] = &text[i + 1];     // WARNING: next value is valid?
-            len = 0;
-            *count += 1;
+            // Render texture is vertically flipped, transform already applied to surface content
+            GuiDrawCommand command = { 0 };
+            command.type = DRAW_COMMAND_SURFACE;
+            command.rec = region->targetRec;
+            command.source = RAYGUI_CLITERAL(Rectangle){ 0, 0, (float)region->target.texture.width, -(float)region->target.texture.height };
+            command.texture = region->target.texture;
+            command.colors[0] = RAYGUI_CLITERAL(Color){ 255, 255, 255, 255 };
+
+            GuiEmitDrawCommand(command);
         }
-        else len++;
+        else
+#endif
+        for (int i = 0; i < region->commandCount; i++) GuiEmitDrawCommand(region->commands[i]);
+
+        guiStats.regionsReplayed++;
+
+        return false;
     }
 
-    //lines[*count - 1].size = len;
+    // Region recorded while hovered is not replayed, so it is processed again once mouse leaves
+    region->version = version;
+    region->bounds = bounds;
+    region->transform = guiTransform;
+    region->state = guiState;
+    region->locked = guiLocked;
+    region->alpha = guiAlpha;
+    region->valid = !hovered && !guiControlExclusiveMode;
+    region->commandCount = 0;
+    region->surface = surface;
+#if !defined(RAYGUI_STANDALONE)
+    region->targetValid = false;
+#endif
 
-    return lines;
+    guiCachedRegionRecording = region;
+    guiStats.regionsRecorded++;
+
+    return true;
 }
 
-// Get text width to next space for provided string
-static float GetNextSpaceWidth(const char *text, int *nextSpaceIndex)
+// Keep cached region being recorded from replay while a control is edited
+// NOTE: Edited controls take keyboard input with mouse out of region bounds, region is processed until edit ends
+static void GuiCachedRegionEdit(bool editMode)
 {
-    float width = 0;
-    int codepointByteCount = 0;
-    int codepoint = 0;
-    int index = 0;
-    float glyphWidth = 0;
-    float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/guiFont.baseSize;
+    if (editMode && (guiCachedRegionRecording != NULL)) guiCachedRegionRecording->valid = false;
+}
 
-    for (int i = 0; text[i] != '\0'; i++)
+#if !defined(RAYGUI_STANDALONE)
+// Render cached surface recorded commands into its render texture
+// NOTE: Least recently used surfaces are unloaded to fit memory budget, surface is not rendered
+// (replayed as cached region) if it does not fit or inside a scissor (scissor state would clip it)
+static void GuiRenderCachedSurface(GuiCachedRegion *region)
+{
+    if (guiScissorActive) return;
+
+    float scale = region->transform.scale;
+    float left = floorf(region->bounds.x*scale + region->transform.offset.x);
+    float top = floorf(region->bounds.y*scale + region->transform.offset.y);
+    int width = (int)ceilf((region->bounds.x + region->bounds.width)*scale + region->transform.offset.x - left);
+    int height = (int)ceilf((region->bounds.y + region->bounds.height)*scale + region->transform.offset.y - top);
+
+    if ((width <= 0) || (height <= 0) || ((width*height) > (RAYGUI_SURFACES_MEMORY_BUDGET/4))) return;
+
+    if ((region->target.id > 0) && ((region->target.texture.width != width) || (region->target.texture.height != height))) GuiUnloadCachedSurface(region);
+
+    if (region->target.id == 0)
     {
-        if (text[i] != ' ')
+        while ((guiSurfacesMemory + width*height*4) > RAYGUI_SURFACES_MEMORY_BUDGET)
         {
-            codepoint = GetCodepoint(&text[i], &codepointByteCount);
-            index = GetGlyphIndex(guiFont, codepoint);
-            glyphWidth = (guiFont.glyphs[index].advanceX == 0)? guiFont.recs[index].width*scaleFactor : guiFont.glyphs[index].advanceX*scaleFactor;
-            width += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+            GuiCachedRegion *oldest = NULL;
+            for (int i = 0; i < RAYGUI_MAX_CACHED_REGIONS; i++)
+            {
+                if ((guiCachedRegions[i].target.id > 0) && (&guiCachedRegions[i] != region) &&
+                    ((oldest == NULL) || (guiCachedRegions[i].lastUsed < oldest->lastUsed))) oldest = &guiCachedRegions[i];
+            }
+
+            if (oldest == NULL) return;
+            GuiUnloadCachedSurface(oldest);
         }
-        else
+
+        region->target = LoadRenderTexture(width, height);
+        if (region->target.id == 0) return;
+
+        guiSurfacesMemory += width*height*4;
+    }
+
+    region->targetRec = RAYGUI_CLITERAL(Rectangle){ left, top, (float)width, (float)height };
+
+    // Color is blended as on screen while alpha accumulates coverage, so surface content is premultiplied
+    BeginTextureMode(region->target);
+        ClearBackground(RAYGUI_CLITERAL(Color){ 0, 0, 0, 0 });
+        rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+        BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+
+        for (int i = 0; i < region->commandCount; i++)
         {
-            *nextSpaceIndex = i;
-            break;
+            GuiDrawCommand command = region->commands[i];
+            command.rec.x -= left;
+            command.rec.y -= top;
+
+            GuiRunDrawCommand(&command);
         }
-    }
 
-    return width;
+        EndBlendMode();
+    EndTextureMode();
+
+    region->targetValid = true;
+    guiStats.surfacesRendered++;
 }
 
-// Gui draw text using default font
-static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, Color tint)
+// Unload cached surface render texture
+static void GuiUnloadCachedSurface(GuiCachedRegion *region)
 {
-    #define TEXT_VALIGN_PIXEL_OFFSET(h)  ((int)h%2)     // Vertical alignment for pixel perfect
+    if (region->target.id > 0)
+    {
+        guiSurfacesMemory -= region->target.texture.width*region->target.texture.height*4;
+        UnloadRenderTexture(region->target);
+    }
 
-    #if !defined(ICON_TEXT_PADDING)
-        #define ICON_TEXT_PADDING   4
-    #endif
+    region->target = RAYGUI_CLITERAL(RenderTexture2D){ 0 };
+    region->targetValid = false;
+}
+#endif
 
-    if ((text == NULL) || (text[0] == '\0')) return;    // Security check
+// Add screen draw command to draw stream or draw it
+static void GuiEmitDrawCommand(GuiDrawCommand command)
+{
+    if (!guiDrawStreamActive)
+    {
+        GuiRunDrawCommand(&command);
+        return;
+    }
 
-    // PROCEDURE:
-    //   - Text is processed line per line
-    //   - For every line, horizontal alignment is defined
-    //   - For all text, vertical alignment is defined (multiline text only)
-    //   - For every line, wordwrap mode is checked (useful for GuitextBox(), read-only)
+    if (guiDrawCommandCount >= guiDrawCommandCapacity)
+    {
+        int capacity = (guiDrawCommandCapacity > 0)? guiDrawCommandCapacity*2 : 1024;
+        GuiDrawCommand *commands = (GuiDrawCommand *)RAYGUI_REALLOC(guiDrawCommands, capacity*sizeof(GuiDrawCommand));
 
-    // Get text lines (using '\n' as delimiter) to be processed individually
-    // WARNING: We can't use GuiTextSplit() function because it can be already used
-    // before the GuiDrawText() call and its buffer is static, it would be overriden :(
-    int lineCount = 0;
-    const char **lines = GetTextLines(text, &lineCount);
+        if (commands == NULL)
+        {
+            RAYGUI_LOG("WARNING: Draw stream commands buffer could not be grown, command not recorded");
+            return;
+        }
 
-    // Text style variables
-    //int alignment = GuiGetStyle(DEFAULT, TEXT_ALIGNMENT);
-    int alignmentVertical = GuiGetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL);
-    int wrapMode = GuiGetStyle(DEFAULT, TEXT_WRAP_MODE);    // Wrap-mode only available in read-only mode, no for text editing
+        guiDrawCommands = commands;
+        guiDrawCommandCapacity = capacity;
+    }
+
+    guiDrawCommands[guiDrawCommandCount] = command;
+    guiDrawCommandCount++;
+}
 
-    // TODO: WARNING: This totalHeight is not valid for vertical alignment in case of word-wrap
-    float totalHeight = (float)(lineCount*GuiGetStyle(DEFAULT, TEXT_SIZE) + (lineCount - 1)*GuiGetStyle(DEFAULT, TEXT_SIZE)/2);
-    float posOffsetY = 0.0f;
+// Get mouse position in current transform space
+static Vector2 GetTransformedMousePosition(void)
+{
+    Vector2 position = GetMousePosition();
 
-    for (int i = 0; i < lineCount; i++)
+    if (guiTransformCount > 0)
     {
-        int iconId = 0;
-        lines[i] = GetTextIcon(lines[i], &iconId);      // Check text for icon and move cursor
+        position.x = (position.x - guiTransform.offset.x)/guiTransform.scale;
+        position.y = (position.y - guiTransform.offset.y)/guiTransform.scale;
+    }
 
-        // Get text position depending on alignment and iconId
-        //---------------------------------------------------------------------------------
-        Vector2 textBoundsPosition = { textBounds.x, textBounds.y };
-        float textBoundsWidthOffset = 0.0f;
+    return position;
+}
 
-        // NOTE: We get text size after icon has been processed
-        // WARNING: GetTextWidth() also processes text icon to get width! -> Really needed?
-        int textSizeX = GetTextWidth(lines[i]);
+// Get rectangle transformed to screen by current transform
+static Rectangle GetTransformedRec(Rectangle rec)
+{
+    if (guiTransformCount > 0)
+    {
+        rec.x = rec.x*guiTransform.scale + guiTransform.offset.x;
+        rec.y = rec.y*guiTransform.scale + guiTransform.offset.y;
+        rec.width *= guiTransform.scale;
+        rec.height *= guiTransform.scale;
+    }
 
-        // If text requires an icon, add size to measure
-        if (iconId >= 0)
-        {
-            textSizeX += RAYGUI_ICON_SIZE*guiIconScale;
+    return rec;
+}
 
-            // WARNING: If only icon provided, text could be pointing to EOF character: '\0'
-#if !defined(RAYGUI_NO_ICONS)
-            if ((lines[i] != NULL) && (lines[i][0] != '\0')) textSizeX += ICON_TEXT_PADDING;
-#endif
-        }
+// Check if bounds are out of transformed viewport (only with transforms)
+// NOTE: Viewport is current scissor rectangle or screen, controls in exclusive mode are never culled
+static bool GuiIsCulled(Rectangle bounds)
+{
+    if ((guiTransformCount == 0) || guiControlExclusiveMode) return false;
 
-        // Check guiTextAlign global variables
-        switch (alignment)
-        {
-            case TEXT_ALIGN_LEFT: textBoundsPosition.x = textBounds.x; break;
-            case TEXT_ALIGN_CENTER: textBoundsPosition.x = textBounds.x +  textBounds.width/2 - textSizeX/2; break;
-            case TEXT_ALIGN_RIGHT: textBoundsPosition.x = textBounds.x + textBounds.width - textSizeX; break;
-            default: break;
-        }
+    Rectangle rec = GetTransformedRec(bounds);
+    Rectangle viewport = guiScissorActive? guiScissorRec : RAYGUI_CLITERAL(Rectangle){ 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() };
 
-        if (textSizeX > textBounds.width && (lines[i] != NULL) && (lines[i][0] != '\0')) textBoundsPosition.x = textBounds.x;
+    return ((rec.x >= (viewport.x + viewport.width)) || ((rec.x + rec.width) <= viewport.x) ||
+            (rec.y >= (viewport.y + viewport.height)) || ((rec.y + rec.height) <= viewport.y));
+}
 
-        switch (alignmentVertical)
+// Draw command using backend drawing functions
+static void GuiRunDrawCommand(const GuiDrawCommand *command)
+{
+    switch (command->type)
+    {
+        case DRAW_COMMAND_RECTANGLE: DrawRectangle((int)command->rec.x, (int)command->rec.y, (int)command->rec.width, (int)command->rec.height, command->colors[0]); break;
+        case DRAW_COMMAND_GRADIENT: DrawRectangleGradientEx(command->rec, command->colors[0], command->colors[1], command->colors[2], command->colors[3]); break;
+        case DRAW_COMMAND_TEXTURE: DrawTexturePro(command->texture, command->source, command->rec, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, command->colors[0]); break;
+#if !defined(RAYGUI_STANDALONE)
+        case DRAW_COMMAND_SURFACE:
         {
-            // Only valid in case of wordWrap = 0;
-            case TEXT_ALIGN_TOP: textBoundsPosition.y = textBounds.y + posOffsetY; break;
-            case TEXT_ALIGN_MIDDLE: textBoundsPosition.y = textBounds.y + posOffsetY + textBounds.height/2 - totalHeight/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height); break;
-            case TEXT_ALIGN_BOTTOM: textBoundsPosition.y = textBounds.y + posOffsetY + textBounds.height - totalHeight + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height); break;
-            default: break;
-        }
-
-        // NOTE: Make sure we get pixel-perfect coordinates,
-        // In case of decimals we got weird text positioning
-        textBoundsPosition.x = (float)((int)textBoundsPosition.x);
-        textBoundsPosition.y = (float)((int)textBoundsPosition.y);
-        //---------------------------------------------------------------------------------
-
-        // Draw text (with icon if available)
-        //---------------------------------------------------------------------------------
+            BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+                DrawTexturePro(command->texture, command->source, command->rec, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, command->colors[0]);
+            EndBlendMode();
+        } break;
+#endif
+        case DRAW_COMMAND_GLYPH: DrawTextCodepoint(guiFont, command->codepoint, RAYGUI_CLITERAL(Vector2){ command->rec.x, command->rec.y }, command->rec.height, command->colors[0]); break;
+        case DRAW_COMMAND_SCISSOR_BEGIN: BeginScissorMode((int)command->rec.x, (int)command->rec.y, (int)command->rec.width, (int)command->rec.height); break;
+        case DRAW_COMMAND_SCISSOR_END: EndScissorMode(); break;
 #if !defined(RAYGUI_NO_ICONS)
-        if (iconId >= 0)
-        {
-            // NOTE: We consider icon height, probably different than text size
-            GuiDrawIcon(iconId, (int)textBoundsPosition.x, (int)(textBounds.y + textBounds.height/2 - RAYGUI_ICON_SIZE*guiIconScale/2 + TEXT_VALIGN_PIXEL_OFFSET(textBounds.height)), guiIconScale, tint);
-            textBoundsPosition.x += (float)(RAYGUI_ICON_SIZE*guiIconScale + ICON_TEXT_PADDING);
-            textBoundsWidthOffset = (float)(RAYGUI_ICON_SIZE*guiIconScale + ICON_TEXT_PADDING);
-        }
+        case DRAW_COMMAND_ICON: GuiDrawIconRuns(command, NULL); break;
 #endif
-        // Get size in bytes of text,
-        // considering end of line and line break
-        int lineSize = 0;
-        for (int c = 0; (lines[i][c] != '\0') && (lines[i][c] != '\n') && (lines[i][c] != '\r'); c++, lineSize++){ }
-        float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/guiFont.baseSize;
+        default: break;
+    }
+}
 
-        int lastSpaceIndex = 0;
-        bool tempWrapCharMode = false;
+// Merge same color rectangles into previous ones, keeping painter's order
+// NOTE: A rectangle is merged into a previous one when both union is a rectangle (same row or column, touching
+// or overlapping, or containing) and no command drawn between them intersects it, overlapping requires opaque color
+static void GuiMergeDrawStream(void)
+{
+    for (int i = 1; i < guiDrawCommandCount; i++)
+    {
+        GuiDrawCommand *command = &guiDrawCommands[i];
+        if (command->type != DRAW_COMMAND_RECTANGLE) continue;
 
-        int textOffsetY = 0;
-        float textOffsetX = 0.0f;
-        float glyphWidth = 0;
+        Rectangle rec = command->rec;
+        Color color = command->colors[0];
+        bool opaque = (color.a == 255);
+        int first = (i > RAYGUI_DRAW_STREAM_MERGE_DISTANCE)? i - RAYGUI_DRAW_STREAM_MERGE_DISTANCE : 0;
 
-        int ellipsisWidth = GetTextWidth("...");
-        bool textOverflow = false;
-        for (int c = 0, codepointSize = 0; c < lineSize; c += codepointSize)
+        for (int k = i - 1; k >= first; k--)
         {
-            int codepoint = GetCodepointNext(&lines[i][c], &codepointSize);
-            int index = GetGlyphIndex(guiFont, codepoint);
+            GuiDrawCommand *previous = &guiDrawCommands[k];
 
-            // NOTE: Normally we exit the decoding sequence as soon as a bad byte is found (and return 0x3f)
-            // but we need to draw all of the bad bytes using the '?' symbol moving one byte
-            if (codepoint == 0x3f) codepointSize = 1; // TODO: Review not recognized codepoints size
+            if (previous->type == DRAW_COMMAND_REMOVED) continue;
+            if ((previous->type == DRAW_COMMAND_SCISSOR_BEGIN) || (previous->type == DRAW_COMMAND_SCISSOR_END)) break;
 
-            // Get glyph width to check if it goes out of bounds
-            if (guiFont.glyphs[index].advanceX == 0) glyphWidth = ((float)guiFont.recs[index].width*scaleFactor);
-            else glyphWidth = (float)guiFont.glyphs[index].advanceX*scaleFactor;
+            Rectangle prev = previous->rec;
+            bool overlap = ((rec.x < (prev.x + prev.width)) && (prev.x < (rec.x + rec.width)) &&
+                            (rec.y < (prev.y + prev.height)) && (prev.y < (rec.y + rec.height)));
 
-            // Wrap mode text measuring, to validate if
-            // it can be drawn or a new line is required
-            if (wrapMode == TEXT_WRAP_CHAR)
+            if ((previous->type == DRAW_COMMAND_RECTANGLE) && (previous->colors[0].r == color.r) && (previous->colors[0].g == color.g) &&
+                (previous->colors[0].b == color.b) && (previous->colors[0].a == color.a) && (!overlap || opaque))
             {
-                // Jump to next line if current character reach end of the box limits
-                if ((textOffsetX + glyphWidth) > textBounds.width - textBoundsWidthOffset)
+                bool merged = false;
+                float left = (rec.x < prev.x)? rec.x : prev.x;
+                float top = (rec.y < prev.y)? rec.y : prev.y;
+                float right = ((rec.x + rec.width) > (prev.x + prev.width))? rec.x + rec.width : prev.x + prev.width;
+                float bottom = ((rec.y + rec.height) > (prev.y + prev.height))? rec.y + rec.height : prev.y + prev.height;
+
+                // Same row or same column, touching or overlapping
+                if ((rec.y == prev.y) && (rec.height == prev.height) && (rec.x <= (prev.x + prev.width)) && (prev.x <= (rec.x + rec.width))) merged = true;
+                else if ((rec.x == prev.x) && (rec.width == prev.width) && (rec.y <= (prev.y + prev.height)) && (prev.y <= (rec.y + rec.height))) merged = true;
+                else if (((right - left) == rec.width) && ((bottom - top) == rec.height)) merged = true;     // Containing previous
+                else if (((right - left) == prev.width) && ((bottom - top) == prev.height)) merged = true;   // Contained in previous
+
+                if (merged)
                 {
-                    textOffsetX = 0.0f;
-                    textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
-
-                    if (tempWrapCharMode)   // Wrap at char level when too long words
-                    {
-                        wrapMode = TEXT_WRAP_WORD;
-                        tempWrapCharMode = false;
-                    }
+                    previous->rec = RAYGUI_CLITERAL(Rectangle){ left, top, right - left, bottom - top };
+                    command->type = DRAW_COMMAND_REMOVED;
+                    guiStats.drawCommandsMerged++;
+                    break;
                 }
             }
-            else if (wrapMode == TEXT_WRAP_WORD)
-            {
-                if (codepoint == 32) lastSpaceIndex = c;
 
-                // Get width to next space in line
-                int nextSpaceIndex = 0;
-                float nextSpaceWidth = GetNextSpaceWidth(lines[i] + c, &nextSpaceIndex);
+            // Rectangle can not be moved below an intersecting command, painter's order would change
+            if (overlap) break;
+        }
+    }
+}
 
-                int nextSpaceIndex2 = 0;
-                float nextWordSize = GetNextSpaceWidth(lines[i] + lastSpaceIndex + 1, &nextSpaceIndex2);
+// Remove draw commands fully covered by later opaque fills
+// NOTE: Commands are processed back to front, occluders are opaque rectangles and gradients,
+// occluders are reset on scissor changes, so only commands inside same scissor are culled
+static void GuiCullDrawStream(void)
+{
+    Rectangle occluders[RAYGUI_DRAW_STREAM_OCCLUDERS] = { 0 };
+    int occluderCount = 0;
 
-                if (nextWordSize > textBounds.width - textBoundsWidthOffset)
-                {
-                    // Considering the case the next word is longer than bounds
-                    tempWrapCharMode = true;
-                    wrapMode = TEXT_WRAP_CHAR;
-                }
-                else if ((textOffsetX + nextSpaceWidth) > textBounds.width - textBoundsWidthOffset)
-                {
-                    textOffsetX = 0.0f;
-                    textOffsetY += GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
-                }
+    for (int i = guiDrawCommandCount - 1; i >= 0; i--)
+    {
+        GuiDrawCommand *command = &guiDrawCommands[i];
+
+        if (command->type == DRAW_COMMAND_REMOVED) continue;
+        if ((command->type == DRAW_COMMAND_SCISSOR_BEGIN) || (command->type == DRAW_COMMAND_SCISSOR_END))
+        {
+            occluderCount = 0;
+            continue;
+        }
+
+        Rectangle rec = command->rec;
+        bool covered = false;
+
+        for (int k = 0; k < occluderCount; k++)
+        {
+            if ((rec.x >= occluders[k].x) && (rec.y >= occluders[k].y) &&
+                ((rec.x + rec.width) <= (occluders[k].x + occluders[k].width)) &&
+                ((rec.y + rec.height) <= (occluders[k].y + occluders[k].height)))
+            {
+                covered = true;
+                break;
             }
+        }
 
-            if (codepoint == '\n') break;   // WARNING: Lines are already processed manually, no need to keep drawing after this codepoint
+        if (covered)
+        {
+            command->type = DRAW_COMMAND_REMOVED;
+            guiStats.drawCommandsCulled++;
+            guiStats.drawCulledArea += rec.width*rec.height;
+        }
+        else if (((command->type == DRAW_COMMAND_RECTANGLE) && (command->colors[0].a == 255)) ||
+                 ((command->type == DRAW_COMMAND_GRADIENT) && (command->colors[0].a == 255) && (command->colors[1].a == 255) &&
+                  (command->colors[2].a == 255) && (command->colors[3].a == 255)))
+        {
+            if (occluderCount < RAYGUI_DRAW_STREAM_OCCLUDERS) occluders[occluderCount++] = rec;
             else
             {
-                // TODO: There are multiple types of spaces in Unicode,
-                // maybe it's a good idea to add support for more: http://jkorpela.fi/chars/spaces.html
-                if ((codepoint != ' ') && (codepoint != '\t'))      // Do not draw codepoints with no glyph
-                {
-                    if (wrapMode == TEXT_WRAP_NONE)
-                    {
-                        // Draw only required text glyphs fitting the textBounds.width
-                        if (textSizeX > textBounds.width)
-                        {
-                            if (textOffsetX <= (textBounds.width - glyphWidth - textBoundsWidthOffset - ellipsisWidth))
-                            {
-                                DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
-                            }
-                            else if (!textOverflow)
-                            {
-                                textOverflow = true;
-
-                                for (int j = 0; j < ellipsisWidth; j += ellipsisWidth/3)
-                                {
-                                    DrawTextCodepoint(guiFont, '.', RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX + j, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
-                                }
-                            }
-                        }
-                        else
-                        {
-                            DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
-                        }
-                    }
-                    else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD))
-                    {
-                        // Draw only glyphs inside the bounds
-                        if ((textBoundsPosition.y + textOffsetY) <= (textBounds.y + textBounds.height - GuiGetStyle(DEFAULT, TEXT_SIZE)))
-                        {
-                            DrawTextCodepoint(guiFont, codepoint, RAYGUI_CLITERAL(Vector2){ textBoundsPosition.x + textOffsetX, textBoundsPosition.y + textOffsetY }, (float)GuiGetStyle(DEFAULT, TEXT_SIZE), GuiFade(tint, guiAlpha));
-                        }
-                    }
-                }
+                // Occluders list is full, smallest occluder is replaced (if new one is larger)
+                int smallest = 0;
+                for (int k = 1; k < occluderCount; k++) if ((occluders[k].width*occluders[k].height) < (occluders[smallest].width*occluders[smallest].height)) smallest = k;
 
-                if (guiFont.glyphs[index].advanceX == 0) textOffsetX += ((float)guiFont.recs[index].width*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
-                else textOffsetX += ((float)guiFont.glyphs[index].advanceX*scaleFactor + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                if ((rec.width*rec.height) > (occluders[smallest].width*occluders[smallest].height)) occluders[smallest] = rec;
             }
         }
-
-        if (wrapMode == TEXT_WRAP_NONE) posOffsetY += (float)GuiGetStyle(DEFAULT, TEXT_LINE_SPACING);
-        else if ((wrapMode == TEXT_WRAP_CHAR) || (wrapMode == TEXT_WRAP_WORD)) posOffsetY += (textOffsetY + (float)GuiGetStyle(DEFAULT, TEXT_LINE_SPACING));
-        //---------------------------------------------------------------------------------
     }
+}
 
-#if defined(RAYGUI_DEBUG_TEXT_BOUNDS)
-    GuiDrawRectangle(textBounds, 0, WHITE, Fade(BLUE, 0.4f));
+// Build vertex arrays from draw stream commands
+// NOTE: Shapes use the shapes texture white rectangle, glyphs quads match raylib DrawTextCodepoint()
+static void GuiBuildDrawData(void)
+{
+    Rectangle scissor = { 0 };
+    bool scissorEnabled = false;
+
+    guiDrawData.vertexCount = 0;
+    guiDrawData.indexCount = 0;
+    guiDrawData.rangeCount = 0;
+    guiDrawData.droppedQuads = 0;
+
+    for (int i = 0; i < guiDrawCommandCount; i++)
+    {
+        const GuiDrawCommand *command = &guiDrawCommands[i];
+        Color colors[4] = { command->colors[0], command->colors[0], command->colors[0], command->colors[0] };
+        Rectangle rec = command->rec;
+        Rectangle source = { 0 };
+        Texture2D texture = { 0 };
+
+        switch (command->type)
+        {
+            case DRAW_COMMAND_SCISSOR_BEGIN: scissor = command->rec; scissorEnabled = true; continue;
+            case DRAW_COMMAND_SCISSOR_END: scissor = RAYGUI_CLITERAL(Rectangle){ 0 }; scissorEnabled = false; continue;
+            case DRAW_COMMAND_GRADIENT: for (int k = 0; k < 4; k++) colors[k] = command->colors[k];     // fallthrough
+            case DRAW_COMMAND_RECTANGLE: texture = guiShapesTexture; source = guiShapesRec; break;
+            case DRAW_COMMAND_TEXTURE:
+            case DRAW_COMMAND_SURFACE: texture = command->texture; source = command->source; break;
+            case DRAW_COMMAND_GLYPH:
+            {
+                int index = GetGlyphIndex(guiFont, command->codepoint);
+                float scaleFactor = command->rec.height/guiFont.baseSize;
+                float padding = (float)guiFont.glyphPadding;
+
+                texture = guiFont.texture;
+                source = RAYGUI_CLITERAL(Rectangle){ guiFont.recs[index].x - padding, guiFont.recs[index].y - padding,
+                    guiFont.recs[index].width + 2*padding, guiFont.recs[index].height + 2*padding };
+                rec = RAYGUI_CLITERAL(Rectangle){ command->rec.x + (guiFont.glyphs[index].offsetX - padding)*scaleFactor,
+                    command->rec.y + (guiFont.glyphs[index].offsetY - padding)*scaleFactor, source.width*scaleFactor, source.height*scaleFactor };
+            } break;
+#if !defined(RAYGUI_NO_ICONS)
+            case DRAW_COMMAND_ICON:
+            {
+                if (!scissorEnabled || ((scissor.width > 0) && (scissor.height > 0))) GuiDrawIconRuns(command, &scissor);
+            } continue;
 #endif
+            default: continue;
+        }
+
+        // Quads inside an empty scissor are not visible
+        if (scissorEnabled && ((scissor.width <= 0) || (scissor.height <= 0))) continue;
+
+        Rectangle uv = { 0 };
+        if ((texture.width > 0) && (texture.height > 0))
+        {
+            uv = RAYGUI_CLITERAL(Rectangle){ source.x/texture.width, source.y/texture.height,
+                (source.x + source.width)/texture.width, (source.y + source.height)/texture.height };
+        }
+
+        GuiPushDrawQuad(texture.id, scissor, (command->type == DRAW_COMMAND_SURFACE), rec, uv, colors);
+    }
 }
 
-// Gui draw rectangle using default raygui plain style with borders
-static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color)
+// Add quad to draw data, a new range is started on texture, scissor or blending change
+// NOTE: Quad uv rectangle contains left, top, right, bottom texture coordinates
+static void GuiPushDrawQuad(unsigned int textureId, Rectangle scissor, bool premultiplied, Rectangle rec, Rectangle uv, const Color *colors)
 {
-    if (color.a > 0)
+    GuiDrawRange *range = (guiDrawData.rangeCount > 0)? &guiDrawData.ranges[guiDrawData.rangeCount - 1] : NULL;
+    bool newRange = ((range == NULL) || (range->textureId != textureId) || (range->premultiplied != premultiplied) ||
+        (range->scissor.x != scissor.x) || (range->scissor.y != scissor.y) ||
+        (range->scissor.width != scissor.width) || (range->scissor.height != scissor.height) ||
+        ((guiDrawData.vertexCount - range->vertexOffset + 4) > 65536));
+
+    GuiDrawRange *ranges = (GuiDrawRange *)GuiGrowDrawBuffer(guiDrawData.ranges, &guiDrawRangeCapacity, guiDrawData.rangeCount + (newRange? 1 : 0), sizeof(GuiDrawRange));
+    if (ranges != NULL) guiDrawData.ranges = ranges;
+    GuiDrawVertex *vertices = (GuiDrawVertex *)GuiGrowDrawBuffer(guiDrawData.vertices, &guiDrawVertexCapacity, guiDrawData.vertexCount + 4, sizeof(GuiDrawVertex));
+    if (vertices != NULL) guiDrawData.vertices = vertices;
+    unsigned short *indices = (unsigned short *)GuiGrowDrawBuffer(guiDrawData.indices, &guiDrawIndexCapacity, guiDrawData.indexCount + 6, sizeof(unsigned short));
+    if (indices != NULL) guiDrawData.indices = indices;
+
+    if ((ranges == NULL) || (vertices == NULL) || (indices == NULL))
     {
-        // Draw rectangle filled with color
-        DrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, GuiFade(color, guiAlpha));
+        guiDrawData.droppedQuads++;
+        return;
     }
 
-    if (borderWidth > 0)
+    if (newRange)
     {
-        // Draw rectangle border lines with color
-        DrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
-        DrawRectangle((int)rec.x, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
-        DrawRectangle((int)rec.x + (int)rec.width - borderWidth, (int)rec.y + borderWidth, borderWidth, (int)rec.height - 2*borderWidth, GuiFade(borderColor, guiAlpha));
-        DrawRectangle((int)rec.x, (int)rec.y + (int)rec.height - borderWidth, (int)rec.width, borderWidth, GuiFade(borderColor, guiAlpha));
+        range = &guiDrawData.ranges[guiDrawData.rangeCount];
+        range->textureId = textureId;
+        range->scissor = scissor;
+        range->premultiplied = premultiplied;
+        range->vertexOffset = guiDrawData.vertexCount;
+        range->indexOffset = guiDrawData.indexCount;
+        range->indexCount = 0;
+        guiDrawData.rangeCount++;
     }
+    else range = &guiDrawData.ranges[guiDrawData.rangeCount - 1];
+
+    // Vertices: top-left, bottom-left, bottom-right, top-right
+    GuiDrawVertex *vertex = &guiDrawData.vertices[guiDrawData.vertexCount];
+    vertex[0] = RAYGUI_CLITERAL(GuiDrawVertex){ rec.x, rec.y, uv.x, uv.y, colors[0].r, colors[0].g, colors[0].b, colors[0].a };
+    vertex[1] = RAYGUI_CLITERAL(GuiDrawVertex){ rec.x, rec.y + rec.height, uv.x, uv.height, colors[1].r, colors[1].g, colors[1].b, colors[1].a };
+    vertex[2] = RAYGUI_CLITERAL(GuiDrawVertex){ rec.x + rec.width, rec.y + rec.height, uv.width, uv.height, colors[2].r, colors[2].g, colors[2].b, colors[2].a };
+    vertex[3] = RAYGUI_CLITERAL(GuiDrawVertex){ rec.x + rec.width, rec.y, uv.width, uv.y, colors[3].r, colors[3].g, colors[3].b, colors[3].a };
+
+    unsigned short base = (unsigned short)(guiDrawData.vertexCount - range->vertexOffset);
+    unsigned short *index = &guiDrawData.indices[guiDrawData.indexCount];
+    index[0] = base; index[1] = base + 1; index[2] = base + 2;
+    index[3] = base; index[4] = base + 2; index[5] = base + 3;
+
+    guiDrawData.vertexCount += 4;
+    guiDrawData.indexCount += 6;
+    range->indexCount += 6;
+}
 
-#if defined(RAYGUI_DEBUG_RECS_BOUNDS)
-    DrawRectangle((int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, Fade(RED, 0.4f));
-#endif
+// Grow draw data buffer to fit count items, NULL if not possible
+// NOTE: Provided buffers (GuiSetDrawDataBuffers()) are never grown
+static void *GuiGrowDrawBuffer(void *buffer, int *capacity, int count, int itemSize)
+{
+    if (count <= *capacity) return buffer;
+    if (guiDrawDataExternal) return NULL;
+
+    int newCapacity = (*capacity > 0)? *capacity : 1024;
+    while (newCapacity < count) newCapacity *= 2;
+
+    void *newBuffer = RAYGUI_REALLOC(buffer, (size_t)newCapacity*itemSize);
+    if (newBuffer == NULL) return NULL;
+
+    *capacity = newCapacity;
+
+    return newBuffer;
 }
 
 // Draw tooltip using control bounds
@@ -5177,55 +8100,13 @@ static const char **GuiTextSplit(const char *text, char delimiter, int *count, i
     return result;
 }
 
+#if !defined(RAYGUI_NO_COLORPICKER)
 // Convert color data from RGB to HSV
 // NOTE: Color data should be passed normalized
 static Vector3 ConvertRGBtoHSV(Vector3 rgb)
 {
     Vector3 hsv = { 0 };
-    float min = 0.0f;
-    float max = 0.0f;
-    float delta = 0.0f;
-
-    min = (rgb.x < rgb.y)? rgb.x : rgb.y;
-    min = (min < rgb.z)? min  : rgb.z;
-
-    max = (rgb.x > rgb.y)? rgb.x : rgb.y;
-    max = (max > rgb.z)? max  : rgb.z;
-
-    hsv.z = max;            // Value
-    delta = max - min;
-
-    if (delta < 0.00001f)
-    {
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;           // Undefined, maybe NAN?
-        return hsv;
-    }
-
-    if (max > 0.0f)
-    {
-        // NOTE: If max is 0, this divide would cause a crash
-        hsv.y = (delta/max);    // Saturation
-    }
-    else
-    {
-        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;           // Undefined, maybe NAN?
-        return hsv;
-    }
-
-    // NOTE: Comparing float values could not work properly
-    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
-    else
-    {
-        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
-        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
-    }
-
-    hsv.x *= 60.0f;     // Convert to degrees
-
-    if (hsv.x < 0.0f) hsv.x += 360.0f;
+    GuiConvertRGBtoHSV(&rgb, &hsv, 1);
 
     return hsv;
 }
@@ -5235,71 +8116,95 @@ static Vector3 ConvertRGBtoHSV(Vector3 rgb)
 static Vector3 ConvertHSVtoRGB(Vector3 hsv)
 {
     Vector3 rgb = { 0 };
-    float hh = 0.0f, p = 0.0f, q = 0.0f, t = 0.0f, ff = 0.0f;
-    long i = 0;
+    GuiConvertHSVtoRGB(&hsv, &rgb, 1);
+
+    return rgb;
+}
+#endif
+
+#if !defined(RAYGUI_NO_COLOR_TEXTURES)
+// Get cached color panel (hue) or hue bar (hue < 0) texture
+// NOTE: Pixels are generated on CPU with batch HSV conversion, sampling HSV at pixel centers:
+// color panel is saturation (x) and value (y) for hue, hue bar is hue (y) with full saturation and value
+static Texture2D GetColorTexture(float hue, int width, int height)
+{
+    Texture2D texture = { 0 };
+    if ((width <= 0) || (height <= 0)) return texture;
+
+    GuiColorTextureEntry *entry = &guiColorTextures[0];
+    guiColorTextureCounter++;
 
-    // NOTE: Comparing float values could not work properly
-    if (hsv.y <= 0.0f)
+    for (int i = 0; i < RAYGUI_COLOR_TEXTURE_CACHE_SIZE; i++)
     {
-        rgb.x = hsv.z;
-        rgb.y = hsv.z;
-        rgb.z = hsv.z;
-        return rgb;
+        GuiColorTextureEntry *current = &guiColorTextures[i];
+
+        if ((current->texture.id > 0) && (current->hue == hue) && (current->texture.width == width) && (current->texture.height == height))
+        {
+            current->lastUsed = guiColorTextureCounter;
+            return current->texture;
+        }
+
+        if (current->lastUsed < entry->lastUsed) entry = current;
     }
 
-    hh = hsv.x;
-    if (hh >= 360.0f) hh = 0.0f;
-    hh /= 60.0f;
+    Image image = { 0 };
+    image.data = RAYGUI_MALLOC(width*height*4);
+    image.width = width;
+    image.height = height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-    i = (long)hh;
-    ff = hh - i;
-    p = hsv.z*(1.0f - hsv.y);
-    q = hsv.z*(1.0f - (hsv.y*ff));
-    t = hsv.z*(1.0f - (hsv.y*(1.0f - ff)));
+    unsigned char *pixels = (unsigned char *)image.data;
+    Vector3 values[64] = { 0 };
+    int x = 0;
+    int y = 0;
 
-    switch (i)
+    for (int i = 0; i < width*height; i += 64)
     {
-        case 0:
-        {
-            rgb.x = hsv.z;
-            rgb.y = t;
-            rgb.z = p;
-        } break;
-        case 1:
-        {
-            rgb.x = q;
-            rgb.y = hsv.z;
-            rgb.z = p;
-        } break;
-        case 2:
-        {
-            rgb.x = p;
-            rgb.y = hsv.z;
-            rgb.z = t;
-        } break;
-        case 3:
-        {
-            rgb.x = p;
-            rgb.y = q;
-            rgb.z = hsv.z;
-        } break;
-        case 4:
+        int count = ((width*height - i) < 64)? (width*height - i) : 64;
+
+        for (int k = 0; k < count; k++)
         {
-            rgb.x = t;
-            rgb.y = p;
-            rgb.z = hsv.z;
-        } break;
-        case 5:
-        default:
+            if (hue >= 0.0f) values[k] = RAYGUI_CLITERAL(Vector3){ hue, (x + 0.5f)/width, 1.0f - (y + 0.5f)/height };
+            else values[k] = RAYGUI_CLITERAL(Vector3){ (y + 0.5f)*360.0f/height, 1.0f, 1.0f };
+
+            x++;
+            if (x == width)
+            {
+                x = 0;
+                y++;
+            }
+        }
+
+        GuiConvertHSVtoRGB(values, values, count);
+
+        for (int k = 0; k < count; k++)
         {
-            rgb.x = hsv.z;
-            rgb.y = p;
-            rgb.z = q;
-        } break;
+            pixels[(i + k)*4 + 0] = (unsigned char)(values[k].x*255.0f + 0.5f);
+            pixels[(i + k)*4 + 1] = (unsigned char)(values[k].y*255.0f + 0.5f);
+            pixels[(i + k)*4 + 2] = (unsigned char)(values[k].z*255.0f + 0.5f);
+            pixels[(i + k)*4 + 3] = 255;
+        }
     }
 
-    return rgb;
+    // Texture of same size is updated in place, otherwise a new one is loaded
+    if ((entry->texture.id > 0) && (entry->texture.width == width) && (entry->texture.height == height)) UpdateTexture(entry->texture, image.data);
+    else
+    {
+        if (entry->texture.id > 0) UnloadTexture(entry->texture);
+        entry->texture = LoadTextureFromImage(image);
+    }
+
+    RAYGUI_FREE(image.data);
+
+    entry->hue = hue;
+    entry->lastUsed = guiColorTextureCounter;
+    GuiUpdateFrame();
+    guiStats.colorTextureUpdates++;
+
+    return entry->texture;
 }
+#endif
 
 // Scroll bar control (used by GuiScrollPanel())
 static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
@@ -5371,7 +8276,7 @@ static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked)
     {
-        Vector2 mousePoint = GetMousePosition();
+        Vector2 mousePoint = GetTransformedMousePosition();
 
         if (guiControlExclusiveMode) // Allows to keep dragging outside of bounds
         {
@@ -5443,7 +8348,7 @@ static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
 
     // Draw control
     //--------------------------------------------------------------------
-    GuiDrawRectangle(bounds, GuiGetStyle(SCROLLBAR, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_DISABLED)));   // Draw the background
+    if (!GuiDrawSkin(SCROLLBAR, state, bounds)) GuiDrawRectangle(bounds, GuiGetStyle(SCROLLBAR, BORDER_WIDTH), GetColor(GuiGetStyle(LISTVIEW, BORDER + state*3)), GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_DISABLED)));   // Draw the background
 
     GuiDrawRectangle(scrollbar, 0, BLANK, GetColor(GuiGetStyle(BUTTON, BASE_COLOR_NORMAL)));     // Draw the scrollbar active area background
     GuiDrawRectangle(slider, 0, BLANK, GetColor(GuiGetStyle(SLIDER, BORDER + state*3)));         // Draw the slider bar
@@ -5532,14 +8437,6 @@ static const char *TextFormat(const char *text, ...)
     return buffer;
 }
 
-// Draw rectangle with vertical gradient fill color
-// NOTE: This function is only used by GuiColorPicker()
-static void DrawRectangleGradientV(int posX, int posY, int width, int height, Color color1, Color color2)
-{
-    Rectangle bounds = { (float)posX, (float)posY, (float)width, (float)height };
-    DrawRectangleGradientEx(bounds, color1, color2, color2, color1);
-}
-
 // Split string into multiple strings
 const char **TextSplit(const char *text, char delimiter, int *count)
 {